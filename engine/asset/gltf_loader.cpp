@@ -1,9 +1,13 @@
 // engine/asset/gltf_loader.cpp
 #include "gltf_loader.h"
 #include "model.h"           // Inclui a definição de Engine::Asset::Model
+#include "mesh_cooker.h"     // Geração de LODs em tempo de carga
+#include "tangent_generator.h" // Tangentes para primitivas sem TANGENT
 #include "./../../engine/render/texture.h" // Inclui a definição de Engine::Render::Texture
 #include "./../../engine/render/material.h" // Inclui a definição de Engine::Render::Material
 #include "./../../engine/core/log.h"
+#include "./../../engine/core/profiler.h"
+#include "./../../engine/memory/allocation_counters.h"
 #include "./../../engine/core/path_utils.h" // Para carregar arquivos de assets
 
 #include <cgltf.h> // Inclua cgltf.h aqui
@@ -35,13 +39,13 @@ std::unique_ptr<Render::Texture> loadGltfTexture(const cgltf_texture* gltfTextur
     if (gltfImage->uri && strncmp(gltfImage->uri, "data:", 5) == 0) {
         // cgltf já decodifica para gltfImage->buffer_view internamente se ela puder.
         // Então, a lógica de buffer_view abaixo deve lidar com isso.
-        Engine::Log::Debug(std::format("GLTFLoader: Textura de imagem embedada (data URI) '{}'.", gltfImage->uri));
+        ENGINE_LOG_DEBUG("GLTFLoader: Textura de imagem embedada (data URI) '{}'.", gltfImage->uri);
         // Vamos direto para a lógica de buffer_view
     } 
     
     // **** CORRIGIDO: Lógica COMPLETA para carregar textura de buffer view (dados binários diretos) ****
     if (gltfImage->buffer_view) {
-        Engine::Log::Debug(std::format("GLTFLoader: Tentando carregar textura binária direta (buffer view) para '{}'.", gltfImage->name ? gltfImage->name : "Sem Nome"));
+        ENGINE_LOG_DEBUG("GLTFLoader: Tentando carregar textura binária direta (buffer view) para '{}'.", gltfImage->name ? gltfImage->name : "Sem Nome");
 
         const cgltf_buffer_view* bufferView = gltfImage->buffer_view;
         if (!bufferView->buffer || !bufferView->buffer->data || bufferView->size == 0) {
@@ -73,7 +77,7 @@ std::unique_ptr<Render::Texture> loadGltfTexture(const cgltf_texture* gltfTextur
     // Se a imagem é externa (URI)
     else if (gltfImage->uri) {
         std::string texturePath = baseDirectory + "/" + gltfImage->uri;
-        Engine::Log::Debug(std::format("GLTFLoader: Tentando carregar textura externa: '{}'", texturePath));
+        ENGINE_LOG_DEBUG("GLTFLoader: Tentando carregar textura externa: '{}'", texturePath);
         try {
             return std::make_unique<Render::Texture>(texturePath); 
         } catch (const std::exception& e) {
@@ -86,13 +90,15 @@ std::unique_ptr<Render::Texture> loadGltfTexture(const cgltf_texture* gltfTextur
 
 
 std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
+    ENGINE_PROFILE_SCOPE("GLTFLoader::loadGLTF");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::Asset);
     Engine::Log::Info(std::format("GLTFLoader: Tentando carregar modelo GLTF de '{}'", filePath));
 
     std::filesystem::path fullPath = Engine::resolveEnginePath(filePath);
     std::string baseDirectory = fullPath.parent_path().string(); // Obtém o diretório pai
 
 
-    cgltf_options options = {0};
+    cgltf_options options = {};
     cgltf_data *data = nullptr;
     
     // cgltf_parse_file funciona para .gltf e .glb
@@ -103,10 +109,10 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
         if (data) { cgltf_free(data); }
         throw std::runtime_error(std::format("GLTFLoader: Falha ao parsear GLTF: {}", filePath));
     }
-    Engine::Log::Debug("GLTFLoader: Parsing inicial do GLTF concluído.");
+    ENGINE_LOG_DEBUG("GLTFLoader: Parsing inicial do GLTF concluído.");
 
     // **** RE-ADICIONADO: cgltf_load_buffers é essencial para preencher data->buffers[i].data ****
-    Engine::Log::Debug("GLTFLoader: Carregando buffers bin├írios com cgltf_load_buffers...");
+    ENGINE_LOG_DEBUG("GLTFLoader: Carregando buffers bin├írios com cgltf_load_buffers...");
     result = cgltf_load_buffers(&options, data, fullPath.string().c_str()); 
 
     if (result != cgltf_result_success) {
@@ -115,7 +121,7 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
         cgltf_free(data);
         throw std::runtime_error(std::format("GLTFLoader: Falha ao carregar buffers GLTF: {}", filePath));
     }
-    Engine::Log::Debug("GLTFLoader: Carregamento de buffers binários GLTF concluído.");
+    ENGINE_LOG_DEBUG("GLTFLoader: Carregamento de buffers binários GLTF concluído.");
 
 
     auto model = std::make_unique<Model>();
@@ -123,17 +129,17 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
     Engine::Log::Info(std::format("GLTFLoader: Processando {} malhas no GLTF '{}'.", data->meshes_count, filePath));
     for (cgltf_size scene_idx = 0; scene_idx < data->scenes_count; ++scene_idx) {
         const cgltf_scene* gltfScene = &data->scenes[scene_idx];
-        Engine::Log::Debug(std::format("GLTFLoader: Processando cena '{}' (nós: {}).", 
-                                       gltfScene->name ? gltfScene->name : "Sem Nome", gltfScene->nodes_count));
+        ENGINE_LOG_DEBUG("GLTFLoader: Processando cena '{}' (nós: {}).", 
+                         gltfScene->name ? gltfScene->name : "Sem Nome", gltfScene->nodes_count);
         
         for (cgltf_size node_idx = 0; node_idx < gltfScene->nodes_count; ++node_idx) {
             const cgltf_node* gltfNode = gltfScene->nodes[node_idx];
             
             if (gltfNode->mesh) { // Se o nó tem uma malha associada
                 const cgltf_mesh* gltfMesh = gltfNode->mesh;
-                Engine::Log::Debug(std::format("GLTFLoader: Processando malha '{}' do nó '{}' (primitivas: {}).", 
-                                               gltfMesh->name ? gltfMesh->name : "Sem Nome", 
-                                               gltfNode->name ? gltfNode->name : "Sem Nome", gltfMesh->primitives_count));
+                ENGINE_LOG_DEBUG("GLTFLoader: Processando malha '{}' do nó '{}' (primitivas: {}).", 
+                                 gltfMesh->name ? gltfMesh->name : "Sem Nome", 
+                                 gltfNode->name ? gltfNode->name : "Sem Nome", gltfMesh->primitives_count);
                 
                 for (cgltf_size j = 0; j < gltfMesh->primitives_count; ++j) {
                     const cgltf_primitive* gltfPrimitive = &gltfMesh->primitives[j];
@@ -141,7 +147,7 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
                     std::vector<glm::vec3> positions; 
                     std::vector<glm::vec3> normals;   
                     std::vector<glm::vec2> texCoords; 
-                    std::vector<glm::vec3> tangents; 
+                    std::vector<glm::vec4> tangents; 
                     std::vector<GLuint> indices;     
 
                     cgltf_size current_vertex_count = 0;
@@ -170,7 +176,7 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
                         } else if (attribute->type == cgltf_attribute_type_tangent) { 
                             tangents.resize(accessor->count);
                             for (cgltf_size k = 0; k < accessor->count; ++k) {
-                                cgltf_accessor_read_float(accessor, k, glm::value_ptr(tangents[k]), 3); 
+                                cgltf_accessor_read_float(accessor, k, glm::value_ptr(tangents[k]), 4); 
                             }
                         }
                     }
@@ -183,7 +189,7 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
                         newVertex.Position = (v_idx < positions.size()) ? positions[v_idx] : glm::vec3(0.0f);
                         newVertex.Normal = (v_idx < normals.size()) ? normals[v_idx] : glm::vec3(0.0f, 1.0f, 0.0f);
                         newVertex.TexCoords = (v_idx < texCoords.size()) ? texCoords[v_idx] : glm::vec2(0.0f);
-                        newVertex.Tangent = (v_idx < tangents.size()) ? tangents[v_idx] : glm::vec3(0.0f); 
+                        newVertex.Tangent = (v_idx < tangents.size()) ? tangents[v_idx] : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f); 
                         finalVertices.push_back(newVertex);
                     }
 
@@ -215,7 +221,7 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
                     std::unique_ptr<Render::Material> material = std::make_unique<Render::Material>(); 
                     if (gltfPrimitive->material) {
                         const cgltf_material* gltfMaterial = gltfPrimitive->material;
-                        Engine::Log::Debug(std::format("GLTFLoader: Processando material '{}'.", gltfMaterial->name ? gltfMaterial->name : "Sem Nome"));
+                        ENGINE_LOG_DEBUG("GLTFLoader: Processando material '{}'.", gltfMaterial->name ? gltfMaterial->name : "Sem Nome");
 
                         material->baseColorFactor = glm::vec4(gltfMaterial->pbr_metallic_roughness.base_color_factor[0],
                                                               gltfMaterial->pbr_metallic_roughness.base_color_factor[1],
@@ -237,7 +243,7 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
                         }
                         if (gltfMaterial->pbr_metallic_roughness.metallic_roughness_texture.texture) {
                             material->setRoughnessMap(loadGltfTexture(gltfMaterial->pbr_metallic_roughness.metallic_roughness_texture.texture, baseDirectory));
-                            Engine::Log::Debug("GLTFLoader: Metallic-Roughness map carregado como RoughnessMap. Shader precisa de lógica de separação de canais.");
+                            ENGINE_LOG_DEBUG("GLTFLoader: Metallic-Roughness map carregado como RoughnessMap. Shader precisa de lógica de separação de canais.");
                         }
                         if (gltfMaterial->occlusion_texture.texture) {
                             material->setAmbientOcclusionMap(loadGltfTexture(gltfMaterial->occlusion_texture.texture, baseDirectory));
@@ -246,19 +252,26 @@ std::unique_ptr<Model> GLTFLoader::loadGLTF(const std::string &filePath) {
                             material->setEmissiveMap(loadGltfTexture(gltfMaterial->emissive_texture.texture, baseDirectory));
                         }
                     } else {
-                        Engine::Log::Debug("GLTFLoader: Primitiva sem material. Usando material padrão.");
+                        ENGINE_LOG_DEBUG("GLTFLoader: Primitiva sem material. Usando material padrão.");
                     }
 
                     if (!finalVertices.empty() && !indices.empty()) {
-                        model->addMesh(std::make_unique<Mesh>(std::move(finalVertices), std::move(indices), std::move(material)));
-                        Engine::Log::Debug(std::format("GLTFLoader: Malha (primitiva {}) adicionada ao modelo. Vértices: {}, Índices: {}.",
-                                                        j, model->getMeshes().back()->getVertexCount(), model->getMeshes().back()->getIndexCount())); 
+                        if (tangents.size() < finalVertices.size()) {
+                            // Sem TANGENT no arquivo: gera no mesmo espaço usado pelos bakers (MikkTSpace)
+                            TangentGenerator::generate(finalVertices, indices);
+                        }
+                        CookedMesh cooked = MeshCooker::cook(finalVertices, indices);
+                        auto mesh = std::make_unique<Mesh>(std::move(finalVertices), std::move(indices), std::move(material), std::move(cooked.lods));
+                        mesh->setMeshlets(std::move(cooked.meshlets));
+                        model->addMesh(std::move(mesh));
+                        ENGINE_LOG_DEBUG("GLTFLoader: Malha (primitiva {}) adicionada ao modelo. Vértices: {}, Índices: {}.",
+                                          j, model->getMeshes().back()->getVertexCount(), model->getMeshes().back()->getIndexCount()); 
                     } else {
                         Engine::Log::Warn(std::format("GLTFLoader: Malha (primitiva {}) não possui vértices ou índices válidos. Ignorando.", j));
                     }
                 }
             } else {
-                Engine::Log::Debug(std::format("GLTFLoader: Nó '{}' não possui malha associada. Ignorando.", gltfNode->name ? gltfNode->name : "Sem Nome"));
+                ENGINE_LOG_DEBUG("GLTFLoader: Nó '{}' não possui malha associada. Ignorando.", gltfNode->name ? gltfNode->name : "Sem Nome");
             }
         }
     }
@@ -0,0 +1,333 @@
+// engine/asset/mesh_cooker.cpp
+#include "mesh_cooker.h"
+#include "mesh_simplifier.h"
+#include "./../core/log.h"
+#include "./../core/config.h"
+#include "./../memory/scratch_arena.h"
+
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <limits>
+
+namespace Engine {
+namespace Asset {
+
+CookedMesh MeshCooker::cook(std::vector<Vertex>& vertices, std::vector<GLuint>& indices) {
+    CookedMesh cooked;
+    if (!Engine::MESH_OPTIMIZE_VERTEX_CACHE) {
+        cooked.lods = generateLods(vertices, indices);
+    } else {
+        cooked.lods = optimizeAndGenerateLods(vertices, indices);
+    }
+
+    if (indices.size() / 3 >= static_cast<size_t>(Engine::MESHLET_MIN_MESH_TRIANGLES)) {
+        cooked.meshlets = buildMeshlets(vertices, indices);
+        Engine::Log::Info(std::format("MeshCooker: {} meshlets ({} triângulos em média).", cooked.meshlets.size(),
+                                      cooked.meshlets.empty() ? 0 : indices.size() / 3 / cooked.meshlets.size()));
+    }
+    return cooked;
+}
+
+std::vector<MeshLodData> MeshCooker::optimizeAndGenerateLods(std::vector<Vertex>& vertices, std::vector<GLuint>& indices) {
+
+    auto start = std::chrono::steady_clock::now();
+    const float acmrBefore = computeAcmr(indices, vertices.size());
+    optimizeVertexCache(indices, vertices.size());
+    const float acmrAfter = computeAcmr(indices, vertices.size());
+    float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // As LODs partem da ordem já otimizada, mas a simplificação embaralha os triângulos de novo
+    std::vector<MeshLodData> lods = generateLods(vertices, indices);
+    start = std::chrono::steady_clock::now();
+    for (MeshLodData& lod : lods) {
+        optimizeVertexCache(lod.indices, vertices.size());
+    }
+    optimizeVertexFetch(vertices, indices, lods);
+    elapsedMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    Engine::Log::Info(std::format("MeshCooker: ACMR {:.3f} -> {:.3f} (cache de {} vértices, {} triângulos), otimização em {:.2f} ms.",
+                                  acmrBefore, acmrAfter, Engine::VERTEX_CACHE_SIZE, indices.size() / 3, elapsedMs));
+    return lods;
+}
+
+std::vector<MeshLodData> MeshCooker::generateLods(const std::vector<Vertex>& vertices, const std::vector<GLuint>& indices) {
+    std::vector<MeshLodData> lods;
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount < static_cast<size_t>(Engine::LOD_MIN_TRIANGLES) || Engine::LOD_MAX_LEVELS <= 0) {
+        return lods;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    lods.reserve(Engine::LOD_MAX_LEVELS);
+
+    const std::vector<GLuint>* source = &indices;
+    float accumulatedError = 0.0f;
+
+    for (int level = 1; level <= Engine::LOD_MAX_LEVELS; ++level) {
+        size_t targetTriangles = static_cast<size_t>(triangleCount * std::pow(Engine::LOD_REDUCTION_PER_LEVEL, static_cast<float>(level)));
+        float levelMaxError = Engine::LOD_MAX_ERROR * static_cast<float>(level) / static_cast<float>(Engine::LOD_MAX_LEVELS);
+
+        float levelError = 0.0f;
+        std::vector<GLuint> simplified = MeshSimplifier::simplify(vertices, *source, targetTriangles * 3,
+                                                                  levelMaxError - accumulatedError, &levelError);
+
+        // Sem pelo menos 10% de redução o nível não compensa a memória extra
+        if (simplified.empty() || simplified.size() > source->size() * 9 / 10) {
+            ENGINE_LOG_DEBUG("MeshCooker: Simplificação estagnou no nível {} ({} índices). Encerrando cadeia.",
+                             level, simplified.size());
+            break;
+        }
+
+        accumulatedError += levelError; // Limite superior: cada nível parte do anterior
+        lods.push_back({std::move(simplified), accumulatedError});
+        source = &lods.back().indices;
+    }
+
+    float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::string chain = std::format("{}", triangleCount);
+    for (const MeshLodData& lod : lods) {
+        chain += std::format(" -> {}", lod.indices.size() / 3);
+    }
+    Engine::Log::Info(std::format("MeshCooker: {} LODs geradas em {:.2f} ms (triângulos: {}).", lods.size(), elapsedMs, chain));
+
+    return lods;
+}
+
+void MeshCooker::optimizeVertexCache(std::vector<GLuint>& indices, size_t vertexCount, int cacheSize) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || vertexCount == 0) {
+        return;
+    }
+
+    // Adjacência vértice -> triângulos em formato CSR; temporários na arena da thread do carregador
+    Memory::ScratchScope scratch;
+    Memory::ScratchVector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (GLuint index : indices) {
+        if (index >= vertexCount) {
+            Engine::Log::Warn("MeshCooker: Índice fora do intervalo de vértices; ordem de triângulos mantida.");
+            return;
+        }
+        adjacencyOffsets[index + 1]++;
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    Memory::ScratchVector<uint32_t> adjacency(indices.size());
+    Memory::ScratchVector<uint32_t> liveTriangles(vertexCount, 0); // Triângulos ainda não emitidos por vértice
+    {
+        Memory::ScratchVector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (int corner = 0; corner < 3; ++corner) {
+                GLuint v = indices[t * 3 + corner];
+                adjacency[cursor[v]++] = static_cast<uint32_t>(t);
+                liveTriangles[v]++;
+            }
+        }
+    }
+
+    Memory::ScratchVector<uint32_t> cacheTime(vertexCount, 0); // Instante em que o vértice entrou no cache
+    Memory::ScratchVector<uint8_t> emitted(triangleCount, 0);
+    Memory::ScratchVector<GLuint> deadEnd;                      // Vértices recentes que ainda podem ter triângulos
+    Memory::ScratchVector<GLuint> candidates;
+    std::vector<GLuint> output;
+    output.reserve(indices.size());
+    deadEnd.reserve(indices.size());
+    candidates.reserve(64);
+
+    const uint32_t cache = static_cast<uint32_t>(cacheSize);
+    uint32_t timestamp = cache + 1;
+    size_t scanCursor = 0; // Varredura sequencial quando a pilha de becos sem saída se esgota
+
+    auto skipDeadEnd = [&]() -> int64_t {
+        while (!deadEnd.empty()) {
+            GLuint v = deadEnd.back();
+            deadEnd.pop_back();
+            if (liveTriangles[v] > 0) {
+                return v;
+            }
+        }
+        while (scanCursor < vertexCount) {
+            if (liveTriangles[scanCursor] > 0) {
+                return static_cast<int64_t>(scanCursor);
+            }
+            ++scanCursor;
+        }
+        return -1;
+    };
+
+    int64_t fanning = skipDeadEnd();
+    while (fanning >= 0) {
+        candidates.clear();
+        const GLuint f = static_cast<GLuint>(fanning);
+        for (uint32_t a = adjacencyOffsets[f]; a < adjacencyOffsets[f + 1]; ++a) {
+            const uint32_t t = adjacency[a];
+            if (emitted[t]) {
+                continue;
+            }
+            for (int corner = 0; corner < 3; ++corner) {
+                GLuint v = indices[t * 3 + corner];
+                output.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                liveTriangles[v]--;
+                if (timestamp - cacheTime[v] > cache) {
+                    cacheTime[v] = timestamp++; // Falta no cache: o vértice entra agora
+                }
+            }
+            emitted[t] = 1;
+        }
+
+        // Próximo leque: o candidato que ainda estará no cache depois de emitir seus triângulos
+        // e que está há mais tempo nele; sem candidato, volta por um beco sem saída
+        int64_t best = -1;
+        int64_t bestPriority = -1;
+        for (GLuint v : candidates) {
+            if (liveTriangles[v] == 0) {
+                continue;
+            }
+            int64_t priority = 0;
+            if (timestamp - cacheTime[v] + 2 * liveTriangles[v] <= cache) {
+                priority = timestamp - cacheTime[v];
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = v;
+            }
+        }
+        fanning = best >= 0 ? best : skipDeadEnd();
+    }
+
+    indices.swap(output);
+}
+
+void MeshCooker::optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<GLuint>& indices, std::vector<MeshLodData>& lods) {
+    constexpr GLuint kUnassigned = std::numeric_limits<GLuint>::max();
+    std::vector<GLuint> remap(vertices.size(), kUnassigned);
+    std::vector<Vertex> reordered;
+    reordered.reserve(vertices.size());
+
+    for (GLuint& index : indices) {
+        if (remap[index] == kUnassigned) {
+            remap[index] = static_cast<GLuint>(reordered.size());
+            reordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+    // Vértices fora da LOD 0 (não deveria haver, as LODs só colapsam) vão para o fim
+    for (size_t v = 0; v < vertices.size(); ++v) {
+        if (remap[v] == kUnassigned) {
+            remap[v] = static_cast<GLuint>(reordered.size());
+            reordered.push_back(vertices[v]);
+        }
+    }
+    for (MeshLodData& lod : lods) {
+        for (GLuint& index : lod.indices) {
+            index = remap[index];
+        }
+    }
+    vertices.swap(reordered);
+}
+
+std::vector<Meshlet> MeshCooker::buildMeshlets(const std::vector<Vertex>& vertices, const std::vector<GLuint>& indices,
+                                               int maxVertices, int maxTriangles) {
+    std::vector<Meshlet> meshlets;
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return meshlets;
+    }
+
+    std::vector<uint32_t> lastMeshlet(vertices.size(), std::numeric_limits<uint32_t>::max()); // Vértice já está no meshlet atual?
+    size_t first = 0; // Primeiro triângulo do meshlet atual
+    while (first < triangleCount) {
+        const uint32_t id = static_cast<uint32_t>(meshlets.size());
+        int uniqueVertices = 0;
+        size_t last = first;
+        while (last < triangleCount && static_cast<int>(last - first) < maxTriangles) {
+            int newVertices = 0;
+            for (int corner = 0; corner < 3; ++corner) {
+                newVertices += lastMeshlet[indices[last * 3 + corner]] != id ? 1 : 0;
+            }
+            // Cantos repetidos no mesmo triângulo (degenerado) contam a mais: só torna o limite conservador
+            if (uniqueVertices + newVertices > maxVertices) {
+                break;
+            }
+            for (int corner = 0; corner < 3; ++corner) {
+                lastMeshlet[indices[last * 3 + corner]] = id;
+            }
+            uniqueVertices += newVertices;
+            ++last;
+        }
+
+        Meshlet meshlet;
+        meshlet.indexOffset = static_cast<GLuint>(first * 3);
+        meshlet.indexCount = static_cast<GLuint>((last - first) * 3);
+
+        // Esfera: centro da AABB dos vértices, raio até o mais distante
+        glm::vec3 boundsMin(std::numeric_limits<float>::max());
+        glm::vec3 boundsMax(-std::numeric_limits<float>::max());
+        glm::vec3 normalSum(0.0f);
+        for (size_t triangle = first; triangle < last; ++triangle) {
+            const glm::vec3& p0 = vertices[indices[triangle * 3 + 0]].Position;
+            const glm::vec3& p1 = vertices[indices[triangle * 3 + 1]].Position;
+            const glm::vec3& p2 = vertices[indices[triangle * 3 + 2]].Position;
+            boundsMin = glm::min(boundsMin, glm::min(p0, glm::min(p1, p2)));
+            boundsMax = glm::max(boundsMax, glm::max(p0, glm::max(p1, p2)));
+            glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+            float length = glm::length(normal);
+            if (length > 0.0f) {
+                normalSum += normal / length;
+            }
+        }
+        meshlet.center = (boundsMin + boundsMax) * 0.5f;
+        for (size_t i = meshlet.indexOffset; i < meshlet.indexOffset + meshlet.indexCount; ++i) {
+            meshlet.radius = std::max(meshlet.radius, glm::length(vertices[indices[i]].Position - meshlet.center));
+        }
+
+        // Cone: eixo = normal média; a abertura vem da normal mais afastada do eixo
+        float axisLength = glm::length(normalSum);
+        if (axisLength > 0.0f) {
+            meshlet.coneAxis = normalSum / axisLength;
+            float minDot = 1.0f;
+            for (size_t triangle = first; triangle < last; ++triangle) {
+                const glm::vec3& p0 = vertices[indices[triangle * 3 + 0]].Position;
+                const glm::vec3& p1 = vertices[indices[triangle * 3 + 1]].Position;
+                const glm::vec3& p2 = vertices[indices[triangle * 3 + 2]].Position;
+                glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+                float length = glm::length(normal);
+                if (length > 0.0f) {
+                    minDot = std::min(minDot, glm::dot(normal / length, meshlet.coneAxis));
+                }
+            }
+            // Abertura >= 90 graus: algum triângulo sempre pode estar de frente
+            meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+        }
+
+        meshlets.push_back(meshlet);
+        first = last;
+    }
+    return meshlets;
+}
+
+float MeshCooker::computeAcmr(const std::vector<GLuint>& indices, size_t vertexCount, int cacheSize) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return 0.0f;
+    }
+
+    // FIFO por carimbo: o vértice está no cache se entrou há menos de 'cacheSize' faltas
+    std::vector<uint32_t> insertedAt(vertexCount, 0);
+    uint32_t misses = 0;
+    const uint32_t cache = static_cast<uint32_t>(cacheSize);
+    for (GLuint index : indices) {
+        if (insertedAt[index] == 0 || misses - insertedAt[index] >= cache) {
+            ++misses;
+            insertedAt[index] = misses;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+} // namespace Asset
+} // namespace Engine
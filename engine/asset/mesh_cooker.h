@@ -0,0 +1,57 @@
+// engine/asset/mesh_cooker.h
+#pragma once
+
+#include <vector>
+#include <glad/gl.h> // Para GLuint
+
+#include "model.h" // Para Vertex e MeshLodData
+#include "./../core/config.h"
+
+namespace Engine {
+namespace Asset {
+
+// Resultado do processamento de uma malha além dos próprios vértices/índices
+struct CookedMesh {
+    std::vector<MeshLodData> lods; // LODs 1..N
+    std::vector<Meshlet> meshlets; // Meshlets da LOD 0 (vazio para malhas pequenas)
+};
+
+// O MeshCooker concentra o processamento de malhas feito em tempo de carga (ou de cook),
+// entre o parsing dos loaders e a criação da Mesh na GPU.
+class MeshCooker {
+public:
+    // Processamento completo de uma malha carregada: ordem de triângulos para o cache de vértices,
+    // cadeia de LODs (cada uma também otimizada) e reordenação dos vértices para localidade de leitura.
+    // Altera 'vertices' e 'indices' no lugar e retorna as LODs 1..N já remapeadas e os meshlets.
+    static CookedMesh cook(std::vector<Vertex>& vertices, std::vector<GLuint>& indices);
+
+    // Gera a cadeia de LODs 1..N (a LOD 0 é a própria malha) por simplificação com quádricas de erro.
+    // Cada nível parte do anterior; a cadeia termina cedo se a simplificação não progride.
+    // Malhas com menos de LOD_MIN_TRIANGLES triângulos retornam uma cadeia vazia.
+    static std::vector<MeshLodData> generateLods(const std::vector<Vertex>& vertices, const std::vector<GLuint>& indices);
+
+    // Reordena os triângulos para o cache de vértices pós-transformação (Tipsify, Sander et al. 2007):
+    // percorre a malha em leques ao redor de vértices ainda no cache, em tempo linear.
+    static void optimizeVertexCache(std::vector<GLuint>& indices, size_t vertexCount, int cacheSize = Engine::VERTEX_CACHE_SIZE);
+    // Renumera os vértices pela ordem do primeiro uso na LOD 0 (leituras sequenciais do vertex buffer)
+    // e remapeia os índices de todas as LODs
+    static void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<GLuint>& indices, std::vector<MeshLodData>& lods);
+    // ACMR (vértices transformados por triângulo) simulando um cache FIFO de 'cacheSize' entradas.
+    // 0.5 é o ótimo teórico para malhas regulares grandes; 3.0 é o pior caso.
+    static float computeAcmr(const std::vector<GLuint>& indices, size_t vertexCount, int cacheSize = Engine::VERTEX_CACHE_SIZE);
+    // Divide a lista de triângulos (na ordem atual) em meshlets contíguos de até 'maxVertices'
+    // vértices únicos e 'maxTriangles' triângulos, com esfera envolvente e cone de normais.
+    // A ordem otimizada para o cache já agrupa triângulos vizinhos, então os meshlets ficam compactos.
+    static std::vector<Meshlet> buildMeshlets(const std::vector<Vertex>& vertices, const std::vector<GLuint>& indices,
+                                              int maxVertices = Engine::MESHLET_MAX_VERTICES,
+                                              int maxTriangles = Engine::MESHLET_MAX_TRIANGLES);
+
+private:
+    // Tipsify na LOD 0, geração das LODs (também otimizadas) e reordenação dos vértices, com log do ACMR
+    static std::vector<MeshLodData> optimizeAndGenerateLods(std::vector<Vertex>& vertices, std::vector<GLuint>& indices);
+
+    MeshCooker() = delete;
+};
+
+} // namespace Asset
+} // namespace Engine
@@ -0,0 +1,348 @@
+// engine/asset/mesh_simplifier.cpp
+#include "mesh_simplifier.h"
+#include "./../core/log.h"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <unordered_map>
+
+namespace Engine {
+namespace Asset {
+
+namespace {
+
+// Quádrica simétrica 4x4 armazenada como 10 coeficientes (dupla precisão para estabilidade).
+// Os planos entram sem peso: a soma das distâncias quadráticas nunca é menor que a maior delas, então
+// a raiz do erro é um limite superior da distância do vértice a qualquer plano acumulado.
+struct Quadric {
+    double a2 = 0.0, b2 = 0.0, c2 = 0.0, d2 = 0.0;
+    double ab = 0.0, ac = 0.0, ad = 0.0;
+    double bc = 0.0, bd = 0.0, cd = 0.0;
+
+    // 'n' unitária: a quádrica mede distância na unidade das posições
+    void addPlane(const glm::dvec3& n, double d) {
+        a2 += n.x * n.x; b2 += n.y * n.y; c2 += n.z * n.z; d2 += d * d;
+        ab += n.x * n.y; ac += n.x * n.z; ad += n.x * d;
+        bc += n.y * n.z; bd += n.y * d; cd += n.z * d;
+    }
+
+    void add(const Quadric& o) {
+        a2 += o.a2; b2 += o.b2; c2 += o.c2; d2 += o.d2;
+        ab += o.ab; ac += o.ac; ad += o.ad;
+        bc += o.bc; bd += o.bd; cd += o.cd;
+    }
+
+    // v^T Q v para v = (p, 1): soma das distâncias quadráticas aos planos
+    double evaluate(const glm::dvec3& p) const {
+        double r = a2 * p.x * p.x + b2 * p.y * p.y + c2 * p.z * p.z + d2
+                 + 2.0 * (ab * p.x * p.y + ac * p.x * p.z + ad * p.x + bc * p.y * p.z + bd * p.y + cd * p.z);
+        return r < 0.0 ? 0.0 : r;
+    }
+};
+
+enum class VertexKind : uint8_t {
+    Manifold, // Interior: pode colapsar para qualquer vizinho
+    Border,   // Borda aberta: só colapsa ao longo de uma aresta de borda
+    Locked    // Costura ou topologia não-manifold: nunca colapsa
+};
+
+struct Collapse {
+    GLuint from;
+    GLuint to;
+    double error;
+};
+
+uint64_t edgeKey(GLuint a, GLuint b) {
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+struct PositionHash {
+    size_t operator()(const glm::vec3& p) const {
+        uint32_t bits[3];
+        std::memcpy(bits, &p, sizeof(bits));
+        return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+    }
+};
+
+struct PositionEqual {
+    bool operator()(const glm::vec3& a, const glm::vec3& b) const {
+        return std::memcmp(&a, &b, sizeof(glm::vec3)) == 0;
+    }
+};
+
+glm::dvec3 triangleNormal(const glm::dvec3& p0, const glm::dvec3& p1, const glm::dvec3& p2) {
+    return glm::cross(p1 - p0, p2 - p0);
+}
+
+} // namespace
+
+std::vector<GLuint> MeshSimplifier::simplify(const std::vector<Vertex>& vertices,
+                                             const std::vector<GLuint>& indices,
+                                             size_t targetIndexCount,
+                                             float targetError,
+                                             float* outError) {
+    std::vector<GLuint> result = indices;
+    if (outError) {
+        *outError = 0.0f;
+    }
+
+    const size_t vertexCount = vertices.size();
+    if (vertexCount == 0 || indices.size() % 3 != 0 || result.size() <= targetIndexCount) {
+        return result;
+    }
+
+    // 1. Posições normalizadas pela maior dimensão: o erro fica relativo ao tamanho da malha
+    glm::vec3 minP = vertices[0].Position;
+    glm::vec3 maxP = vertices[0].Position;
+    for (const Vertex& v : vertices) {
+        minP = glm::min(minP, v.Position);
+        maxP = glm::max(maxP, v.Position);
+    }
+    glm::vec3 extent = maxP - minP;
+    double scale = std::max({static_cast<double>(extent.x), static_cast<double>(extent.y), static_cast<double>(extent.z)});
+    scale = scale > 0.0 ? 1.0 / scale : 1.0;
+
+    std::vector<glm::dvec3> positions(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        positions[i] = glm::dvec3(vertices[i].Position - minP) * scale;
+    }
+
+    // 2. Vértices com a mesma posição (costuras de UV/normal) formam um único vértice topológico
+    std::vector<GLuint> remap(vertexCount);
+    std::vector<uint32_t> wedgeCount(vertexCount, 0);
+    {
+        std::unordered_map<glm::vec3, GLuint, PositionHash, PositionEqual> firstByPosition;
+        firstByPosition.reserve(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            auto [it, inserted] = firstByPosition.try_emplace(vertices[i].Position, static_cast<GLuint>(i));
+            remap[i] = it->second;
+            ++wedgeCount[it->second];
+        }
+    }
+
+    // 3. Classificação dos vértices a partir das arestas orientadas (em espaço remapeado)
+    std::vector<VertexKind> kind(vertexCount, VertexKind::Manifold);
+    std::unordered_map<uint64_t, uint32_t> directedEdges;
+    directedEdges.reserve(result.size());
+    for (size_t t = 0; t < result.size(); t += 3) {
+        for (int e = 0; e < 3; ++e) {
+            GLuint a = remap[result[t + e]];
+            GLuint b = remap[result[t + (e + 1) % 3]];
+            ++directedEdges[edgeKey(a, b)];
+        }
+    }
+
+    auto isBorderEdge = [&](GLuint a, GLuint b) {
+        return directedEdges.find(edgeKey(remap[b], remap[a])) == directedEdges.end();
+    };
+
+    for (const auto& [key, count] : directedEdges) {
+        GLuint a = static_cast<GLuint>(key >> 32);
+        GLuint b = static_cast<GLuint>(key & 0xffffffffu);
+        if (count > 1) {
+            kind[a] = VertexKind::Locked;
+            kind[b] = VertexKind::Locked;
+        } else if (directedEdges.find(edgeKey(b, a)) == directedEdges.end()) {
+            if (kind[a] != VertexKind::Locked) { kind[a] = VertexKind::Border; }
+            if (kind[b] != VertexKind::Locked) { kind[b] = VertexKind::Border; }
+        }
+    }
+    for (size_t i = 0; i < vertexCount; ++i) {
+        if (wedgeCount[remap[i]] > 1) {
+            kind[remap[i]] = VertexKind::Locked;
+        }
+    }
+
+    // 4. Quádricas: planos dos triângulos + planos de borda, todos na mesma unidade (distância)
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t t = 0; t < result.size(); t += 3) {
+        GLuint v[3] = {remap[result[t]], remap[result[t + 1]], remap[result[t + 2]]};
+        glm::dvec3 n = triangleNormal(positions[v[0]], positions[v[1]], positions[v[2]]);
+        double length = glm::length(n);
+        if (length <= 0.0) {
+            continue;
+        }
+        n /= length;
+        double d = -glm::dot(n, positions[v[0]]);
+        for (GLuint vertex : v) {
+            quadrics[vertex].addPlane(n, d);
+        }
+
+        for (int e = 0; e < 3; ++e) {
+            GLuint a = v[e];
+            GLuint b = v[(e + 1) % 3];
+            if (directedEdges.find(edgeKey(b, a)) != directedEdges.end()) {
+                continue;
+            }
+            // Plano perpendicular ao triângulo que contém a aresta de borda: afastar-se do contorno custa
+            // a distância ao plano, como nos planos dos triângulos
+            glm::dvec3 edge = positions[b] - positions[a];
+            double edgeLength = glm::length(edge);
+            if (edgeLength <= 0.0) {
+                continue;
+            }
+            glm::dvec3 borderNormal = glm::normalize(glm::cross(edge, n));
+            double borderD = -glm::dot(borderNormal, positions[a]);
+            quadrics[a].addPlane(borderNormal, borderD);
+            quadrics[b].addPlane(borderNormal, borderD);
+        }
+    }
+
+    // Posições normalizadas: o erro quadrático compara direto com o quadrado da distância relativa
+    const double errorLimit = static_cast<double>(targetError) * static_cast<double>(targetError);
+    double maxAcceptedError = 0.0;
+
+    std::vector<GLuint> collapseTarget(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> candidates;
+
+    // 5. Passadas de colapso: cada passada aplica o conjunto independente de colapsos mais baratos
+    while (result.size() > targetIndexCount) {
+        const size_t triangleCount = result.size() / 3;
+
+        // Adjacência vértice (remapeado) -> triângulos, em formato CSR
+        std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0u);
+        for (GLuint index : result) {
+            ++adjacencyOffsets[remap[index] + 1];
+        }
+        for (size_t i = 0; i < vertexCount; ++i) {
+            adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+        }
+        adjacency.resize(result.size());
+        {
+            std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; ++t) {
+                for (int c = 0; c < 3; ++c) {
+                    adjacency[cursor[remap[result[t * 3 + c]]]++] = static_cast<uint32_t>(t);
+                }
+            }
+        }
+
+        candidates.clear();
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (int e = 0; e < 3; ++e) {
+                GLuint a = result[t * 3 + e];
+                GLuint b = result[t * 3 + (e + 1) % 3];
+                for (int dir = 0; dir < 2; ++dir) {
+                    GLuint from = dir == 0 ? a : b;
+                    GLuint to = dir == 0 ? b : a;
+                    VertexKind fromKind = kind[remap[from]];
+                    if (fromKind == VertexKind::Locked) {
+                        continue;
+                    }
+                    if (fromKind == VertexKind::Border && !(isBorderEdge(a, b) && kind[remap[to]] != VertexKind::Manifold)) {
+                        continue;
+                    }
+                    candidates.push_back({from, to, quadrics[remap[from]].evaluate(positions[to])});
+                }
+            }
+        }
+
+        if (candidates.empty()) {
+            break;
+        }
+
+        // Ordenação total (erro, from, to) mantém o resultado determinístico
+        std::sort(candidates.begin(), candidates.end(), [](const Collapse& l, const Collapse& r) {
+            if (l.error != r.error) { return l.error < r.error; }
+            if (l.from != r.from) { return l.from < r.from; }
+            return l.to < r.to;
+        });
+
+        for (size_t i = 0; i < vertexCount; ++i) {
+            collapseTarget[i] = static_cast<GLuint>(i);
+        }
+        std::fill(touched.begin(), touched.end(), uint8_t(0));
+
+        size_t remainingIndices = result.size();
+        size_t collapsesApplied = 0;
+
+        for (const Collapse& collapse : candidates) {
+            if (collapse.error > errorLimit || remainingIndices <= targetIndexCount) {
+                break;
+            }
+            GLuint fromGroup = remap[collapse.from];
+            GLuint toGroup = remap[collapse.to];
+            if (fromGroup == toGroup || touched[fromGroup] || touched[toGroup]) {
+                continue;
+            }
+
+            // Rejeita colapsos que invertem algum triângulo vizinho
+            bool flips = false;
+            size_t degenerate = 0;
+            for (uint32_t a = adjacencyOffsets[fromGroup]; a < adjacencyOffsets[fromGroup + 1] && !flips; ++a) {
+                const GLuint* tri = &result[adjacency[a] * 3];
+                GLuint g[3] = {remap[tri[0]], remap[tri[1]], remap[tri[2]]};
+                if (g[0] == toGroup || g[1] == toGroup || g[2] == toGroup) {
+                    ++degenerate;
+                    continue;
+                }
+                glm::dvec3 p[3] = {positions[tri[0]], positions[tri[1]], positions[tri[2]]};
+                glm::dvec3 before = triangleNormal(p[0], p[1], p[2]);
+                for (int c = 0; c < 3; ++c) {
+                    if (g[c] == fromGroup) {
+                        p[c] = positions[collapse.to];
+                    }
+                }
+                glm::dvec3 after = triangleNormal(p[0], p[1], p[2]);
+                if (glm::dot(before, after) <= 0.0) {
+                    flips = true;
+                }
+            }
+            if (flips) {
+                continue;
+            }
+
+            collapseTarget[collapse.from] = collapse.to;
+            quadrics[toGroup].add(quadrics[fromGroup]);
+            maxAcceptedError = std::max(maxAcceptedError, collapse.error);
+            remainingIndices -= degenerate * 3;
+            ++collapsesApplied;
+
+            // Trava o anel de vizinhos: colapsos da mesma passada nunca compartilham triângulos
+            for (uint32_t a = adjacencyOffsets[fromGroup]; a < adjacencyOffsets[fromGroup + 1]; ++a) {
+                const GLuint* tri = &result[adjacency[a] * 3];
+                touched[remap[tri[0]]] = 1;
+                touched[remap[tri[1]]] = 1;
+                touched[remap[tri[2]]] = 1;
+            }
+        }
+
+        if (collapsesApplied == 0) {
+            break;
+        }
+
+        // Reescreve os índices e descarta triângulos degenerados
+        size_t write = 0;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            GLuint a = collapseTarget[result[t * 3 + 0]];
+            GLuint b = collapseTarget[result[t * 3 + 1]];
+            GLuint c = collapseTarget[result[t * 3 + 2]];
+            if (remap[a] == remap[b] || remap[b] == remap[c] || remap[a] == remap[c]) {
+                continue;
+            }
+            result[write++] = a;
+            result[write++] = b;
+            result[write++] = c;
+        }
+        result.resize(write);
+    }
+
+    float achievedError = static_cast<float>(std::sqrt(maxAcceptedError));
+    if (outError) {
+        *outError = achievedError;
+    }
+
+    ENGINE_LOG_DEBUG("MeshSimplifier: {} -> {} triângulos (alvo: {}, erro: {:.5f}).",
+                     indices.size() / 3, result.size() / 3, targetIndexCount / 3, achievedError);
+    return result;
+}
+
+} // namespace Asset
+} // namespace Engine
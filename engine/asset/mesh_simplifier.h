@@ -0,0 +1,34 @@
+// engine/asset/mesh_simplifier.h
+#pragma once
+
+#include <vector>
+#include <glad/gl.h> // Para GLuint
+
+#include "model.h" // Para Engine::Asset::Vertex
+
+namespace Engine {
+namespace Asset {
+
+// Simplificação de malhas por colapso de arestas guiado por quádricas de erro (Garland & Heckbert).
+// Os vértices nunca são movidos nem criados: cada colapso funde um vértice em um vizinho já existente,
+// então todas as LODs geradas podem compartilhar o vertex buffer da LOD 0.
+// Vértices de costura (mesma posição com atributos diferentes) ficam travados; vértices de borda
+// só deslizam ao longo da própria borda, o que evita rachaduras no contorno de terrenos.
+class MeshSimplifier {
+public:
+    // Reduz 'indices' até no máximo 'targetIndexCount' índices, sem ultrapassar 'targetError'
+    // (distância relativa à maior dimensão da malha; o erro das quádricas é um limite superior da
+    // distância aos planos originais). Retorna os novos índices; se 'outError' não for nulo, recebe
+    // o maior erro efetivamente aceito.
+    static std::vector<GLuint> simplify(const std::vector<Vertex>& vertices,
+                                        const std::vector<GLuint>& indices,
+                                        size_t targetIndexCount,
+                                        float targetError,
+                                        float* outError = nullptr);
+
+private:
+    MeshSimplifier() = delete;
+};
+
+} // namespace Asset
+} // namespace Engine
@@ -0,0 +1,35 @@
+// engine/asset/meshlet.h
+#pragma once
+
+#include <glad/gl.h> // Para GLuint
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Asset {
+
+// Faixa contígua do index buffer de uma mesh (em índices, não em bytes)
+struct IndexRange {
+    GLuint first = 0;
+    GLuint count = 0;
+};
+
+// Grupo pequeno de triângulos vizinhos da LOD 0 (até MESHLET_MAX_VERTICES vértices e
+// MESHLET_MAX_TRIANGLES triângulos), gerado pelo MeshCooker. Os triângulos de um meshlet são
+// contíguos no index buffer, então os visíveis viram faixas para glMultiDrawElements.
+struct Meshlet {
+    GLuint indexOffset = 0; // Início na LOD 0 (em índices)
+    GLuint indexCount = 0;
+
+    // Esfera envolvente em espaço local (culling por frustum)
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+
+    // Cone das normais: o meshlet inteiro está de costas se
+    // dot(center - câmera, coneAxis) >= coneCutoff * |center - câmera| + radius.
+    // coneCutoff = seno da abertura do cone; 1.0 = normais espalhadas demais (nunca descartado)
+    glm::vec3 coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+    float coneCutoff = 1.0f;
+};
+
+} // namespace Asset
+} // namespace Engine
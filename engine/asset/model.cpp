@@ -1,23 +1,45 @@
 // engine/asset/model.cpp
 #include "model.h"
+#include "vertex_packing.h"
 #include "./../core/log.h"
+#include "./../core/config.h"
+#include "./../core/profiler.h"
+#include "./../memory/scratch_arena.h"
+#include "./../memory/memory_tracker.h"
 
 #include "./../../engine/render/shader.h" // Incluir Shader para Mesh::draw
 
 #include <glad/gl.h>
 #include <cstddef> // For offsetof
+#include <cstdint> // For uintptr_t
 #include <format> 
 
 namespace Engine {
 namespace Asset {
 
 // --- Mesh Class ---
-Mesh::Mesh(std::vector<Vertex>&& vertices, std::vector<GLuint>&& indices, std::unique_ptr<Render::Material> material)
+Mesh::Mesh(std::vector<Vertex>&& vertices, std::vector<GLuint>&& indices, std::unique_ptr<Render::Material> material,
+           std::vector<MeshLodData>&& lods, VertexFormat format, MeshResidency residency)
     : m_vertices(std::move(vertices)),
       m_indices(std::move(indices)),
-      m_material(std::move(material)) {
-    setupMesh();
-    Engine::Log::Info(std::format("Mesh: Created with {} vertices and {} indices.", m_vertices.size(), m_indices.size()));
+      m_material(std::move(material)),
+      m_vertexFormat(format),
+      m_residency(residency) {
+    m_vertexCount = m_vertices.size();
+    m_indexCount = m_indices.size();
+    computeBounds();
+    setupMesh(lods);
+    if (m_residency == MeshResidency::GpuOnly) {
+        releaseCpuData();
+    }
+    m_cpuBytes = m_vertices.capacity() * sizeof(Vertex) + m_indices.capacity() * sizeof(GLuint);
+
+    Memory::MemoryTracker::track(Memory::MemoryTag::Asset, Memory::MemoryDomain::Cpu, m_cpuBytes);
+    Memory::MemoryTracker::trackReleased(Memory::MemoryTag::Asset, m_releasedBytes);
+
+    Engine::Log::Info(std::format("Mesh: Created with {} vertices, {} indices and {} LOD levels ({} vertices, {}-bit indices, residency {}, {} KB on GPU, {} KB on CPU).",
+                                  m_vertexCount, m_indexCount, m_lods.size(), toString(m_vertexFormat), m_indexSize * 8, toString(m_residency),
+                                  (m_gpuVertexBytes + m_gpuIndexBytes) / 1024, m_cpuBytes / 1024));
 }
 
 Mesh::~Mesh() {
@@ -25,24 +47,105 @@ Mesh::~Mesh() {
         glDeleteVertexArrays(1, &m_VAO);
         glDeleteBuffers(1, &m_VBO);
         glDeleteBuffers(1, &m_EBO); 
+        glDeleteVertexArrays(1, &m_positionVAO);
+        glDeleteBuffers(1, &m_positionVBO);
+    }
+
+    Memory::MemoryTracker::untrackReleased(Memory::MemoryTag::Asset, m_releasedBytes);
+    Memory::MemoryTracker::untrack(Memory::MemoryTag::Asset, Memory::MemoryDomain::Cpu, m_cpuBytes);
+    Memory::MemoryTracker::untrack(Memory::MemoryTag::Asset, Memory::MemoryDomain::Gpu, m_gpuVertexBytes + m_gpuIndexBytes);
+    ENGINE_LOG_TRACE("Mesh: Destructor called. OpenGL resources released.");
+}
+
+void Mesh::releaseCpuData() {
+    // swap com vetores vazios: clear/shrink_to_fit não garantem devolver a memória
+    m_releasedBytes = m_vertices.capacity() * sizeof(Vertex) + m_indices.capacity() * sizeof(GLuint);
+    std::vector<Vertex>().swap(m_vertices);
+    std::vector<GLuint>().swap(m_indices);
+}
+
+void Mesh::computeBounds() {
+    if (m_vertices.empty()) {
+        return;
     }
-    Engine::Log::Trace("Mesh: Destructor called. OpenGL resources released.");
+
+    m_bounds.min = m_vertices[0].Position;
+    m_bounds.max = m_vertices[0].Position;
+    for (const Vertex& vertex : m_vertices) {
+        m_bounds.min = glm::min(m_bounds.min, vertex.Position);
+        m_bounds.max = glm::max(m_bounds.max, vertex.Position);
+    }
+
+    // Esfera centrada na AABB: não é a mínima, mas é estável e barata para seleção de LOD
+    m_bounds.center = (m_bounds.min + m_bounds.max) * 0.5f;
+    m_bounds.radius = glm::length(m_bounds.max - m_bounds.center);
 }
 
-void Mesh::setupMesh() {
-    m_VAO = 0; m_VBO = 0; m_EBO = 0; 
+void Mesh::setupMesh(const std::vector<MeshLodData>& lods) {
+    // Todas as LODs compartilham um único EBO: [LOD 0][LOD 1]...[LOD N]
+    m_lods.clear();
+    m_lods.push_back({0, static_cast<GLuint>(m_indices.size()), 0.0f});
+    size_t totalIndexCount = m_indices.size();
+    for (const MeshLodData& lod : lods) {
+        if (lod.indices.empty()) {
+            continue;
+        }
+        m_lods.push_back({static_cast<GLuint>(totalIndexCount), static_cast<GLuint>(lod.indices.size()), lod.error});
+        totalIndexCount += lod.indices.size();
+    }
+
+    if (m_residency == MeshResidency::CpuOnly) {
+        return; // Sem contexto GL (servidor): só as faixas de LOD, para contagens
+    }
+    ENGINE_PROFILE_SCOPE("Mesh::upload");
+
+    // Índices de 16 bits quando todos os vértices cabem neles (metade da memória e da leitura de índices)
+    const bool shortIndices = Engine::MESH_16BIT_INDICES && m_vertexCount <= 65536;
+    m_indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    m_indexSize = shortIndices ? sizeof(uint16_t) : sizeof(GLuint);
+
+    // Cópias só até o glBufferData: na arena temporária da thread (sem heap depois do aquecimento)
+    Memory::ScratchScope scratch;
+    Memory::ScratchVector<GLuint> allIndices;
+    allIndices.reserve(totalIndexCount);
+    allIndices.insert(allIndices.end(), m_indices.begin(), m_indices.end());
+    for (const MeshLodData& lod : lods) {
+        allIndices.insert(allIndices.end(), lod.indices.begin(), lod.indices.end());
+    }
 
+    m_gpuIndexBytes = totalIndexCount * m_indexSize;
     glGenVertexArrays(1, &m_VAO);
     glGenBuffers(1, &m_VBO);
     glGenBuffers(1, &m_EBO); 
+    glGenVertexArrays(1, &m_positionVAO);
+    glGenBuffers(1, &m_positionVBO);
 
     glBindVertexArray(m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO); 
+    if (shortIndices) {
+        Memory::ScratchVector<uint16_t> shortData(allIndices.begin(), allIndices.end());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, shortData.size() * sizeof(uint16_t), shortData.data(), GL_STATIC_DRAW);
+    } else {
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, allIndices.size() * sizeof(GLuint), allIndices.data(), GL_STATIC_DRAW);
+    }
 
-    glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(Vertex), m_vertices.data(), GL_STATIC_DRAW);
+    // Stream só de posições (sem intercalar) para os passes de profundidade; usa o mesmo EBO,
+    // então todas as LODs valem para ele também.
+    if (m_vertexFormat == VertexFormat::Quantized) {
+        setupQuantizedAttributes();
+    } else {
+        setupFloatAttributes();
+    }
+    glBindVertexArray(0); // Unbind VAO
+    Memory::MemoryTracker::track(Memory::MemoryTag::Asset, Memory::MemoryDomain::Gpu, m_gpuVertexBytes + m_gpuIndexBytes);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO); 
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_indices.size() * sizeof(GLuint), m_indices.data(), GL_STATIC_DRAW);
+    ENGINE_LOG_TRACE("Mesh: VAO ({}), VBO ({}), EBO ({}), VAO de posições ({}) configured.", m_VAO, m_VBO, m_EBO, m_positionVAO);
+}
+
+void Mesh::setupFloatAttributes() {
+    glBindVertexArray(m_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(Vertex), m_vertices.data(), GL_STATIC_DRAW);
 
     // Vertex attributes configuration
     // Position (layout = 0)
@@ -56,20 +159,84 @@ void Mesh::setupMesh() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
     // Tangent (layout = 3)
     glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
 
+    Memory::ScratchScope scratch;
+    Memory::ScratchVector<glm::vec3> positions;
+    positions.reserve(m_vertices.size());
+    for (const Vertex& vertex : m_vertices) {
+        positions.push_back(vertex.Position);
+    }
+    glBindVertexArray(m_positionVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_positionVBO);
+    glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(glm::vec3), positions.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
 
-    glBindVertexArray(0); // Unbind VAO
-    Engine::Log::Trace(std::format("Mesh: VAO ({}), VBO ({}), EBO ({}) configured.", m_VAO, m_VBO, m_EBO));
+    m_gpuVertexBytes = m_vertices.size() * (sizeof(Vertex) + sizeof(glm::vec3));
 }
 
-void Mesh::draw(const Render::Shader& shader) const { 
+void Mesh::setupQuantizedAttributes() {
+    std::vector<PackedVertex> packed = VertexPacking::packAll(m_vertices, m_bounds); // Erro coberto por tests/vertex_packing_test.cpp
+
+    glBindVertexArray(m_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, packed.size() * sizeof(PackedVertex), packed.data(), GL_STATIC_DRAW);
+
+    // Mesmas locations do formato float; basic.vert decodifica conforme uQuantizedVertex
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, normal));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, texCoords));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, tangent));
+
+    // Stream de posições: os mesmos 8 bytes (unorm16 x 4) do início de cada PackedVertex
+    Memory::ScratchScope scratch;
+    Memory::ScratchVector<uint16_t> positions;
+    positions.reserve(packed.size() * 4);
+    for (const PackedVertex& vertex : packed) {
+        positions.insert(positions.end(), std::begin(vertex.position), std::end(vertex.position));
+    }
+    glBindVertexArray(m_positionVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_positionVBO);
+    glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(uint16_t), positions.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_UNSIGNED_SHORT, GL_TRUE, 4 * sizeof(uint16_t), (void*)0);
+
+    m_gpuVertexBytes = packed.size() * (sizeof(PackedVertex) + 4 * sizeof(uint16_t));
+}
+
+void Mesh::setPositionDecode(const Render::Shader& shader) const {
+    // Formato float: offset 0 e escala 1 deixam a posição intacta (mesma expressão nos dois formatos,
+    // o que mantém a profundidade idêntica entre o pré-pass e o pass principal)
+    if (m_vertexFormat == VertexFormat::Quantized) {
+        shader.setVec3("uPositionOffset", VertexPacking::positionOffset(m_bounds));
+        shader.setVec3("uPositionScale", VertexPacking::positionScale(m_bounds));
+    } else {
+        shader.setVec3("uPositionOffset", glm::vec3(0.0f));
+        shader.setVec3("uPositionScale", glm::vec3(1.0f));
+    }
+}
+
+void Mesh::draw(const Render::Shader& shader, size_t lod) const { 
+    if (m_VAO == 0) {
+        return; // MeshResidency::CpuOnly
+    }
     if (m_material) {
         m_material->activate(shader); // Ativa o material (configura uniforms)
     }
+    setPositionDecode(shader);
+    shader.setInt("uQuantizedVertex", m_vertexFormat == VertexFormat::Quantized ? 1 : 0);
 
+    const MeshLod& range = getLod(lod);
     glBindVertexArray(m_VAO);
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_indices.size()), GL_UNSIGNED_INT, 0);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(range.indexCount), m_indexType,
+                   reinterpret_cast<const void*>(static_cast<uintptr_t>(range.indexOffset) * m_indexSize));
     glBindVertexArray(0);
 
     if (m_material) {
@@ -77,23 +244,75 @@ void Mesh::draw(const Render::Shader& shader) const {
     }
 }
 
+void Mesh::drawDepthOnly(const Render::Shader& shader, size_t lod) const {
+    if (m_VAO == 0) {
+        return;
+    }
+    setPositionDecode(shader);
+    const MeshLod& range = getLod(lod);
+    glBindVertexArray(m_positionVAO);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(range.indexCount), m_indexType,
+                   reinterpret_cast<const void*>(static_cast<uintptr_t>(range.indexOffset) * m_indexSize));
+    glBindVertexArray(0);
+}
+
+void Mesh::drawRanges(const Render::Shader& shader, const IndexRange* ranges, size_t rangeCount, bool depthOnly) const {
+    if (m_VAO == 0 || rangeCount == 0) {
+        return;
+    }
+    if (!depthOnly && m_material) {
+        m_material->activate(shader);
+    }
+    setPositionDecode(shader);
+    if (!depthOnly) {
+        shader.setInt("uQuantizedVertex", m_vertexFormat == VertexFormat::Quantized ? 1 : 0);
+    }
+
+    // Só a thread de renderização desenha; os vetores são reaproveitados entre chamadas
+    thread_local std::vector<GLsizei> counts;
+    thread_local std::vector<const void*> offsets;
+    counts.resize(rangeCount);
+    offsets.resize(rangeCount);
+    for (size_t i = 0; i < rangeCount; ++i) {
+        counts[i] = static_cast<GLsizei>(ranges[i].count);
+        offsets[i] = reinterpret_cast<const void*>(static_cast<uintptr_t>(ranges[i].first) * m_indexSize);
+    }
+
+    glBindVertexArray(depthOnly ? m_positionVAO : m_VAO);
+    glMultiDrawElements(GL_TRIANGLES, counts.data(), m_indexType, offsets.data(), static_cast<GLsizei>(rangeCount));
+    glBindVertexArray(0);
+
+    if (!depthOnly && m_material) {
+        m_material->deactivate();
+    }
+}
+
 // --- Model Class ---
 Model::Model() = default;
 Model::~Model() = default;
 
 void Model::addMesh(std::unique_ptr<Mesh> mesh) {
     if (mesh) {
+        const MeshBounds& meshBounds = mesh->getBounds();
+        if (m_meshes.empty()) {
+            m_bounds = meshBounds;
+        } else {
+            m_bounds.min = glm::min(m_bounds.min, meshBounds.min);
+            m_bounds.max = glm::max(m_bounds.max, meshBounds.max);
+            m_bounds.center = (m_bounds.min + m_bounds.max) * 0.5f;
+            m_bounds.radius = glm::length(m_bounds.max - m_bounds.center);
+        }
         m_meshes.push_back(std::move(mesh));
-        Engine::Log::Trace("Model: Mesh added.");
+        ENGINE_LOG_TRACE("Model: Mesh added.");
     } else {
         Engine::Log::Warn("Model: Attempting to add null mesh.");
     }
 }
 
-void Model::draw(const Render::Shader& shader) const { 
+void Model::draw(const Render::Shader& shader, size_t lod) const { 
     for (const auto& mesh : m_meshes) {
         if (mesh) {
-            mesh->draw(shader); // Passa o shader para Mesh::draw
+            mesh->draw(shader, lod); // Passa o shader para Mesh::draw
         }
     }
 }
@@ -4,11 +4,17 @@
 #include <vector>
 #include <string>
 #include <memory> // Para std::unique_ptr
+#include <algorithm> // Para std::min
+#include <cstdint>
 #include <glad/gl.h> // Para GLuint
 
 #include <glm/glm.hpp>
 
 #include "./../../engine/render/material.h" 
+#include "./../../engine/core/config.h"
+#include "./../../engine/memory/pool_allocator.h"
+#include "vertex_format.h"
+#include "meshlet.h"
 
 // Forward declaration para Shader (ainda necessário para Mesh::draw e Model::draw)
 namespace Engine {
@@ -25,21 +31,95 @@ struct Vertex {
     glm::vec3 Position;
     glm::vec3 Normal;
     glm::vec2 TexCoords;
-    glm::vec3 Tangent; 
+    glm::vec4 Tangent; // xyz = tangente (MikkTSpace), w = sinal da bitangente (+1 ou -1)
     // glm::vec3 Bitangent; 
 };
+static_assert(sizeof(Vertex) == 48, "Atualizar os tamanhos citados em vertex_format.h, config.h e na documentação");
+
+// Limites da malha em espaço local (usados para seleção de LOD e culling)
+struct MeshBounds {
+    glm::vec3 min = glm::vec3(0.0f);
+    glm::vec3 max = glm::vec3(0.0f);
+    glm::vec3 center = glm::vec3(0.0f); // Centro da esfera envolvente
+    float radius = 0.0f;                 // Raio da esfera envolvente
+};
+
+// Índices de um nível de detalhe gerado pelo MeshCooker (usa os mesmos vértices da LOD 0)
+struct MeshLodData {
+    std::vector<GLuint> indices;
+    float error = 0.0f; // Erro geométrico relativo ao tamanho da malha
+};
+
+// Faixa de um nível de detalhe dentro do index buffer único da mesh
+struct MeshLod {
+    GLuint indexOffset = 0; // Em índices (não em bytes)
+    GLuint indexCount = 0;
+    float error = 0.0f;
+};
+
+// Onde os dados de geometria de uma Mesh ficam depois da criação
+enum class MeshResidency {
+    GpuOnly,   // Só os buffers GL; as cópias em CPU são liberadas após o upload (guarda contagens e limites)
+    CpuAndGpu, // Mantém vértices e índices em CPU (colisão, picking)
+    CpuOnly    // Nenhum recurso GL (servidor headless); draw não faz nada
+};
 
-// Classe para representar uma única malha (Mesh)
-class Mesh {
+inline const char* toString(MeshResidency residency) {
+    switch (residency) {
+        case MeshResidency::CpuAndGpu: return "cpu+gpu";
+        case MeshResidency::CpuOnly: return "cpu";
+        default: return "gpu";
+    }
+}
+
+inline MeshResidency defaultMeshResidency() {
+    return Engine::MESH_KEEP_CPU_COPY ? MeshResidency::CpuAndGpu : MeshResidency::GpuOnly;
+}
+
+// Classe para representar uma única malha (Mesh). Alocada no pool de Mesh (Memory::Pooled).
+class Mesh : public Memory::Pooled<Mesh, Memory::MemoryTag::Asset> {
 public:
     // Construtor: usa rvalue references (&&) para mover dados eficientemente
-    Mesh(std::vector<Vertex>&& vertices, std::vector<GLuint>&& indices, std::unique_ptr<Render::Material> material);
+    // 'lods' são os níveis 1..N (a LOD 0 é sempre 'indices'); todos ficam no mesmo EBO.
+    // 'format' escolhe o layout do vertex buffer na GPU (a cópia em CPU, se mantida, continua em Vertex).
+    // 'residency' decide se as cópias em CPU sobrevivem ao upload (ou se há upload).
+    Mesh(std::vector<Vertex>&& vertices, std::vector<GLuint>&& indices, std::unique_ptr<Render::Material> material,
+         std::vector<MeshLodData>&& lods = {}, VertexFormat format = defaultVertexFormat(),
+         MeshResidency residency = defaultMeshResidency());
     ~Mesh();
 
-    void draw(const Render::Shader& shader) const; 
-
-    size_t getVertexCount() const { return m_vertices.size(); }
-    size_t getIndexCount() const { return m_indices.size(); }
+    void draw(const Render::Shader& shader, size_t lod = 0) const; 
+    // Desenha só as faixas dadas do index buffer (meshlets visíveis), com um glMultiDrawElements
+    void drawRanges(const Render::Shader& shader, const IndexRange* ranges, size_t rangeCount, bool depthOnly) const;
+    // Só geometria, sem ativar o material (passes de profundidade/sombra); usa o stream só de posições.
+    // O shader recebe só os uniforms de decodificação da posição.
+    void drawDepthOnly(const Render::Shader& shader, size_t lod = 0) const;
+
+    size_t getVertexCount() const { return m_vertexCount; }
+    size_t getIndexCount() const { return m_indexCount; }
+    GLenum getIndexType() const { return m_indexType; }
+
+    // Dados em CPU: vazios no modo GpuOnly
+    MeshResidency getResidency() const { return m_residency; }
+    bool hasCpuData() const { return m_residency != MeshResidency::GpuOnly; }
+    const std::vector<Vertex>& getVertices() const { return m_vertices; }
+    const std::vector<GLuint>& getIndices() const { return m_indices; }
+
+    // LOD 0 é a malha original; LODs além do fim da cadeia usam o último nível disponível.
+    size_t getLodCount() const { return m_lods.size(); }
+    const MeshLod& getLod(size_t lod) const { return m_lods[std::min(lod, m_lods.size() - 1)]; }
+    size_t getTriangleCount(size_t lod = 0) const { return getLod(lod).indexCount / 3; }
+    const MeshBounds& getBounds() const { return m_bounds; }
+    VertexFormat getVertexFormat() const { return m_vertexFormat; }
+    // Bytes dos vertex buffers na GPU (intercalado + stream de posições) e do index buffer
+    size_t getGpuVertexBytes() const { return m_gpuVertexBytes; }
+    size_t getGpuIndexBytes() const { return m_gpuIndexBytes; }
+
+    // Meshlets da LOD 0 (vazio para malhas pequenas); usados no culling fino por meshlet
+    void setMeshlets(std::vector<Meshlet>&& meshlets) { m_meshlets = std::move(meshlets); }
+    const std::vector<Meshlet>& getMeshlets() const { return m_meshlets; }
+    // Chave para agrupar desenhos da mesma mesh (mesmo VAO e material) na ordenação de pacotes
+    uint64_t getSortId() const { return m_VAO; }
 
     // **** NOVO: Getter para o material da mesh ****
     const Render::Material* getMaterial() const { return m_material.get(); }
@@ -50,24 +130,47 @@ private:
     std::vector<GLuint> m_indices;
     std::unique_ptr<Render::Material> m_material; // PBR material of the mesh
 
-    GLuint m_VAO, m_VBO, m_EBO; 
-
-    void setupMesh(); 
+    std::vector<MeshLod> m_lods; // m_lods[0] cobre m_indices; demais níveis vêm depois no EBO
+    std::vector<Meshlet> m_meshlets;
+    MeshBounds m_bounds;
+    VertexFormat m_vertexFormat;
+    MeshResidency m_residency;
+    size_t m_vertexCount = 0;
+    size_t m_indexCount = 0;
+    size_t m_gpuVertexBytes = 0;
+    size_t m_gpuIndexBytes = 0;
+    size_t m_cpuBytes = 0;
+    size_t m_releasedBytes = 0;
+
+    GLuint m_VAO = 0, m_VBO = 0, m_EBO = 0; 
+    GLenum m_indexType = GL_UNSIGNED_INT; // GL_UNSIGNED_SHORT se a mesh tem até 65536 vértices
+    size_t m_indexSize = sizeof(GLuint);
+    GLuint m_positionVAO = 0, m_positionVBO = 0; // Posições compactas (vec3 ou unorm16 x 4) + mesmo EBO
+
+    void setupMesh(const std::vector<MeshLodData>& lods); 
+    void releaseCpuData();
+    // Layouts do VBO intercalado e do stream de posições para cada formato
+    void setupFloatAttributes();
+    void setupQuantizedAttributes();
+    void setPositionDecode(const Render::Shader& shader) const;
+    void computeBounds();
 };
 
-// Classe para representar um Modelo (que pode conter múltiplas meshes)
-class Model {
+// Classe para representar um Modelo (que pode conter múltiplas meshes). Alocado no pool de Model.
+class Model : public Memory::Pooled<Model, Memory::MemoryTag::Asset> {
 public:
     Model(); 
     ~Model();
 
     void addMesh(std::unique_ptr<Mesh> mesh); 
-    void draw(const Render::Shader& shader) const; // Desenha todas as meshes do modelo
+    void draw(const Render::Shader& shader, size_t lod = 0) const; // Desenha todas as meshes do modelo
 
     const std::vector<std::unique_ptr<Mesh>>& getMeshes() const { return m_meshes; }
+    const MeshBounds& getBounds() const { return m_bounds; } // União dos limites das meshes
 
 private:
     std::vector<std::unique_ptr<Mesh>> m_meshes; 
+    MeshBounds m_bounds;
 };
 
 } // namespace Asset
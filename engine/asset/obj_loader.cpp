@@ -1,6 +1,10 @@
 // engine/asset/obj_loader.cpp
 #include "obj_loader.h"
+#include "mesh_cooker.h"                // Geração de LODs em tempo de carga
+#include "tangent_generator.h"          // OBJ não traz tangentes
 #include "./../core/log.h"         // Para logging
+#include "./../core/profiler.h"
+#include "./../memory/allocation_counters.h"
 #include "./../core/path_utils.h"   // Para Engine::loadFileFromEngineAssets
 #include <fstream>                  // Para leitura de arquivo
 #include <sstream>                  // Para stringstream
@@ -39,6 +43,8 @@ namespace Engine {
 namespace Asset {
 
 std::unique_ptr<Model> ObjLoader::loadModel(const std::string& filePath) {
+    ENGINE_PROFILE_SCOPE("ObjLoader::loadModel");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::Asset);
     Engine::Log::Info(std::format("ObjLoader: Tentando carregar modelo OBJ de '{}'", filePath));
 
     // Carrega o conteúdo do arquivo OBJ como uma string
@@ -148,7 +154,10 @@ std::unique_ptr<Model> ObjLoader::loadModel(const std::string& filePath) {
     // Creates and returns the Model using the loaded data
     auto model = std::make_unique<Model>();
     // std::make_unique<Render::Material>() cria um material padrão (nullptr por enquanto)
-    auto mesh = std::make_unique<Mesh>(std::move(finalVertices), std::move(finalIndices), std::make_unique<Render::Material>());
+    TangentGenerator::generate(finalVertices, finalIndices);
+    CookedMesh cooked = MeshCooker::cook(finalVertices, finalIndices);
+    auto mesh = std::make_unique<Mesh>(std::move(finalVertices), std::move(finalIndices), std::make_unique<Render::Material>(), std::move(cooked.lods));
+    mesh->setMeshlets(std::move(cooked.meshlets));
     model->addMesh(std::move(mesh)); // Adiciona a mesh ao modelo
 
     return model; // Retorna o modelo com a mesh
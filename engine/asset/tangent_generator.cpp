@@ -0,0 +1,153 @@
+// engine/asset/tangent_generator.cpp
+#include "tangent_generator.h"
+#include "./../core/log.h"
+#include "./../core/worker_pool.h"
+#include "./../memory/scratch_arena.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+
+namespace Engine {
+namespace Asset {
+
+namespace {
+
+constexpr size_t kTrianglesPerJob = 4096;
+constexpr size_t kVerticesPerJob = 4096;
+
+// Direções do triângulo no espaço do objeto ao longo de +U (s) e +V (t), já normalizadas e com a
+// orientação aplicada (como em InitTriInfo do MikkTSpace)
+struct TriangleBasis {
+    glm::vec3 s = glm::vec3(0.0f);
+    glm::vec3 t = glm::vec3(0.0f);
+    bool orientationPreserving = true;
+};
+
+glm::vec3 safeNormalize(const glm::vec3& v) {
+    float length = glm::length(v);
+    return length > 1e-20f ? v / length : glm::vec3(0.0f);
+}
+
+// Qualquer direção perpendicular à normal (UV degenerada ou ausente)
+glm::vec3 anyPerpendicular(const glm::vec3& n) {
+    glm::vec3 axis = std::abs(n.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+    return safeNormalize(axis - n * glm::dot(n, axis));
+}
+
+} // namespace
+
+void TangentGenerator::generate(std::vector<Vertex>& vertices, const std::vector<GLuint>& indices) {
+    const size_t triangleCount = indices.size() / 3;
+    const size_t vertexCount = vertices.size();
+    if (triangleCount == 0 || vertexCount == 0) {
+        return;
+    }
+    for (GLuint index : indices) {
+        if (index >= vertexCount) {
+            Engine::Log::Warn("TangentGenerator: Índice fora do intervalo de vértices; tangentes não geradas.");
+            return;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    WorkerPool& pool = WorkerPool::Get();
+
+    // Temporários na arena da thread; os jobs só leem e escrevem elementos
+    Memory::ScratchScope scratch;
+
+    // 1. Base de cada triângulo (independente por triângulo)
+    Memory::ScratchVector<TriangleBasis> bases(triangleCount);
+    pool.parallelFor(triangleCount, kTrianglesPerJob, [&](size_t, size_t begin, size_t end)
+    {
+        for (size_t triangle = begin; triangle < end; ++triangle) {
+            const Vertex& v0 = vertices[indices[triangle * 3 + 0]];
+            const Vertex& v1 = vertices[indices[triangle * 3 + 1]];
+            const Vertex& v2 = vertices[indices[triangle * 3 + 2]];
+            const glm::vec3 d21 = v1.Position - v0.Position;
+            const glm::vec3 d31 = v2.Position - v0.Position;
+            const glm::vec2 t21 = v1.TexCoords - v0.TexCoords;
+            const glm::vec2 t31 = v2.TexCoords - v0.TexCoords;
+
+            const float signedAreaUV = t21.x * t31.y - t21.y * t31.x;
+            TriangleBasis& basis = bases[triangle];
+            basis.orientationPreserving = signedAreaUV > 0.0f;
+            if (std::abs(signedAreaUV) > 1e-20f) {
+                const float orientation = basis.orientationPreserving ? 1.0f : -1.0f;
+                basis.s = orientation * safeNormalize(t31.y * d21 - t21.y * d31);
+                basis.t = orientation * safeNormalize(-t31.x * d21 + t21.x * d31);
+            }
+        }
+    });
+
+    // 2. Adjacência vértice -> cantos (triângulo * 3 + canto) em ordem crescente de triângulo
+    Memory::ScratchVector<uint32_t> cornerOffsets(vertexCount + 1, 0);
+    for (GLuint index : indices) {
+        cornerOffsets[index + 1]++;
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        cornerOffsets[v + 1] += cornerOffsets[v];
+    }
+    Memory::ScratchVector<uint32_t> corners(triangleCount * 3);
+    {
+        Memory::ScratchVector<uint32_t> cursor(cornerOffsets.begin(), cornerOffsets.end() - 1);
+        for (size_t corner = 0; corner < triangleCount * 3; ++corner) {
+            corners[cursor[indices[corner]]++] = static_cast<uint32_t>(corner);
+        }
+    }
+
+    // 3. Soma por vértice, ponderada pelo ângulo do canto no plano da normal
+    pool.parallelFor(vertexCount, kVerticesPerJob, [&](size_t, size_t begin, size_t end)
+    {
+        for (size_t v = begin; v < end; ++v) {
+            if (cornerOffsets[v] == cornerOffsets[v + 1]) {
+                continue; // Vértice não referenciado
+            }
+            Vertex& vertex = vertices[v];
+            const glm::vec3 n = safeNormalize(vertex.Normal);
+
+            glm::vec3 tangentSum(0.0f);
+            glm::vec3 bitangentSum(0.0f);
+            float orientationSum = 0.0f;
+            for (uint32_t c = cornerOffsets[v]; c < cornerOffsets[v + 1]; ++c) {
+                const uint32_t corner = corners[c];
+                const uint32_t triangle = corner / 3;
+                const uint32_t local = corner % 3;
+                const glm::vec3 p = vertex.Position;
+                const glm::vec3 pNext = vertices[indices[triangle * 3 + (local + 1) % 3]].Position;
+                const glm::vec3 pPrev = vertices[indices[triangle * 3 + (local + 2) % 3]].Position;
+
+                glm::vec3 edge1 = pNext - p;
+                glm::vec3 edge2 = pPrev - p;
+                edge1 = safeNormalize(edge1 - n * glm::dot(n, edge1));
+                edge2 = safeNormalize(edge2 - n * glm::dot(n, edge2));
+                const float angle = std::acos(std::clamp(glm::dot(edge1, edge2), -1.0f, 1.0f));
+
+                const TriangleBasis& basis = bases[triangle];
+                tangentSum += angle * safeNormalize(basis.s - n * glm::dot(n, basis.s));
+                bitangentSum += angle * safeNormalize(basis.t - n * glm::dot(n, basis.t));
+                orientationSum += basis.orientationPreserving ? angle : -angle;
+            }
+
+            glm::vec3 tangent = safeNormalize(tangentSum);
+            if (tangent == glm::vec3(0.0f)) {
+                tangent = anyPerpendicular(n);
+            }
+            // Sinal: orientação predominante da UV; com bitangente válida, a direção dela decide
+            float sign = orientationSum >= 0.0f ? 1.0f : -1.0f;
+            if (glm::length(bitangentSum) > 1e-20f) {
+                sign = glm::dot(glm::cross(n, tangent), bitangentSum) < 0.0f ? -1.0f : 1.0f;
+            }
+            vertex.Tangent = glm::vec4(tangent, sign);
+        }
+    });
+
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const double trianglesPerSecond = elapsedMs > 0.0 ? static_cast<double>(triangleCount) / (elapsedMs / 1000.0) : 0.0;
+    Engine::Log::Info(std::format("TangentGenerator: {} triângulos em {:.2f} ms ({:.1f} M triângulos/s, {} threads).",
+                                  triangleCount, elapsedMs, trianglesPerSecond / 1.0e6, pool.getThreadCount()));
+}
+
+} // namespace Asset
+} // namespace Engine
@@ -0,0 +1,28 @@
+// engine/asset/tangent_generator.h
+#pragma once
+
+#include <vector>
+#include <glad/gl.h> // Para GLuint
+
+#include "model.h" // Para Engine::Asset::Vertex
+
+namespace Engine {
+namespace Asset {
+
+// Gera tangentes no espaço de tangente do MikkTSpace (o mesmo que os bakers de normal map usam):
+// tangente/bitangente de cada triângulo pelas derivadas de UV, projetadas no plano da normal de cada
+// vértice e somadas com peso pelo ângulo do canto; w recebe o sinal da bitangente (UV espelhada = -1).
+// Diferente da biblioteca original, não divide vértices: assume que os loaders já separam costuras de UV.
+// Roda em paralelo no WorkerPool com resultado determinístico (a soma por vértice segue a ordem dos
+// triângulos, independente do número de threads).
+class TangentGenerator {
+public:
+    // Sobrescreve Vertex::Tangent de todos os vértices referenciados por 'indices'
+    static void generate(std::vector<Vertex>& vertices, const std::vector<GLuint>& indices);
+
+private:
+    TangentGenerator() = delete;
+};
+
+} // namespace Asset
+} // namespace Engine
@@ -0,0 +1,38 @@
+// engine/asset/vertex_format.h
+#pragma once
+
+#include <cstdint>
+
+#include "./../../engine/core/config.h"
+
+namespace Engine {
+namespace Asset {
+
+// Layout do vertex buffer de uma Mesh (escolhido por mesh; basic.vert decodifica os dois)
+enum class VertexFormat {
+    Float,    // Vertex intercalado em floats: 48 bytes
+    Quantized // PackedVertex: 20 bytes
+};
+
+inline const char* toString(VertexFormat format) {
+    return format == VertexFormat::Quantized ? "quantized" : "float";
+}
+
+inline VertexFormat defaultVertexFormat() {
+    return Engine::VERTEX_QUANTIZATION_ENABLED ? VertexFormat::Quantized : VertexFormat::Float;
+}
+
+// Vértice compacto (20 bytes):
+//   position: unorm16 relativo à AABB da mesh; w guarda o sinal da bitangente (0 = -1, 65535 = +1)
+//   normal / tangent: octaédrico em snorm16 x 2
+//   texCoords: half float x 2
+struct PackedVertex {
+    uint16_t position[4];
+    int16_t normal[2];
+    int16_t tangent[2];
+    uint16_t texCoords[2];
+};
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex precisa bater com o layout do VAO");
+
+} // namespace Asset
+} // namespace Engine
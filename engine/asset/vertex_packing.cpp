@@ -0,0 +1,133 @@
+// engine/asset/vertex_packing.cpp
+#include "vertex_packing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/packing.hpp>
+
+namespace Engine {
+namespace Asset {
+
+namespace {
+
+int16_t packSnorm16(float value) {
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+float unpackSnorm16(int16_t value) {
+    return std::max(static_cast<float>(value) / 32767.0f, -1.0f); // Mesma regra do GL para snorm
+}
+
+uint16_t packUnorm16(float value) {
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+}
+
+// Mesmo mapeamento de engine/shaders/common/octahedral.glsl
+glm::vec2 encodeOctahedral(glm::vec3 n) {
+    float sum = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    if (sum <= 0.0f) {
+        return glm::vec2(0.0f); // Direção nula (tangente ausente): decodifica como +Z
+    }
+    n /= sum;
+    if (n.z >= 0.0f) {
+        return glm::vec2(n.x, n.y);
+    }
+    return glm::vec2((1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+                     (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f));
+}
+
+glm::vec3 decodeOctahedral(glm::vec2 f) {
+    glm::vec3 n(f.x, f.y, 1.0f - std::abs(f.x) - std::abs(f.y));
+    float t = std::clamp(-n.z, 0.0f, 1.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return glm::normalize(n);
+}
+
+// Ângulo entre direções por atan2 (acos perde precisão justamente perto de zero)
+float angleDegrees(const glm::vec3& a, const glm::vec3& b) {
+    if (glm::length(a) <= 0.0f || glm::length(b) <= 0.0f) {
+        return 0.0f;
+    }
+    return glm::degrees(std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b)));
+}
+
+} // namespace
+
+PackedVertex VertexPacking::pack(const Vertex& vertex, const MeshBounds& bounds) {
+    PackedVertex packed{};
+
+    const glm::vec3 offset = positionOffset(bounds);
+    const glm::vec3 scale = positionScale(bounds);
+    for (int axis = 0; axis < 3; ++axis) {
+        float normalized = scale[axis] > 0.0f ? (vertex.Position[axis] - offset[axis]) / scale[axis] : 0.0f;
+        packed.position[axis] = packUnorm16(normalized);
+    }
+    packed.position[3] = vertex.Tangent.w < 0.0f ? 0 : 65535; // Sinal da bitangente
+
+    glm::vec2 normal = encodeOctahedral(vertex.Normal);
+    glm::vec2 tangent = encodeOctahedral(glm::vec3(vertex.Tangent));
+    packed.normal[0] = packSnorm16(normal.x);
+    packed.normal[1] = packSnorm16(normal.y);
+    packed.tangent[0] = packSnorm16(tangent.x);
+    packed.tangent[1] = packSnorm16(tangent.y);
+
+    packed.texCoords[0] = glm::packHalf1x16(vertex.TexCoords.x);
+    packed.texCoords[1] = glm::packHalf1x16(vertex.TexCoords.y);
+    return packed;
+}
+
+Vertex VertexPacking::unpack(const PackedVertex& packed, const MeshBounds& bounds) {
+    Vertex vertex{};
+    const glm::vec3 offset = positionOffset(bounds);
+    const glm::vec3 scale = positionScale(bounds);
+    for (int axis = 0; axis < 3; ++axis) {
+        vertex.Position[axis] = offset[axis] + scale[axis] * (static_cast<float>(packed.position[axis]) / 65535.0f);
+    }
+    vertex.Normal = decodeOctahedral(glm::vec2(unpackSnorm16(packed.normal[0]), unpackSnorm16(packed.normal[1])));
+    vertex.Tangent = glm::vec4(decodeOctahedral(glm::vec2(unpackSnorm16(packed.tangent[0]), unpackSnorm16(packed.tangent[1]))),
+                               packed.position[3] == 0 ? -1.0f : 1.0f);
+    vertex.TexCoords = glm::vec2(glm::unpackHalf1x16(packed.texCoords[0]), glm::unpackHalf1x16(packed.texCoords[1]));
+    return vertex;
+}
+
+std::vector<PackedVertex> VertexPacking::packAll(const std::vector<Vertex>& vertices, const MeshBounds& bounds) {
+    std::vector<PackedVertex> packed;
+    packed.reserve(vertices.size());
+    for (const Vertex& vertex : vertices) {
+        packed.push_back(pack(vertex, bounds));
+    }
+    return packed;
+}
+
+VertexQuantizationError VertexPacking::measureError(const std::vector<Vertex>& vertices, const std::vector<PackedVertex>& packed,
+                                                    const MeshBounds& bounds) {
+    VertexQuantizationError error;
+    const size_t count = std::min(vertices.size(), packed.size());
+    for (size_t i = 0; i < count; ++i) {
+        const Vertex& original = vertices[i];
+        const Vertex decoded = unpack(packed[i], bounds);
+        error.position = std::max(error.position, glm::length(decoded.Position - original.Position));
+        error.normalDegrees = std::max(error.normalDegrees, angleDegrees(original.Normal, decoded.Normal));
+        error.tangentDegrees = std::max(error.tangentDegrees, angleDegrees(glm::vec3(original.Tangent), glm::vec3(decoded.Tangent)));
+        glm::vec2 uvDelta = glm::abs(decoded.TexCoords - original.TexCoords);
+        error.texCoord = std::max(error.texCoord, std::max(uvDelta.x, uvDelta.y));
+    }
+    return error;
+}
+
+bool VertexPacking::withinBounds(const VertexQuantizationError& error, const std::vector<Vertex>& vertices, const MeshBounds& bounds) {
+    float maxTexCoord = 0.0f;
+    for (const Vertex& vertex : vertices) {
+        maxTexCoord = std::max({maxTexCoord, std::abs(vertex.TexCoords.x), std::abs(vertex.TexCoords.y)});
+    }
+
+    const float positionLimit = 0.5f * glm::length(positionScale(bounds)) / 65535.0f * 1.01f + 1e-6f;
+    const float directionLimit = 0.01f;
+    const float texCoordLimit = std::max(maxTexCoord, 1.0f) * std::ldexp(1.0f, -11);
+    return error.position <= positionLimit && error.normalDegrees <= directionLimit &&
+           error.tangentDegrees <= directionLimit && error.texCoord <= texCoordLimit;
+}
+
+} // namespace Asset
+} // namespace Engine
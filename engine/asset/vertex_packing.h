@@ -0,0 +1,45 @@
+// engine/asset/vertex_packing.h
+#pragma once
+
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "model.h"         // Para Vertex e MeshBounds
+#include "vertex_format.h" // Para PackedVertex
+
+namespace Engine {
+namespace Asset {
+
+// Maior erro de cada atributo depois de codificar e decodificar uma malha
+struct VertexQuantizationError {
+    float position = 0.0f;       // Distância em unidades do modelo
+    float normalDegrees = 0.0f;
+    float tangentDegrees = 0.0f;
+    float texCoord = 0.0f;       // Diferença absoluta em UV
+};
+
+// Codificação do formato quantizado. A decodificação de referência é a mesma feita em
+// engine/shaders/common/vertex_decode.glsl.
+class VertexPacking {
+public:
+    // Posição decodificada = offset + scale * unorm16
+    static glm::vec3 positionOffset(const MeshBounds& bounds) { return bounds.min; }
+    static glm::vec3 positionScale(const MeshBounds& bounds) { return bounds.max - bounds.min; }
+
+    static PackedVertex pack(const Vertex& vertex, const MeshBounds& bounds);
+    static Vertex unpack(const PackedVertex& packed, const MeshBounds& bounds);
+    static std::vector<PackedVertex> packAll(const std::vector<Vertex>& vertices, const MeshBounds& bounds);
+
+    // Compara a malha original com a versão decodificada
+    static VertexQuantizationError measureError(const std::vector<Vertex>& vertices, const std::vector<PackedVertex>& packed,
+                                                const MeshBounds& bounds);
+    // Limites aceitos: meio passo de quantização por eixo na posição, ~0.01 grau nas direções
+    // e a precisão de um half float (2^-11 relativo) nas UVs
+    static bool withinBounds(const VertexQuantizationError& error, const std::vector<Vertex>& vertices, const MeshBounds& bounds);
+
+private:
+    VertexPacking() = delete;
+};
+
+} // namespace Asset
+} // namespace Engine
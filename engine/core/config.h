@@ -13,6 +13,141 @@ constexpr int DEFAULT_WINDOW_HEIGHT = 720;
 constexpr bool DEFAULT_WINDOW_FULLSCREEN = false; // Defina para true para iniciar em tela cheia
 constexpr bool DEFAULT_WINDOW_RESIZABLE = false;  // Bloqueia redimensionamento manual
 
+// **** Projeção da câmera ****
+constexpr float CAMERA_NEAR_PLANE = 0.1f;
+constexpr float CAMERA_FAR_PLANE = 600.0f;         // Cobre a última LOD do terreno (512 m) e a vegetação; seleção e desenho param aqui
+
+// **** LOD (nível de detalhe) ****
+// Geração (MeshCooker): cada nível mantém LOD_REDUCTION_PER_LEVEL dos triângulos do anterior.
+constexpr int LOD_MAX_LEVELS = 4;                  // Níveis gerados além da malha original
+constexpr float LOD_REDUCTION_PER_LEVEL = 0.4f;    // 0.4^4 ~= 2.5% dos triângulos no último nível
+constexpr int LOD_MIN_TRIANGLES = 512;             // Malhas menores que isso não recebem LODs
+constexpr float LOD_MAX_ERROR = 0.05f;             // Erro máximo do último nível (relativo ao tamanho da malha)
+
+// Seleção (Renderer): tamanho projetado = raio da esfera envolvente / meia-altura da tela.
+// LOD_SCREEN_SIZES[i] é o tamanho abaixo do qual a LOD i+1 passa a ser usada.
+constexpr float LOD_SCREEN_SIZES[] = {0.8f, 0.4f, 0.2f, 0.1f};
+constexpr float LOD_HYSTERESIS = 0.15f;            // Margem relativa para evitar troca de LOD a cada frame
+constexpr bool LOD_DITHER_CROSSFADE = true;        // Transição com dither entre LODs (senão troca seca)
+constexpr float LOD_CROSSFADE_SECONDS = 0.25f;     // Duração do cross-fade
+
+// **** Formato de vértice ****
+constexpr bool VERTEX_QUANTIZATION_ENABLED = true;   // Meshes novas usam PackedVertex (20 bytes) em vez de Vertex (48 bytes)
+constexpr bool MESH_OPTIMIZE_VERTEX_CACHE = true;     // Reordena triângulos (Tipsify) e vértices ao carregar; loga o ACMR antes/depois
+constexpr int VERTEX_CACHE_SIZE = 16;                  // Entradas do cache de vértices simulado (otimização e ACMR)
+constexpr int MESHLET_MAX_VERTICES = 64;               // Limites de cada meshlet gerado pelo MeshCooker
+constexpr int MESHLET_MAX_TRIANGLES = 124;
+constexpr int MESHLET_MIN_MESH_TRIANGLES = 4096;       // Malhas menores não são divididas em meshlets
+constexpr bool MESHLET_CULLING_ENABLED = true;         // Culling por meshlet (frustum + cone de normais) na LOD 0
+constexpr bool MESH_16BIT_INDICES = true;              // Index buffer em GL_UNSIGNED_SHORT quando a mesh tem até 65536 vértices
+constexpr bool MESH_KEEP_CPU_COPY = false;             // Residência padrão: false = só GPU (libera vértices/índices após o upload)
+
+// **** Thread de renderização ****
+// A thread principal grava CommandLists; uma thread dedicada (dona do contexto GL) as reproduz.
+constexpr bool RENDER_THREAD_ENABLED = true;       // false: reproduz na thread principal (depuração / captura GL)
+constexpr int RENDER_MAX_FRAME_LATENCY = 1;        // Frames que a simulação pode estar à frente da submissão GL (0 = serial)
+
+// **** Simulação em passo fixo ****
+constexpr int SIMULATION_TICK_RATE = 60;           // Passos por segundo: Scene::update sempre recebe 1 / taxa
+constexpr int SIMULATION_MAX_STEPS_PER_FRAME = 5;  // Acima disso o atraso do frame é descartado (sem espiral de passos)
+constexpr bool SIMULATION_INTERPOLATION = true;    // Desenha entre os dois últimos estados simulados (false = último estado)
+
+// **** Gravação paralela de comandos ****
+constexpr int WORKER_THREAD_COUNT = 0;             // Workers do Jobs::JobSystem (0 = núcleos - 2, mínimo 1)
+constexpr int RENDER_RECORD_OBJECTS_PER_JOB = 256; // Objetos por job de culling/LOD/gravação
+
+// **** Entidades e componentes (ECS) ****
+constexpr bool ECS_SCHEDULER_DETERMINISTIC = false; // Sistemas em série, numa thread (replays); false = ondas em paralelo nos jobs
+
+// **** Iluminação clusterizada (forward+) ****
+constexpr int CLUSTER_GRID_X = 16;                 // Blocos horizontais de tela (múltiplo de 4)
+constexpr int CLUSTER_GRID_Y = 9;                  // Blocos verticais de tela
+constexpr int CLUSTER_GRID_Z = 24;                 // Fatias de profundidade (distribuição exponencial)
+constexpr int CLUSTER_LIGHT_BINDING = 0;           // Primeiro binding SSBO (luzes, froxels, índices); deve bater com basic.frag
+constexpr int LIGHT_STRESS_TEST_COUNT = 0;         // > 0: espalha N luzes aleatórias sobre o terreno
+
+// **** Caminho de renderização ****
+constexpr bool RENDER_DEFAULT_DEFERRED = false;    // Modo inicial (F9 alterna forward/deferred em tempo de execução)
+constexpr bool DEPTH_PREPASS_ENABLED = false;      // Pré-pass de profundidade inicial (F8 alterna em tempo de execução)
+constexpr bool RENDER_GPU_PROFILER_ENABLED = true; // Tempo de GPU por pass (queries GL_TIMESTAMP); no-op em contextos sem timer queries
+
+// **** Sombras do sol (cascatas) ****
+constexpr bool SHADOWS_ENABLED = true;
+constexpr int SHADOW_CASCADE_COUNT = 4;            // 1 a 4
+constexpr int SHADOW_MAP_SIZE = 2048;              // Resolução de cada camada
+constexpr float SHADOW_DISTANCE = 100.0f;          // Alcance das sombras a partir da câmera
+constexpr float SHADOW_CASCADE_SPLIT_LAMBDA = 0.75f; // 0 = divisão uniforme, 1 = logarítmica
+constexpr int SHADOW_CACHED_CASCADE_START = 2;     // Cascatas a partir desta só são re-renderizadas sob demanda
+constexpr float SHADOW_CACHE_MOVE_THRESHOLD = 0.1f; // Deslocamento (fração do raio) que invalida uma cascata em cache
+constexpr float SHADOW_CASTER_EXTENT = 50.0f;      // Distância extra na direção do sol para incluir projetores
+constexpr float SHADOW_SLOPE_BIAS = 2.0f;          // glPolygonOffset (fator)
+constexpr float SHADOW_CONSTANT_BIAS = 4.0f;       // glPolygonOffset (unidades)
+constexpr int SHADOW_MAP_TEXTURE_UNIT = 8;         // Unidades 0-5 são do material
+
+// **** Terreno (heightmap em tiles, LOD contínuo CDLOD) ****
+constexpr bool TERRAIN_ENABLED = true;             // false: volta ao mapa estático assets/models/map_test.glb
+constexpr const char* TERRAIN_HEIGHTMAP_PATH = ""; // PNG de 16 bits cobrindo o mundo todo; vazio = relevo procedural
+constexpr unsigned TERRAIN_SEED = 1337;            // Semente do relevo procedural
+constexpr int TERRAIN_TILES_X = 64;                // Tiles do mundo (centrado na origem); com streaming só os próximos ficam residentes
+constexpr int TERRAIN_TILES_Z = 64;
+constexpr float TERRAIN_TILE_SIZE = 128.0f;        // Metros por tile (potência de 2 vezes TERRAIN_LEAF_CHUNK_SIZE)
+constexpr int TERRAIN_TILE_RESOLUTION = 129;       // Amostras por lado de cada tile (bordas repetidas entre vizinhos)
+constexpr float TERRAIN_HEIGHT_SCALE = 40.0f;      // Altura máxima do relevo (metros)
+constexpr float TERRAIN_LEAF_CHUNK_SIZE = 8.0f;    // Lado do menor nó da quadtree (metros)
+constexpr int TERRAIN_CHUNK_GRID = 16;             // Quads por lado da malha de grade compartilhada (par)
+constexpr float TERRAIN_LEAF_LOD_RANGE = 32.0f;    // Alcance da LOD 0; cada LOD seguinte dobra o alcance
+constexpr float TERRAIN_MORPH_START_RATIO = 0.66f; // Fração do intervalo de cada LOD em que o morph começa
+constexpr float TERRAIN_TEXCOORD_SCALE = 0.25f;    // Repetições da UV do material por metro
+constexpr int TERRAIN_HEIGHTMAP_TEXTURE_UNIT = 9;  // Unidade do array de heightmaps (depois do shadow map)
+
+// **** Streaming do mundo (células = tiles do terreno) ****
+constexpr bool WORLD_STREAMING_ENABLED = true;           // false: carrega todos os tiles no início (use um mundo pequeno)
+constexpr float WORLD_STREAMING_LOAD_RADIUS = 640.0f;    // Células a até esta distância do jogador são pedidas (> alcance do terreno)
+constexpr float WORLD_STREAMING_UNLOAD_RADIUS = 800.0f;  // Histerese: células residentes só saem além desta distância
+constexpr float WORLD_STREAMING_PRELOAD_RADIUS = 128.0f; // Carregadas de forma síncrona antes do primeiro frame
+constexpr int WORLD_STREAMING_BUDGET_MB = 32;            // Memória máxima das células residentes (CPU + GPU)
+constexpr int WORLD_STREAMING_THREADS = 2;               // Threads de carregamento (fora do WorkerPool do frame)
+constexpr int WORLD_STREAMING_MAX_INTEGRATIONS_PER_FRAME = 4; // Células prontas integradas por frame (limita o custo na thread principal)
+constexpr float WORLD_STREAMING_VIEW_WEIGHT = 0.5f;      // 0..1: quanto a direção da câmera adianta células à frente
+constexpr const char* WORLD_CELL_CACHE_DIR = "cache/world"; // Pacotes cozidos das células (vazio = sempre gera, sem gravar)
+
+// **** Vegetação espalhada (instâncias sobre o terreno, geradas por célula) ****
+constexpr bool VEGETATION_ENABLED = true;
+constexpr const char* VEGETATION_DENSITY_MAP_PATH = ""; // PNG RGB (R grama, G arbustos, B pedras) esticado sobre o mundo; vazio = manchas procedurais
+constexpr unsigned VEGETATION_SEED = 4242;           // Semente do espalhamento (mesmas instâncias em toda execução)
+constexpr float VEGETATION_GRASS_DENSITY = 1.5f;     // Candidatos por m² onde o mapa de densidade vale 1
+constexpr float VEGETATION_BUSH_DENSITY = 0.02f;
+constexpr float VEGETATION_ROCK_DENSITY = 0.03f;
+constexpr float VEGETATION_GRASS_DISTANCE = 80.0f;   // Distância máxima de desenho de cada tipo (<= CAMERA_FAR_PLANE)
+constexpr float VEGETATION_BUSH_DISTANCE = 160.0f;
+constexpr float VEGETATION_ROCK_DISTANCE = 220.0f;
+constexpr float VEGETATION_LOD_DISTANCE_RATIO = 0.4f; // Fração da distância máxima onde entram a malha simplificada e a rarefação
+constexpr float VEGETATION_FAR_DENSITY = 0.25f;      // Fração das instâncias ainda desenhada na distância máxima
+constexpr float VEGETATION_PATCH_SIZE = 32.0f;       // Lado dos blocos de culling dentro de cada célula
+constexpr float VEGETATION_CELL_RADIUS = 256.0f;     // Células a até esta distância do jogador recebem vegetação (>= maior distância de desenho)
+constexpr int VEGETATION_MAX_CELLS = 32;             // Células com vegetação na GPU ao mesmo tempo
+constexpr int VEGETATION_MAX_INSTANCES_PER_CELL = 16384;
+constexpr int VEGETATION_THREADS = 1;                // Threads de geração (fora do WorkerPool do frame)
+constexpr bool VEGETATION_BENCHMARK = false;         // Mede o tempo de frame desenhando 0%, 25%, ..., 100% das instâncias
+constexpr int VEGETATION_BENCHMARK_FRAMES_PER_STEP = 300;
+
+// **** Profiler de CPU (zonas ENGINE_PROFILE_SCOPE; a opção de CMake ENGINE_PROFILER=OFF as remove da compilação) ****
+constexpr bool PROFILER_ENABLED = true;               // Grava zonas desde o início (Profiler::setEnabled muda em execução)
+constexpr int PROFILER_EVENTS_PER_THREAD = 16384;     // Anel de zonas por thread (24 bytes cada); as mais antigas são sobrescritas
+constexpr int PROFILER_CAPTURE_FRAMES = 120;          // Frames gravados por captura (tecla F7)
+constexpr int PROFILER_CAPTURE_AT_FRAME = 0;          // > 0: captura automática ao chegar nesse frame
+constexpr const char* PROFILER_TRACE_DIR = "profiles"; // trace_<frame>.json, para chrome://tracing ou ui.perfetto.dev
+
+// **** Orçamentos de memória por subsistema (Memory::MemoryTracker; CPU + GPU, 0 = sem orçamento) ****
+constexpr int MEMORY_BUDGET_ASSET_MB = 1024;         // Meshes (vetores e buffers) e imagens decodificadas
+constexpr int MEMORY_BUDGET_RENDER_MB = 512;         // Texturas, G-buffer, shadow maps
+constexpr int MEMORY_BUDGET_GAME_MB = 0;
+constexpr int MEMORY_BUDGET_WORLD_MB = 256;          // Terreno e vegetação na GPU (as células também respeitam WORLD_STREAMING_BUDGET_MB)
+
+// **** Log (o nível mínimo compilado vem da opção de CMake ENGINE_LOG_MIN_LEVEL) ****
+constexpr bool LOG_ASYNC = true;                     // Fila sem trava + thread de escrita (false: escreve na thread que loga)
+constexpr int LOG_QUEUE_CAPACITY = 8192;             // Mensagens na fila (arredondado para potência de 2); cheia, quem loga espera
+
 // Outras configurações globais do motor podem vir aqui no futuro.
 
 } // namespace Engine
\ No newline at end of file
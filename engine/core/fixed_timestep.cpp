@@ -0,0 +1,27 @@
+// engine/core/fixed_timestep.cpp
+#include "fixed_timestep.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+FixedTimestep::FixedTimestep(double stepSeconds, int maxStepsPerFrame)
+    : m_step(std::max(stepSeconds, 1e-4)), m_maxStepsPerFrame(std::max(maxStepsPerFrame, 1)) {
+}
+
+int FixedTimestep::advance(double frameSeconds) {
+    m_accumulator += std::max(frameSeconds, 0.0);
+
+    int steps = static_cast<int>(std::floor(m_accumulator / m_step));
+    if (steps > m_maxStepsPerFrame) {
+        // Descarta o atraso inteiro, mas mantém a fração do passo em andamento (a interpolação não salta)
+        m_droppedSteps += static_cast<uint64_t>(steps - m_maxStepsPerFrame);
+        steps = m_maxStepsPerFrame;
+    }
+    m_accumulator = std::fmod(m_accumulator, m_step);
+    m_totalSteps += static_cast<uint64_t>(steps);
+    return steps;
+}
+
+} // namespace Engine
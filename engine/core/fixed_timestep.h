@@ -0,0 +1,35 @@
+// engine/core/fixed_timestep.h
+#pragma once
+
+#include <cstdint>
+
+namespace Engine {
+
+// Acumulador da simulação em passo fixo: o tempo real de cada frame entra no acumulador e sai em
+// passos de tamanho constante, então o resultado da simulação não depende da taxa de quadros.
+// Com o limite de passos por frame, um frame lento não vira uma espiral (cada frame simulando mais
+// para alcançar o relógio): o atraso acima do limite é descartado e a simulação fica mais lenta
+// que o tempo real só durante o engasgo.
+class FixedTimestep {
+public:
+    FixedTimestep(double stepSeconds, int maxStepsPerFrame);
+
+    // Soma o tempo real do frame e retorna quantos passos simular agora (0 a maxStepsPerFrame)
+    int advance(double frameSeconds);
+
+    double getStep() const { return m_step; }
+    // Fração do próximo passo já decorrida (0..1): peso do estado atual na interpolação com o anterior
+    float getAlpha() const { return static_cast<float>(m_accumulator / m_step); }
+
+    uint64_t getTotalSteps() const { return m_totalSteps; }
+    uint64_t getDroppedSteps() const { return m_droppedSteps; }
+
+private:
+    double m_step;
+    int m_maxStepsPerFrame;
+    double m_accumulator = 0.0;
+    uint64_t m_totalSteps = 0;
+    uint64_t m_droppedSteps = 0; // Passos descartados pelo limite por frame
+};
+
+} // namespace Engine
@@ -0,0 +1,337 @@
+// engine/core/jobs.cpp
+#include "jobs.h"
+#include "log.h"
+#include "config.h"
+#include "profiler.h"
+#include "./../memory/pool_allocator.h"
+
+#include <algorithm>
+#include <format>
+
+namespace Engine {
+namespace Jobs {
+
+// Do pool: agendar não vai ao heap (só a std::function, quando a captura não cabe nela)
+struct Job : Memory::Pooled<Job, Memory::MemoryTag::General, 256> {
+    Job(JobFunction function, Counter* jobCounter, int jobOwner)
+        : fn(std::move(function)), counter(jobCounter), owner(jobOwner), tag(Memory::AllocationCounters::getCurrentTag()) {}
+
+    JobFunction fn;
+    Counter* counter;
+    int owner;             // Worker que agendou (-1 = fila global), para contar roubos
+    Memory::MemoryTag tag; // Tag de alocação de quem agendou, aplicada enquanto o job roda
+};
+
+namespace {
+    thread_local int t_workerIndex = -1;
+
+    size_t defaultWorkerCount() {
+        if (Engine::WORKER_THREAD_COUNT > 0) {
+            return static_cast<size_t>(Engine::WORKER_THREAD_COUNT);
+        }
+        // Reserva um núcleo para a thread principal e outro para a thread de renderização
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 2 ? hardware - 2 : 1;
+    }
+
+    // Tentativas sem trabalho antes de ceder a CPU (espera) ou dormir (worker)
+    constexpr int kSpinAttempts = 64;
+}
+
+Counter::~Counter() {
+    // O último job pode ainda estar dentro de finish() com a trava; espera ele sair
+    std::lock_guard<std::mutex> lock(m_mutex);
+}
+
+JobSystem& JobSystem::Get() {
+    static JobSystem instance(defaultWorkerCount());
+    return instance;
+}
+
+int JobSystem::getCurrentWorkerIndex() {
+    return t_workerIndex;
+}
+
+JobSystem::JobSystem(size_t workerCount) {
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    m_threads.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_threads.emplace_back(&JobSystem::workerMain, this, i);
+    }
+    Engine::Log::Info(std::format("Jobs: {} worker(s) iniciados.", workerCount));
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stop.store(true);
+    }
+    m_sleepCondition.notify_all();
+    for (std::thread& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    // Jobs que sobraram na saída do programa não rodam mais
+    for (const std::unique_ptr<Worker>& worker : m_workers) {
+        for (Job* job : worker->jobs) {
+            delete job;
+        }
+    }
+    for (Job* job : m_globalJobs) {
+        delete job;
+    }
+}
+
+void JobSystem::run(JobFunction fn, Counter* counter) {
+    if (counter) {
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    schedule(new Job(std::move(fn), counter, t_workerIndex));
+}
+
+void JobSystem::runAfter(Counter& dependency, JobFunction fn, Counter* counter) {
+    if (counter) {
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    Job* job = new Job(std::move(fn), counter, t_workerIndex);
+    {
+        // Sob a trava: finish() do último job da dependência ainda não pegou a lista, ou já zerou
+        std::lock_guard<std::mutex> lock(dependency.m_mutex);
+        if (dependency.m_pending.load(std::memory_order_acquire) != 0) {
+            dependency.m_continuations.push_back(job);
+            return;
+        }
+    }
+    schedule(job);
+}
+
+void JobSystem::schedule(Job* job) {
+    const int index = t_workerIndex;
+    if (index >= 0) {
+        Worker& worker = *m_workers[static_cast<size_t>(index)];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.jobs.push_back(job);
+        worker.size.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        std::lock_guard<std::mutex> lock(m_globalMutex);
+        m_globalJobs.push_back(job);
+        m_globalSize.fetch_add(1, std::memory_order_relaxed);
+    }
+    wakeWorkers(1);
+}
+
+void JobSystem::wakeWorkers(size_t count) {
+    m_workVersion.fetch_add(1);
+    if (m_sleeping.load() == 0) {
+        return;
+    }
+    {
+        // Passa pela trava: um worker entre a checagem do predicado e o wait não perde o aviso
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    if (count == 1) {
+        m_sleepCondition.notify_one();
+    } else {
+        m_sleepCondition.notify_all();
+    }
+}
+
+Job* JobSystem::pop(int workerIndex) {
+    // 1. Própria deque, pelo fim (o job mais recente)
+    if (workerIndex >= 0) {
+        Worker& worker = *m_workers[static_cast<size_t>(workerIndex)];
+        if (worker.size.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if (!worker.jobs.empty()) {
+                Job* job = worker.jobs.back();
+                worker.jobs.pop_back();
+                worker.size.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+    }
+
+    // 2. Fila global, pelo início
+    if (m_globalSize.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(m_globalMutex);
+        if (!m_globalJobs.empty()) {
+            Job* job = m_globalJobs.front();
+            m_globalJobs.pop_front();
+            m_globalSize.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // 3. Roubo: início da deque dos outros, a partir do vizinho (espalha os ladrões)
+    const size_t workerCount = m_workers.size();
+    const size_t start = workerIndex >= 0 ? static_cast<size_t>(workerIndex) + 1 : 0;
+    for (size_t offset = 0; offset < workerCount; ++offset) {
+        const size_t victimIndex = (start + offset) % workerCount;
+        if (static_cast<int>(victimIndex) == workerIndex) {
+            continue;
+        }
+        Worker& victim = *m_workers[victimIndex];
+        if (victim.size.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            Job* job = victim.jobs.front();
+            victim.jobs.pop_front();
+            victim.size.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::runOne(int workerIndex) {
+    Job* job = pop(workerIndex);
+    if (!job) {
+        return false;
+    }
+    execute(job, workerIndex, job->owner != workerIndex);
+    return true;
+}
+
+void JobSystem::execute(Job* job, int workerIndex, bool stolen) {
+    {
+        Memory::AllocationScope scope(job->tag);
+        job->fn();
+    }
+    Counter* counter = job->counter;
+    delete job;
+
+    if (workerIndex >= 0) {
+        Worker& worker = *m_workers[static_cast<size_t>(workerIndex)];
+        worker.executed.fetch_add(1, std::memory_order_relaxed);
+        if (stolen) {
+            worker.stolen.fetch_add(1, std::memory_order_relaxed);
+        }
+    } else {
+        m_externalExecuted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (counter) {
+        finish(counter);
+    }
+}
+
+void JobSystem::finish(Counter* counter) {
+    // Caminho rápido sem trava enquanto não é o último job do grupo
+    uint32_t pending = counter->m_pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter->m_pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    std::vector<Job*> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_mutex);
+        if (counter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuations.swap(counter->m_continuations);
+        }
+    }
+    // Depois de soltar a trava o contador pode ter sido destruído: só a lista local é usada
+    for (Job* job : continuations) {
+        schedule(job);
+    }
+}
+
+void JobSystem::wait(Counter& counter) {
+    int idle = 0;
+    while (!counter.isDone()) {
+        if (runOne(t_workerIndex)) {
+            idle = 0;
+        } else if (++idle >= kSpinAttempts) {
+            std::this_thread::yield();
+            idle = 0;
+        }
+    }
+    // Sincroniza com o finish() que zerou o contador antes de quem espera poder destruí-lo
+    std::lock_guard<std::mutex> lock(counter.m_mutex);
+}
+
+void JobSystem::workerMain(size_t index) {
+    t_workerIndex = static_cast<int>(index);
+    Engine::Profiling::Profiler::setThreadName(std::format("Worker {}", index));
+    int idle = 0;
+    while (!m_stop.load(std::memory_order_relaxed)) {
+        const uint64_t version = m_workVersion.load();
+        if (runOne(t_workerIndex)) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < kSpinAttempts) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nada em lugar nenhum: dorme até o próximo agendamento
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleeping.fetch_add(1);
+        m_sleepCondition.wait(lock, [&] { return m_stop.load() || m_workVersion.load() != version; });
+        m_sleeping.fetch_sub(1);
+        idle = 0;
+    }
+}
+
+bool JobSystem::ownDequeEmpty() const {
+    const int index = t_workerIndex;
+    if (index < 0) {
+        return m_globalSize.load(std::memory_order_relaxed) == 0;
+    }
+    return m_workers[static_cast<size_t>(index)]->size.load(std::memory_order_relaxed) == 0;
+}
+
+void JobSystem::rangeJob(size_t begin, size_t end, size_t minGrain, const std::function<void(size_t, size_t)>* fn, Counter* counter) {
+    while (begin < end) {
+        // Divide enquanto não houver nada para roubar: a metade de cima vai para a deque
+        if (end - begin > minGrain && ownDequeEmpty()) {
+            const size_t middle = begin + (end - begin) / 2;
+            const size_t splitEnd = end;
+            run([this, middle, splitEnd, minGrain, fn, counter]() { rangeJob(middle, splitEnd, minGrain, fn, counter); }, counter);
+            end = middle;
+            continue;
+        }
+        const size_t chunkEnd = std::min(begin + minGrain, end);
+        (*fn)(begin, chunkEnd);
+        begin = chunkEnd;
+    }
+}
+
+void JobSystem::parallelFor(size_t count, const std::function<void(size_t, size_t)>& fn, size_t minGrain) {
+    if (count == 0) {
+        return;
+    }
+    if (minGrain == 0) {
+        minGrain = std::max<size_t>(1, count / (getThreadCount() * 32));
+    }
+    if (count <= minGrain || m_workers.empty()) {
+        fn(0, count);
+        return;
+    }
+
+    // A thread chamadora processa a faixa inteira (dividindo) e depois ajuda até o contador zerar
+    Counter counter;
+    rangeJob(0, count, minGrain, &fn, &counter);
+    wait(counter);
+}
+
+JobStats JobSystem::getStats() const {
+    JobStats stats;
+    stats.executed = m_externalExecuted.load(std::memory_order_relaxed);
+    for (const std::unique_ptr<Worker>& worker : m_workers) {
+        stats.executed += worker->executed.load(std::memory_order_relaxed);
+        stats.stolen += worker->stolen.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+} // namespace Jobs
+} // namespace Engine
@@ -0,0 +1,125 @@
+// engine/core/jobs.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+namespace Jobs {
+
+using JobFunction = std::function<void()>;
+
+struct Job;
+
+// Conta os jobs ainda não terminados de um grupo. É incrementado quando o job é agendado e
+// decrementado quando ele termina; JobSystem::wait espera o zero executando outros jobs, e
+// JobSystem::runAfter agenda jobs que dependem do grupo inteiro.
+// Só destruir depois de wait() (ou de isDone() verdadeiro): o destrutor espera o último job soltar o contador.
+class Counter {
+public:
+    Counter() = default;
+    ~Counter();
+
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    bool isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_pending{0};
+    std::mutex m_mutex;                 // Só para o último decremento e para m_continuations
+    std::vector<Job*> m_continuations;  // Liberados quando m_pending chega a zero
+};
+
+// Contadores acumulados desde o início (log e benchmark)
+struct JobStats {
+    uint64_t executed = 0;
+    uint64_t stolen = 0;   // Executados por uma thread diferente da que os agendou
+};
+
+// Pool fixo de workers com uma deque por thread e roubo de trabalho: cada worker empilha e desempilha
+// no fim da própria deque (LIFO, dados ainda no cache) e, sem trabalho, rouba do início da deque de
+// outro worker (FIFO, os blocos maiores). Threads de fora do pool (principal, streaming) agendam numa
+// fila global. Quem espera um Counter executa jobs enquanto isso, então jobs podem agendar e esperar
+// outros jobs (parallelFor aninhado) sem travar o pool.
+class JobSystem {
+public:
+    static JobSystem& Get();
+
+    // Workers + a thread que espera (que também executa jobs)
+    size_t getThreadCount() const { return m_workers.size() + 1; }
+    // Índice do worker atual em [0, workers), ou -1 fora do pool
+    static int getCurrentWorkerIndex();
+
+    // Agenda 'fn'; 'counter' (opcional) conta o job até ele terminar
+    void run(JobFunction fn, Counter* counter = nullptr);
+    // Agenda 'fn' só quando 'dependency' chegar a zero (na hora, se já estiver zerado).
+    // 'counter' já conta o job a partir desta chamada.
+    void runAfter(Counter& dependency, JobFunction fn, Counter* counter = nullptr);
+    // Retorna quando 'counter' chegar a zero, executando jobs pendentes enquanto isso
+    void wait(Counter& counter);
+
+    // Chama fn(begin, end) sobre faixas que cobrem [0, count) e retorna quando todas terminarem.
+    // Grão adaptativo (divisão binária preguiçosa): cada job divide a faixa ao meio enquanto a própria
+    // deque estiver vazia (ninguém tem o que roubar) e ela for maior que 'minGrain'; com as deques
+    // cheias, processa blocos de 'minGrain'. minGrain = 0 escolhe count / (threads * 32).
+    void parallelFor(size_t count, const std::function<void(size_t, size_t)>& fn, size_t minGrain = 0);
+
+    JobStats getStats() const;
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+private:
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::deque<Job*> jobs;
+        std::atomic<uint32_t> size{0}; // Aproximado, lido sem a trava
+        std::atomic<uint64_t> executed{0};
+        std::atomic<uint64_t> stolen{0};
+    };
+
+    explicit JobSystem(size_t workerCount);
+    ~JobSystem();
+
+    void workerMain(size_t index);
+    void schedule(Job* job);
+    // Tenta executar um job: da própria deque, da fila global ou roubado de outro worker
+    bool runOne(int workerIndex);
+    Job* pop(int workerIndex);
+    void execute(Job* job, int workerIndex, bool stolen);
+    void finish(Counter* counter);
+    void wakeWorkers(size_t count);
+    bool ownDequeEmpty() const;
+
+    void rangeJob(size_t begin, size_t end, size_t minGrain, const std::function<void(size_t, size_t)>* fn, Counter* counter);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread> m_threads;
+
+    // Fila de quem não é worker
+    std::mutex m_globalMutex;
+    std::deque<Job*> m_globalJobs;
+    std::atomic<uint32_t> m_globalSize{0};
+    std::atomic<uint64_t> m_externalExecuted{0};
+
+    // Workers sem trabalho dormem aqui; m_workVersion muda a cada agendamento (evita perder o aviso)
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCondition;
+    std::atomic<uint64_t> m_workVersion{0};
+    std::atomic<uint32_t> m_sleeping{0};
+    std::atomic<bool> m_stop{false};
+};
+
+} // namespace Jobs
+} // namespace Engine
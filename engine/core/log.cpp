@@ -1,17 +1,375 @@
 // engine/core/log.cpp
 #include "log.h"
-#include <chrono>   // Para std::chrono::system_clock
-#include <iomanip>  // Para std::put_time
-#include <sstream>  // Para std::stringstream
+#include "config.h"
+#include "./../memory/allocation_counters.h"
+
+#include <cstdio>
+#include <cstdlib>  // Para std::atexit
+#include <ctime>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace Engine {
 
+namespace {
+
+    using SystemClock = std::chrono::system_clock;
+
+    struct Record {
+        LogLevel level = LogLevel::Info;
+        SystemClock::time_point time;
+        const char* file = "";
+        uint32_t line = 0;
+        std::string message;
+    };
+
+    // Fila limitada sem trava (Vyukov): cada célula tem um número de sequência que diz se está livre
+    // para a volta atual do produtor ou pronta para o consumidor. Vários produtores disputam a posição
+    // de escrita com CAS; os consumidores (a thread de escrita e a escrita síncrona) se revezam sob
+    // m_outputMutex do Logger.
+    class RecordQueue {
+    public:
+        explicit RecordQueue(size_t capacity) : m_cells(new Cell[capacity]), m_mask(capacity - 1) {
+            for (size_t i = 0; i < capacity; ++i) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // Falso com a fila cheia ('record' fica intacto)
+        bool tryPush(Record& record) {
+            uint64_t position = m_enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = m_cells[position & m_mask];
+                const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+                if (diff == 0) {
+                    // seq_cst: pareado com a leitura de m_sleeping (ver Logger::push)
+                    if (m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        cell.record = std::move(record);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    position = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Só sob m_outputMutex. Falso se a próxima célula ainda não foi publicada.
+        bool tryPop(Record& record) {
+            const uint64_t position = m_dequeuePos.load(std::memory_order_relaxed);
+            Cell& cell = m_cells[position & m_mask];
+            if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+                return false;
+            }
+            record = std::move(cell.record);
+            cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+            m_dequeuePos.store(position + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Posições reservadas mas ainda não publicadas contam como não vazia
+        bool empty() const {
+            return m_enqueuePos.load(std::memory_order_seq_cst) == m_dequeuePos.load(std::memory_order_relaxed);
+        }
+
+        uint64_t enqueued() const {
+            return m_enqueuePos.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        struct Cell {
+            std::atomic<uint64_t> sequence;
+            Record record;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        const uint64_t m_mask;
+        alignas(64) std::atomic<uint64_t> m_enqueuePos{0};
+        alignas(64) std::atomic<uint64_t> m_dequeuePos{0}; // Atômico: empty() lê fora da trava
+    };
+
+    const char* levelString(LogLevel level) {
+        switch (level) {
+            case LogLevel::Trace:    return "TRACE";
+            case LogLevel::Debug:    return "DEBUG";
+            case LogLevel::Info:     return "INFO "; // Adicionado espaço para alinhamento
+            case LogLevel::Warn:     return "WARN ";
+            case LogLevel::Error:    return "ERROR";
+            case LogLevel::Critical: return "CRITICAL";
+            default:                 return "UNKNOWN";
+        }
+    }
+
+    size_t queueCapacity() {
+        size_t capacity = 64;
+        while (capacity < static_cast<size_t>(Engine::LOG_QUEUE_CAPACITY)) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    class Logger {
+    public:
+        // Nunca destruído: threads e destrutores estáticos podem logar depois do fim de main
+        static Logger& Get() {
+            static Logger* instance = new Logger();
+            return *instance;
+        }
+
+        void push(Record&& record) {
+            if (!m_async.load(std::memory_order_relaxed) || !m_running.load(std::memory_order_acquire)) {
+                writeSynchronously(&record);
+                return;
+            }
+
+            const bool critical = record.level == LogLevel::Critical;
+            while (!m_queue.tryPush(record)) {
+                if (m_stop.load(std::memory_order_seq_cst)) {
+                    writeSynchronously(&record); // A thread de escrita pode já ter saído
+                    return;
+                }
+                wake(); // Fila cheia: espera a thread de escrita abrir espaço
+                std::this_thread::yield();
+            }
+            if (m_sleeping.load(std::memory_order_seq_cst)) {
+                wake();
+            }
+            // Encerramento em curso: a thread de escrita e a última drenagem de shutdown podem já ter
+            // passado por esta mensagem. Se m_stop ainda é falso aqui, a thread de escrita vê o push.
+            if (m_stop.load(std::memory_order_seq_cst)) {
+                writeSynchronously(nullptr);
+                return;
+            }
+            if (critical) {
+                flush(); // O programa pode terminar logo depois
+            }
+        }
+
+        void flush() {
+            if (!m_running.load(std::memory_order_acquire)) {
+                return;
+            }
+            const uint64_t target = m_queue.enqueued();
+            wake();
+            uint64_t written = m_written.load(std::memory_order_acquire);
+            while (written < target && m_running.load(std::memory_order_acquire)) {
+                m_written.wait(written, std::memory_order_acquire);
+                written = m_written.load(std::memory_order_acquire);
+            }
+        }
+
+        void setAsync(bool async) {
+            if (async) {
+                start();
+            } else {
+                flush();
+            }
+            m_async.store(async, std::memory_order_relaxed);
+        }
+
+        void setConsoleOutput(bool enabled) {
+            std::lock_guard<std::mutex> lock(m_outputMutex);
+            m_console = enabled;
+        }
+
+        void shutdown() {
+            std::lock_guard<std::mutex> lifecycle(m_lifecycleMutex);
+            if (!m_thread.joinable()) {
+                return;
+            }
+            m_stop.store(true, std::memory_order_seq_cst);
+            wake();
+            m_thread.join();
+            m_running.store(false, std::memory_order_release);
+            m_written.notify_all();
+
+            // Produtores que viram m_running antes da troca
+            writeSynchronously(nullptr);
+        }
+
+    private:
+        Logger() : m_queue(queueCapacity()), m_async(Engine::LOG_ASYNC) {
+            if (Engine::LOG_ASYNC) {
+                start();
+            }
+        }
+
+        void start() {
+            std::lock_guard<std::mutex> lifecycle(m_lifecycleMutex);
+            if (m_thread.joinable()) {
+                return;
+            }
+            m_stop.store(false, std::memory_order_relaxed);
+            m_thread = std::thread([this]() {
+                Memory::AllocationScope allocationScope(Memory::MemoryTag::Log);
+                run();
+            });
+            m_running.store(true, std::memory_order_release);
+
+            static const bool registered = std::atexit([]() { Logger::Get().shutdown(); }) == 0;
+            (void)registered;
+        }
+
+        void wake() {
+            m_wake.fetch_add(1, std::memory_order_seq_cst);
+            m_wake.notify_one();
+        }
+
+        void run() {
+            for (;;) {
+                if (drain() > 0) {
+                    continue;
+                }
+                if (m_stop.load(std::memory_order_seq_cst)) {
+                    if (m_queue.empty()) {
+                        return;
+                    }
+                    std::this_thread::yield(); // Um produtor ainda está publicando
+                    continue;
+                }
+
+                // Dorme só se nenhum produtor publicou depois de m_sleeping (pareado com push)
+                const uint32_t seen = m_wake.load(std::memory_order_seq_cst);
+                m_sleeping.store(true, std::memory_order_seq_cst);
+                if (!m_queue.empty() || m_stop.load(std::memory_order_seq_cst)) {
+                    m_sleeping.store(false, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                    continue;
+                }
+                m_wake.wait(seen, std::memory_order_seq_cst);
+                m_sleeping.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        // Escreve um lote; retorna quantas mensagens saíram da fila
+        size_t drain() {
+            constexpr size_t kBatch = 256;
+            size_t count = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_outputMutex);
+                Record record;
+                while (count < kBatch && m_queue.tryPop(record)) {
+                    emit(record);
+                    ++count;
+                }
+                if (count == 0) {
+                    return 0;
+                }
+                flushOutput();
+            }
+            m_written.fetch_add(count, std::memory_order_release);
+            m_written.notify_all();
+            return count;
+        }
+
+        // Escrita na thread que loga: esvazia a fila antes de 'record' (se houver) para manter a ordem
+        void writeSynchronously(const Record* record) {
+            size_t count = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_outputMutex);
+                Record queued;
+                while (m_queue.tryPop(queued)) {
+                    emit(queued);
+                    ++count;
+                }
+                if (record != nullptr) {
+                    emit(*record);
+                }
+                flushOutput();
+            }
+            if (count > 0) {
+                m_written.fetch_add(count, std::memory_order_release);
+                m_written.notify_all();
+            }
+        }
+
+        // Sob m_outputMutex. Formato: [DATA HORA.ms] [NIVEL] (Arquivo:Linha) Mensagem
+        void emit(const Record& record) {
+            FILE* stream = record.level >= LogLevel::Warn ? stderr : stdout; // Erros e avisos para stderr
+            if (stream != m_stream) {
+                flushOutput(); // Mantém a ordem entre as duas saídas
+                m_stream = stream;
+            }
+
+            const auto sinceEpoch = record.time.time_since_epoch();
+            const std::time_t seconds = static_cast<std::time_t>(std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch).count());
+            if (seconds != m_cachedSecond) {
+                // Data refeita uma vez por segundo, não por mensagem
+                std::tm tm_buf;
+#ifdef _WIN32
+                localtime_s(&tm_buf, &seconds); // Thread-safe version for Windows
+#else
+                localtime_r(&seconds, &tm_buf); // Thread-safe version for Unix-like
+#endif
+                m_cachedDateLength = std::strftime(m_cachedDate, sizeof(m_cachedDate), "%Y-%m-%d %H:%M:%S", &tm_buf);
+                m_cachedSecond = seconds;
+            }
+            const long long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count() % 1000;
+
+            std::format_to(std::back_inserter(m_buffer), "[{}.{:03}] [{}] ({}:{}) {}\n", std::string_view(m_cachedDate, m_cachedDateLength),
+                           milliseconds, levelString(record.level), record.file, record.line, record.message);
+        }
+
+        // Sob m_outputMutex
+        void flushOutput() {
+            if (m_buffer.empty()) {
+                return;
+            }
+            if (m_console) {
+                std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_stream);
+                std::fflush(m_stream);
+            }
+            m_buffer.clear();
+        }
+
+        RecordQueue m_queue;
+        std::atomic<bool> m_async;
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_stop{false};
+        std::atomic<bool> m_sleeping{false};
+        std::atomic<uint32_t> m_wake{0};
+        std::atomic<uint64_t> m_written{0}; // Mensagens retiradas da fila e escritas
+        std::mutex m_lifecycleMutex;
+        std::thread m_thread;
+
+        // Saída: thread de escrita, modo síncrono e shutdown
+        std::mutex m_outputMutex;
+        bool m_console = true;
+        FILE* m_stream = stdout;
+        std::string m_buffer;
+        std::time_t m_cachedSecond = -1;
+        char m_cachedDate[32] = {};
+        size_t m_cachedDateLength = 0;
+    };
+
+} // namespace
+
 // Inicializa o nível de log padrão (pode ser configurado em tempo de execução)
-LogLevel Log::s_currentLogLevel = LogLevel::Info; // Nível padrão: apenas Info, Warn, Error, Critical
+std::atomic<LogLevel> Log::s_currentLogLevel{LogLevel::Info}; // Nível padrão: apenas Info, Warn, Error, Critical
 
 void Log::SetLogLevel(LogLevel level) {
-    s_currentLogLevel = level;
-    // Opcional: Log::Info(std::format("Nível de log definido para {}", GetLogLevelString(level)));
+    s_currentLogLevel.store(level, std::memory_order_relaxed);
+}
+
+void Log::SetAsync(bool async) {
+    Logger::Get().setAsync(async);
+}
+
+void Log::SetConsoleOutput(bool enabled) {
+    Logger::Get().setConsoleOutput(enabled);
+}
+
+void Log::Flush() {
+    Logger::Get().flush();
+}
+
+void Log::Shutdown() {
+    Logger::Get().shutdown();
 }
 
 void Log::Trace(const std::string& message, const std::source_location& location) {
@@ -39,49 +397,20 @@ void Log::Critical(const std::string& message, const std::source_location& locat
 }
 
 void Log::LogMessage(LogLevel level, const std::string& message, const std::source_location& location) {
-    if (static_cast<int>(level) < static_cast<int>(s_currentLogLevel)) {
+    if (!IsEnabled(level)) {
         return; // Ignora mensagens abaixo do nível configurado
     }
-
-    auto now = std::chrono::system_clock::now();
-    auto in_time_t = std::chrono::system_clock::to_time_t(now);
-    std::tm tm_buf;
-    
-#ifdef _WIN32
-    localtime_s(&tm_buf, &in_time_t); // Thread-safe version for Windows
-#else
-    localtime_r(&in_time_t, &tm_buf); // Thread-safe version for Unix-like
-#endif
-
-    std::stringstream ss;
-    ss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
-
-    // Formato da mensagem: [TIMESTAMP] [NIVEL] (Arquivo:Linha:Função) Mensagem
-    std::string formatted_message = std::format("[{}] [{}] ({}:{}) {}\n",
-                                                ss.str(),
-                                                GetLogLevelString(level),
-                                                location.file_name(),
-                                                location.line(),
-                                                message);
-
-    // Saída no console. Em um sistema mais robusto, seria redirecionado para um arquivo, etc.
-    if (level >= LogLevel::Warn) {
-        std::cerr << formatted_message; // Erros e Warnings para std::cerr
-    } else {
-        std::cout << formatted_message; // Outros para std::cout
-    }
+    Write(level, message, location);
 }
 
-std::string Log::GetLogLevelString(LogLevel level) {
-    switch (level) {
-        case LogLevel::Trace:    return "TRACE";
-        case LogLevel::Debug:    return "DEBUG";
-        case LogLevel::Info:     return "INFO "; // Adicionado espaço para alinhamento
-        case LogLevel::Warn:     return "WARN ";
-        case LogLevel::Error:    return "ERROR";
-        case LogLevel::Critical: return "CRITICAL";
-        default:                 return "UNKNOWN";
-    }
+void Log::Write(LogLevel level, std::string message, const std::source_location& location) {
+    Record record;
+    record.level = level;
+    record.time = SystemClock::now();
+    record.file = location.file_name();
+    record.line = location.line();
+    record.message = std::move(message);
+    Logger::Get().push(std::move(record));
 }
 
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -1,12 +1,19 @@
 // engine/core/log.h
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <iostream> // Para saída no console por enquanto
 #include <source_location> // C++20, para obter informações de arquivo/linha
 #include <chrono>    // Para timestamps
 #include <format>    // C++20, para formatação de strings
 
+// Nível mínimo compilado (0 = Trace ... 5 = Critical). As macros ENGINE_LOG_* abaixo dele não geram
+// código. Definido pelo CMake: Trace e Debug somem nas configurações Release/MinSizeRel/RelWithDebInfo.
+#ifndef ENGINE_LOG_MIN_LEVEL
+#define ENGINE_LOG_MIN_LEVEL 0
+#endif
+
 namespace Engine {
 
 // Níveis de log
@@ -19,14 +26,34 @@ enum class LogLevel {
     Critical     // Erros graves que levam à terminação do programa
 };
 
+// As mensagens entram numa fila sem trava (vários produtores, um consumidor) e uma thread própria
+// formata o cabeçalho e escreve no console; quem loga só copia a mensagem. Com a fila cheia, quem loga
+// espera a thread de escrita (nada é descartado). Critical esvazia a fila antes de retornar.
+// Prefira as macros ENGINE_LOG_*: abaixo do nível atual elas nem formatam a mensagem.
 class Log {
 public:
     // Define o nível mínimo de log a ser exibido.
     // Mensagens com um nível menor que o atual serão ignoradas.
     static void SetLogLevel(LogLevel level);
+    static LogLevel GetLogLevel() { return s_currentLogLevel.load(std::memory_order_relaxed); }
+
+    static bool IsEnabled(LogLevel level) {
+        return static_cast<int>(level) >= ENGINE_LOG_MIN_LEVEL &&
+               static_cast<int>(level) >= static_cast<int>(s_currentLogLevel.load(std::memory_order_relaxed));
+    }
+
+    // false: escreve na thread que loga, sob uma trava (depuração de travamentos). Esvazia a fila antes.
+    static void SetAsync(bool async);
+    // false: as mensagens ainda passam pela fila e são formatadas, mas não vão para o console (benchmarks)
+    static void SetConsoleOutput(bool enabled);
+    // Espera a thread de escrita gravar tudo o que foi logado até aqui
+    static void Flush();
+    // Esvazia a fila e encerra a thread de escrita; o que vier depois é escrito de forma síncrona.
+    // Chamado automaticamente na saída do programa.
+    static void Shutdown();
 
-    // Métodos de log para cada nível
-    static void Trace(const std::string& message, 
+    // Métodos de log para cada nível (a mensagem já formatada é sempre construída)
+    static void Trace(const std::string& message,
                       const std::source_location& location = std::source_location::current());
     static void Debug(const std::string& message,
                        const std::source_location& location = std::source_location::current());
@@ -39,12 +66,47 @@ public:
     static void Critical(const std::string& message,
                         const std::source_location& location = std::source_location::current());
 
+    // Usado pelas macros: não testa o nível
+    static void Write(LogLevel level, std::string message, const std::source_location& location);
+
 private:
-    static LogLevel s_currentLogLevel; // Nível de log atual
-    
-    // Função auxiliar para formatar e imprimir a mensagem
+    static std::atomic<LogLevel> s_currentLogLevel; // Nível de log atual
+
+    // Filtra pelo nível e encaminha para Write
     static void LogMessage(LogLevel level, const std::string& message, const std::source_location& location);
-    static std::string GetLogLevelString(LogLevel level);
 };
 
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
+
+// Formatação preguiçosa: os argumentos são os de std::format e só são avaliados se o nível estiver ativo.
+#define ENGINE_LOG_AT(level, ...)                                                                              \
+    do {                                                                                                       \
+        if (::Engine::Log::IsEnabled(level)) {                                                                 \
+            ::Engine::Log::Write(level, ::std::format(__VA_ARGS__), ::std::source_location::current());        \
+        }                                                                                                      \
+    } while (0)
+
+// Abaixo de ENGINE_LOG_MIN_LEVEL a chamada continua sendo checada pelo compilador, mas nunca executa
+#define ENGINE_LOG_STRIPPED(...)                                                                               \
+    do {                                                                                                       \
+        if (false) {                                                                                           \
+            (void)::std::format(__VA_ARGS__);                                                                  \
+        }                                                                                                      \
+    } while (0)
+
+#if ENGINE_LOG_MIN_LEVEL <= 0
+#define ENGINE_LOG_TRACE(...) ENGINE_LOG_AT(::Engine::LogLevel::Trace, __VA_ARGS__)
+#else
+#define ENGINE_LOG_TRACE(...) ENGINE_LOG_STRIPPED(__VA_ARGS__)
+#endif
+
+#if ENGINE_LOG_MIN_LEVEL <= 1
+#define ENGINE_LOG_DEBUG(...) ENGINE_LOG_AT(::Engine::LogLevel::Debug, __VA_ARGS__)
+#else
+#define ENGINE_LOG_DEBUG(...) ENGINE_LOG_STRIPPED(__VA_ARGS__)
+#endif
+
+#define ENGINE_LOG_INFO(...) ENGINE_LOG_AT(::Engine::LogLevel::Info, __VA_ARGS__)
+#define ENGINE_LOG_WARN(...) ENGINE_LOG_AT(::Engine::LogLevel::Warn, __VA_ARGS__)
+#define ENGINE_LOG_ERROR(...) ENGINE_LOG_AT(::Engine::LogLevel::Error, __VA_ARGS__)
+#define ENGINE_LOG_CRITICAL(...) ENGINE_LOG_AT(::Engine::LogLevel::Critical, __VA_ARGS__)
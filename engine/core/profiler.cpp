@@ -0,0 +1,279 @@
+// engine/core/profiler.cpp
+#include "profiler.h"
+#include "config.h"
+#include "log.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace Engine {
+namespace Profiling {
+
+namespace {
+
+    struct ZoneEvent {
+        const char* name;
+        uint64_t startNs;
+        uint64_t endNs;
+    };
+
+    // Anel de uma thread: só ela escreve; a captura lê pelo contador 'written'
+    struct ThreadBuffer {
+        ThreadBuffer(uint32_t id, size_t capacity) : threadId(id), events(capacity) {}
+
+        uint32_t threadId;
+        std::vector<ZoneEvent> events;
+        std::atomic<uint64_t> written{0};
+        std::string name;       // Sob g_registryMutex
+        bool inUse = true;      // Sob g_registryMutex; anéis de threads encerradas são reaproveitados
+    };
+
+    struct CapturedEvent {
+        ZoneEvent event;
+        uint32_t threadId;
+    };
+
+    constexpr size_t kMaxFrames = 1024; // Frames cujo início é lembrado (limite de uma captura)
+
+    std::atomic<bool> g_enabled{Engine::PROFILER_ENABLED};
+
+    std::mutex g_registryMutex;
+    // Nunca destruída: threads que terminam depois dos destrutores estáticos ainda gravam
+    std::vector<ThreadBuffer*>& registry() {
+        static std::vector<ThreadBuffer*>* threads = new std::vector<ThreadBuffer*>();
+        return *threads;
+    }
+
+    // Devolve o anel quando a thread termina
+    struct BufferOwner {
+        ThreadBuffer* buffer = nullptr;
+        ~BufferOwner() {
+            if (buffer) {
+                std::lock_guard<std::mutex> lock(g_registryMutex);
+                buffer->inUse = false;
+            }
+        }
+    };
+    thread_local BufferOwner t_owner;
+
+    void push(ThreadBuffer& buffer, const ZoneEvent& event) {
+        const uint64_t index = buffer.written.load(std::memory_order_relaxed);
+        buffer.events[static_cast<size_t>(index % buffer.events.size())] = event;
+        buffer.written.store(index + 1, std::memory_order_release);
+    }
+
+    ThreadBuffer& threadBuffer() {
+        if (!t_owner.buffer) {
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            std::vector<ThreadBuffer*>& threads = registry();
+            auto reusable = std::find_if(threads.begin(), threads.end(), [](const ThreadBuffer* buffer) { return !buffer->inUse; });
+            if (reusable != threads.end()) {
+                // Sem dono e a captura lê sob a mesma trava: o anel pode ser zerado
+                (*reusable)->written.store(0, std::memory_order_relaxed);
+                (*reusable)->inUse = true;
+                t_owner.buffer = *reusable;
+            } else {
+                const size_t capacity = static_cast<size_t>(std::max(Engine::PROFILER_EVENTS_PER_THREAD, 256));
+                t_owner.buffer = new ThreadBuffer(static_cast<uint32_t>(threads.size()), capacity);
+                threads.push_back(t_owner.buffer);
+            }
+            t_owner.buffer->name = std::format("Thread {}", t_owner.buffer->threadId);
+        }
+        return *t_owner.buffer;
+    }
+
+    // Só a thread principal (beginFrame)
+    std::array<uint64_t, kMaxFrames> g_frameStarts{};
+    std::atomic<uint64_t> g_frameIndex{0};
+
+    std::mutex g_captureMutex;
+    int g_captureFrames = 0;
+    std::string g_capturePath;
+
+    std::string escapeJson(const char* text) {
+        std::string escaped;
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                escaped += '\\';
+            }
+            escaped += static_cast<unsigned char>(*c) < 0x20 ? ' ' : *c;
+        }
+        return escaped;
+    }
+
+    // Copia os eventos de [fromNs, toNs] de todas as threads. Um escritor pode sobrescrever o início do
+    // anel durante a cópia: o contador é relido depois e as posições que ele pode ter alcançado são descartadas.
+    std::vector<CapturedEvent> collect(uint64_t fromNs, uint64_t toNs, std::vector<std::pair<uint32_t, std::string>>& threadNames) {
+        std::vector<CapturedEvent> captured;
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        for (ThreadBuffer* buffer : registry()) {
+            const uint64_t capacity = buffer->events.size();
+            const uint64_t written = buffer->written.load(std::memory_order_acquire);
+            const uint64_t first = written > capacity ? written - capacity : 0;
+            std::vector<ZoneEvent> local;
+            local.reserve(static_cast<size_t>(written - first));
+            for (uint64_t i = first; i < written; ++i) {
+                local.push_back(buffer->events[static_cast<size_t>(i % capacity)]);
+            }
+
+            const uint64_t after = buffer->written.load(std::memory_order_acquire);
+            const uint64_t safeFrom = after + 1 > capacity ? after + 1 - capacity : 0;
+            bool any = false;
+            for (uint64_t i = std::max(first, safeFrom); i < written; ++i) {
+                const ZoneEvent& event = local[static_cast<size_t>(i - first)];
+                if (event.startNs < fromNs || event.endNs > toNs) {
+                    continue;
+                }
+                captured.push_back({event, buffer->threadId});
+                any = true;
+            }
+            if (any) {
+                threadNames.emplace_back(buffer->threadId, buffer->name);
+            }
+        }
+        return captured;
+    }
+
+    void writeCapture(int frames, std::string path, uint64_t frameStartNs) {
+        const uint64_t completed = g_frameIndex.load(std::memory_order_relaxed) - 1;
+        const uint64_t count = std::min<uint64_t>({static_cast<uint64_t>(frames), completed, kMaxFrames - 1});
+        if (count == 0) {
+            Engine::Log::Warn("Profiler: captura pedida antes do primeiro frame completo.");
+            return;
+        }
+        const uint64_t fromNs = g_frameStarts[(completed - count) % kMaxFrames];
+
+        std::vector<std::pair<uint32_t, std::string>> threadNames;
+        std::vector<CapturedEvent> events = collect(fromNs, frameStartNs, threadNames);
+
+        if (path.empty()) {
+            path = std::format("{}/trace_{}.json", Engine::PROFILER_TRACE_DIR, completed);
+        }
+        std::error_code error;
+        const std::filesystem::path parent = std::filesystem::path(path).parent_path();
+        if (!parent.empty()) {
+            std::filesystem::create_directories(parent, error);
+        }
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            Engine::Log::Error(std::format("Profiler: não foi possível gravar '{}'.", path));
+            return;
+        }
+
+        // Tempos em microssegundos a partir do início do primeiro frame capturado
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"engine\"}}";
+        for (const auto& [threadId, name] : threadNames) {
+            file << std::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}", threadId,
+                                escapeJson(name.c_str()));
+            file << std::format(",\n{{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"sort_index\":{}}}}}", threadId,
+                                threadId);
+        }
+        for (const CapturedEvent& entry : events) {
+            file << std::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", escapeJson(entry.event.name),
+                                entry.threadId, static_cast<double>(entry.event.startNs - fromNs) / 1000.0,
+                                static_cast<double>(entry.event.endNs - entry.event.startNs) / 1000.0);
+        }
+        file << "\n]}\n";
+
+        Engine::Log::Info(std::format("Profiler: {} zonas de {} thread(s) em {} frame(s) ({:.2f} ms) gravadas em '{}'.", events.size(),
+                                      threadNames.size(), count, static_cast<double>(frameStartNs - fromNs) / 1e6, path));
+    }
+
+} // namespace
+
+bool Profiler::isEnabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::setEnabled(bool enabled) {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    buffer.name = name;
+}
+
+uint64_t Profiler::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t Profiler::beginZone() {
+    return now();
+}
+
+void Profiler::endZone(const char* name, uint64_t startNs) {
+    const uint64_t endNs = now();
+    push(threadBuffer(), {name, startNs, endNs});
+}
+
+Profiler::TrackId Profiler::createTrack(const std::string& name) {
+    // Nunca devolvida: inUse fica verdadeiro e nenhuma thread a reaproveita
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    std::vector<ThreadBuffer*>& threads = registry();
+    const size_t capacity = static_cast<size_t>(std::max(Engine::PROFILER_EVENTS_PER_THREAD, 256));
+    ThreadBuffer* buffer = new ThreadBuffer(static_cast<uint32_t>(threads.size()), capacity);
+    buffer->name = name;
+    threads.push_back(buffer);
+    return buffer->threadId;
+}
+
+void Profiler::recordZone(TrackId track, const char* name, uint64_t startNs, uint64_t endNs) {
+    if (!isEnabled()) {
+        return;
+    }
+    ThreadBuffer* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        std::vector<ThreadBuffer*>& threads = registry();
+        if (track >= threads.size()) {
+            return;
+        }
+        buffer = threads[track];
+    }
+    push(*buffer, {name, startNs, endNs});
+}
+
+void Profiler::beginFrame() {
+    const uint64_t startNs = now();
+    const uint64_t frame = g_frameIndex.load(std::memory_order_relaxed);
+    g_frameStarts[frame % kMaxFrames] = startNs;
+    g_frameIndex.store(frame + 1, std::memory_order_relaxed);
+
+    if (Engine::PROFILER_CAPTURE_AT_FRAME > 0 && frame + 1 == static_cast<uint64_t>(Engine::PROFILER_CAPTURE_AT_FRAME)) {
+        requestCapture(Engine::PROFILER_CAPTURE_FRAMES);
+    }
+
+    int frames = 0;
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(g_captureMutex);
+        std::swap(frames, g_captureFrames);
+        path.swap(g_capturePath);
+    }
+    if (frames > 0) {
+        writeCapture(frames, std::move(path), startNs);
+    }
+}
+
+uint64_t Profiler::getFrameIndex() {
+    return g_frameIndex.load(std::memory_order_relaxed);
+}
+
+void Profiler::requestCapture(int frames, std::string path) {
+    std::lock_guard<std::mutex> lock(g_captureMutex);
+    g_captureFrames = std::max(frames, 1);
+    g_capturePath = std::move(path);
+}
+
+} // namespace Profiling
+} // namespace Engine
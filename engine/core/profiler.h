@@ -0,0 +1,88 @@
+// engine/core/profiler.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 0 remove todas as zonas na compilação (as macros não geram código). Definido pelo CMake
+// com a opção ENGINE_PROFILER; sem ela, as zonas ficam compiladas.
+#ifndef ENGINE_PROFILER
+#define ENGINE_PROFILER 1
+#endif
+
+namespace Engine {
+namespace Profiling {
+
+// Profiler de CPU por zonas. Cada zona (ProfileScope / ENGINE_PROFILE_SCOPE) mede do construtor ao
+// destrutor e vai para um anel da thread que a executou, sem trava: os eventos mais antigos são
+// sobrescritos (PROFILER_EVENTS_PER_THREAD). A thread principal marca os frames em beginFrame(); uma
+// captura grava os últimos N frames no formato trace_event do Chrome (chrome://tracing, ui.perfetto.dev),
+// onde a hierarquia aparece pelo aninhamento dos tempos (as zonas filhas ficam dentro da mãe).
+// Os nomes das zonas não são copiados: use literais ou strings que vivam até a captura.
+class Profiler {
+public:
+    Profiler() = delete;
+
+    static bool isEnabled();
+    // Desligado, as zonas só testam a flag (nada é gravado)
+    static void setEnabled(bool enabled);
+
+    // Nome da thread atual no trace (chamar no início da thread)
+    static void setThreadName(const std::string& name);
+
+    // Thread principal, no início de cada frame: marca o limite e grava a captura pedida
+    static void beginFrame();
+    static uint64_t getFrameIndex();
+
+    // Grava os últimos 'frames' frames completos (os que ainda estão nos anéis) no próximo beginFrame.
+    // path vazio: PROFILER_TRACE_DIR/trace_<frame>.json. Qualquer thread.
+    static void requestCapture(int frames, std::string path = {});
+
+    // Relógio das zonas (ns, steady_clock)
+    static uint64_t now();
+
+    // Linha do tempo que não é uma thread (ex.: a GPU), com eventos de tempos já medidos no relógio de now().
+    // Cada trilha deve ter um único escritor.
+    using TrackId = uint32_t;
+    static TrackId createTrack(const std::string& name);
+    static void recordZone(TrackId track, const char* name, uint64_t startNs, uint64_t endNs);
+
+    // Usados por ProfileScope
+    static uint64_t beginZone();
+    static void endZone(const char* name, uint64_t startNs);
+};
+
+// Zona RAII: mede o escopo onde foi declarada
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : m_name(Profiler::isEnabled() ? name : nullptr) {
+        if (m_name) {
+            m_start = Profiler::beginZone();
+        }
+    }
+    ~ProfileScope() {
+        if (m_name) {
+            Profiler::endZone(m_name, m_start);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;
+    uint64_t m_start = 0;
+};
+
+} // namespace Profiling
+} // namespace Engine
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+
+#if ENGINE_PROFILER
+#define ENGINE_PROFILE_SCOPE(name) ::Engine::Profiling::ProfileScope ENGINE_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,40 @@
+// engine/core/worker_pool.cpp
+#include "worker_pool.h"
+#include "jobs.h"
+
+#include <algorithm>
+
+namespace Engine {
+
+WorkerPool& WorkerPool::Get() {
+    static WorkerPool instance;
+    return instance;
+}
+
+size_t WorkerPool::getThreadCount() const {
+    return Jobs::JobSystem::Get().getThreadCount();
+}
+
+size_t WorkerPool::chunkCount(size_t count, size_t grainSize) {
+    grainSize = std::max<size_t>(grainSize, 1);
+    return (count + grainSize - 1) / grainSize;
+}
+
+void WorkerPool::parallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t, size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    grainSize = std::max<size_t>(grainSize, 1);
+    const size_t chunks = chunkCount(count, grainSize);
+
+    // Os blocos são a unidade do sistema de jobs (grão mínimo 1 bloco); o índice segue a faixa, não a thread
+    Jobs::JobSystem::Get().parallelFor(chunks, [&](size_t chunkBegin, size_t chunkEnd)
+    {
+        for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+            const size_t begin = chunk * grainSize;
+            fn(chunk, begin, std::min(begin + grainSize, count));
+        }
+    }, 1);
+}
+
+} // namespace Engine
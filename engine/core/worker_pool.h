@@ -0,0 +1,35 @@
+// engine/core/worker_pool.h
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Engine {
+
+// Laços paralelos com índice de bloco estável, sobre os workers de Jobs::JobSystem (não tem threads
+// próprias). A thread chamadora também executa blocos, então parallelFor nunca fica ociosa esperando;
+// pode ser chamado de dentro de um job e de várias threads ao mesmo tempo.
+class WorkerPool {
+public:
+    static WorkerPool& Get();
+
+    // Threads que executam blocos (workers + thread chamadora)
+    size_t getThreadCount() const;
+
+    // Divide [0, count) em blocos consecutivos de até 'grainSize' elementos e chama
+    // fn(chunkIndex, begin, end) para cada um, em paralelo. Retorna quando todos terminarem.
+    // O índice do bloco é estável (não depende do agendamento), útil para buffers por job.
+    void parallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t, size_t)>& fn);
+
+    // Número de blocos que parallelFor criará para (count, grainSize)
+    static size_t chunkCount(size_t count, size_t grainSize);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+private:
+    WorkerPool() = default;
+    ~WorkerPool() = default;
+};
+
+} // namespace Engine
@@ -0,0 +1,107 @@
+// engine/ecs/component_pool.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "entity.h"
+
+namespace Engine {
+namespace Ecs {
+
+// Interface sem tipo: o Registry remove os componentes de uma entidade destruída sem conhecer T
+class IComponentPool {
+public:
+    virtual ~IComponentPool() = default;
+
+    virtual bool contains(uint32_t entityIndex) const = 0;
+    virtual void remove(uint32_t entityIndex) = 0;
+    virtual size_t size() const = 0;
+};
+
+// Sparse set de um tipo de componente: m_sparse[índice da entidade] aponta para a posição densa, e os
+// componentes ficam contíguos em m_components (uma estrutura de arrays por tipo). Iterar o pool é
+// linear na memória; inserir e remover são O(1) (a remoção move o último elemento para o buraco,
+// então a ordem densa não é estável).
+template <typename T>
+class ComponentPool final : public IComponentPool {
+public:
+    static constexpr uint32_t kAbsent = std::numeric_limits<uint32_t>::max();
+
+    bool contains(uint32_t entityIndex) const override {
+        return entityIndex < m_sparse.size() && m_sparse[entityIndex] != kAbsent;
+    }
+
+    template <typename... Args>
+    T& emplace(Entity entity, Args&&... args) {
+        if (contains(entity.index)) {
+            T& component = m_components[m_sparse[entity.index]];
+            component = T{std::forward<Args>(args)...};
+            return component;
+        }
+        if (entity.index >= m_sparse.size()) {
+            m_sparse.resize(static_cast<size_t>(entity.index) + 1, kAbsent);
+        }
+        m_sparse[entity.index] = static_cast<uint32_t>(m_components.size());
+        m_entities.push_back(entity);
+        m_components.push_back(T{std::forward<Args>(args)...});
+        return m_components.back();
+    }
+
+    void remove(uint32_t entityIndex) override {
+        if (!contains(entityIndex)) {
+            return;
+        }
+        const uint32_t dense = m_sparse[entityIndex];
+        const uint32_t last = static_cast<uint32_t>(m_components.size() - 1);
+        if (dense != last) {
+            m_components[dense] = std::move(m_components[last]);
+            m_entities[dense] = m_entities[last];
+            m_sparse[m_entities[dense].index] = dense;
+        }
+        m_components.pop_back();
+        m_entities.pop_back();
+        m_sparse[entityIndex] = kAbsent;
+    }
+
+    size_t size() const override { return m_components.size(); }
+
+    void clear() {
+        for (const Entity& entity : m_entities) {
+            m_sparse[entity.index] = kAbsent;
+        }
+        m_entities.clear();
+        m_components.clear();
+    }
+
+    void reserve(size_t count) {
+        m_components.reserve(count);
+        m_entities.reserve(count);
+    }
+
+    // Sem verificação: chamar só com contains() verdadeiro
+    T& get(uint32_t entityIndex) { return m_components[m_sparse[entityIndex]]; }
+    const T& get(uint32_t entityIndex) const { return m_components[m_sparse[entityIndex]]; }
+
+    T* tryGet(uint32_t entityIndex) { return contains(entityIndex) ? &m_components[m_sparse[entityIndex]] : nullptr; }
+    const T* tryGet(uint32_t entityIndex) const { return contains(entityIndex) ? &m_components[m_sparse[entityIndex]] : nullptr; }
+
+    // Acesso denso, para sistemas que percorrem o array direto (ou o dividem em faixas entre jobs)
+    Entity entityAt(size_t dense) const { return m_entities[dense]; }
+    T& componentAt(size_t dense) { return m_components[dense]; }
+    const T& componentAt(size_t dense) const { return m_components[dense]; }
+    const std::vector<Entity>& entities() const { return m_entities; }
+    std::vector<T>& components() { return m_components; }
+    const std::vector<T>& components() const { return m_components; }
+
+private:
+    std::vector<uint32_t> m_sparse;  // Índice da entidade -> posição densa (kAbsent se não tem o componente)
+    std::vector<Entity> m_entities;  // Posição densa -> entidade
+    std::vector<T> m_components;     // Posição densa -> componente
+};
+
+} // namespace Ecs
+} // namespace Engine
@@ -0,0 +1,70 @@
+// engine/ecs/components.h
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "entity.h"
+#include "./../render/lod_selector.h" // Para Render::LodState
+
+namespace Engine {
+namespace Asset {
+    class Model;
+}
+namespace Ecs {
+
+// Posição, rotação e escala locais (relativas ao pai, se houver Parent). Quem altera um Transform
+// adiciona TransformDirty; a matriz de mundo em cache fica em TransformHierarchy.
+struct Transform {
+    glm::vec3 position{0.0f};
+    glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::vec3 scale{1.0f};
+
+    glm::mat4 getMatrix() const {
+        glm::mat4 matrix = glm::translate(glm::mat4(1.0f), position);
+        matrix = matrix * glm::mat4_cast(rotation);
+        return glm::scale(matrix, scale);
+    }
+};
+
+// Pai na hierarquia de transformações (sem o componente, a entidade é raiz)
+struct Parent {
+    Entity entity;
+};
+
+// Marca: Transform ou Parent mudou neste frame. TransformHierarchy::update recalcula a subárvore e remove a marca.
+struct TransformDirty {};
+
+// Modelo desenhado pela entidade. O modelo é compartilhável entre entidades; o estado de LOD é por
+// entidade e mutável porque a gravação do frame (const) o atualiza.
+struct MeshRef {
+    std::shared_ptr<Asset::Model> model;
+    mutable std::vector<Render::LodState> lodStates;
+};
+
+// Deslocamento por segundo, integrado na posição pelo sistema de movimento
+struct Velocity {
+    glm::vec3 linear{0.0f};
+};
+
+// Entidade conduzida pelo teclado em relação à câmera (o personagem do jogador)
+struct PlayerControl {
+    float movementSpeed = 5.0f;  // m/s
+    float rotationSpeed = 55.0f; // graus/s
+};
+
+// Nome para logs e ferramentas; fora dos sistemas do frame
+struct Name {
+    std::string value;
+};
+
+// Marca entidades que não se movem durante o jogo: podem entrar em caches (ex.: cascatas de sombra distantes)
+struct StaticTag {};
+
+} // namespace Ecs
+} // namespace Engine
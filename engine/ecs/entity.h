@@ -0,0 +1,24 @@
+// engine/ecs/entity.h
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace Engine {
+namespace Ecs {
+
+// Identificador de entidade: índice no Registry + geração. Destruir a entidade incrementa a geração do
+// índice, então cópias antigas deixam de valer mesmo depois que o índice for reaproveitado.
+struct Entity {
+    uint32_t index = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0;
+
+    bool isNull() const { return index == std::numeric_limits<uint32_t>::max(); }
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+constexpr Entity kNullEntity{};
+
+} // namespace Ecs
+} // namespace Engine
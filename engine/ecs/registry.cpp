@@ -0,0 +1,47 @@
+// engine/ecs/registry.cpp
+#include "registry.h"
+
+#include <atomic>
+
+namespace Engine {
+namespace Ecs {
+
+size_t Registry::nextTypeId() {
+    static std::atomic<size_t> counter{0};
+    return counter.fetch_add(1);
+}
+
+Entity Registry::create() {
+    Entity entity;
+    if (!m_freeIndices.empty()) {
+        entity.index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    } else {
+        entity.index = static_cast<uint32_t>(m_generations.size());
+        m_generations.push_back(0);
+        m_alive.push_back(0);
+    }
+    entity.generation = m_generations[entity.index];
+    m_alive[entity.index] = 1;
+    m_aliveCount++;
+    return entity;
+}
+
+void Registry::destroy(Entity entity) {
+    if (!isAlive(entity)) {
+        return;
+    }
+    for (const std::unique_ptr<IComponentPool>& pool : m_pools) {
+        if (pool) {
+            pool->remove(entity.index);
+        }
+    }
+    m_generations[entity.index]++;
+    m_alive[entity.index] = 0;
+    m_freeIndices.push_back(entity.index);
+    m_aliveCount--;
+    m_destroyVersion++;
+}
+
+} // namespace Ecs
+} // namespace Engine
@@ -0,0 +1,140 @@
+// engine/ecs/registry.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "component_pool.h"
+#include "entity.h"
+
+namespace Engine {
+namespace Ecs {
+
+// Dono das entidades e de um ComponentPool por tipo de componente. Não é thread-safe: criar, destruir e
+// adicionar/remover componentes só na thread principal. Ler e alterar componentes já existentes de
+// entidades distintas em paralelo (ex.: jobs sobre faixas de um pool) é seguro.
+class Registry {
+public:
+    Registry() = default;
+    ~Registry() = default;
+
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    Entity create();
+    // Remove todos os componentes e invalida o identificador; ignorado se a entidade já não existe
+    void destroy(Entity entity);
+    bool isAlive(Entity entity) const {
+        return entity.index < m_generations.size() && m_generations[entity.index] == entity.generation && m_alive[entity.index];
+    }
+    size_t getAliveCount() const { return m_aliveCount; }
+    // Incrementado a cada destroy(): sistemas com índices próprios (ex.: TransformHierarchy) detectam remoções
+    uint64_t getDestroyVersion() const { return m_destroyVersion; }
+
+    template <typename T, typename... Args>
+    T& add(Entity entity, Args&&... args) {
+        return getPool<T>().emplace(entity, std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void remove(Entity entity) {
+        if (ComponentPool<T>* pool = findPool<T>()) {
+            pool->remove(entity.index);
+        }
+    }
+
+    template <typename T>
+    bool has(Entity entity) const {
+        const ComponentPool<T>* pool = findPool<T>();
+        return pool && pool->contains(entity.index);
+    }
+
+    // Sem verificação: a entidade precisa ter o componente
+    template <typename T>
+    T& get(Entity entity) { return findPool<T>()->get(entity.index); }
+    template <typename T>
+    const T& get(Entity entity) const { return findPool<T>()->get(entity.index); }
+
+    template <typename T>
+    T* tryGet(Entity entity) {
+        ComponentPool<T>* pool = findPool<T>();
+        return pool ? pool->tryGet(entity.index) : nullptr;
+    }
+    template <typename T>
+    const T* tryGet(Entity entity) const {
+        const ComponentPool<T>* pool = findPool<T>();
+        return pool ? pool->tryGet(entity.index) : nullptr;
+    }
+
+    // Pool do tipo (criado vazio se ainda não existe)
+    template <typename T>
+    ComponentPool<T>& getPool() {
+        const size_t id = typeId<T>();
+        if (id >= m_pools.size()) {
+            m_pools.resize(id + 1);
+        }
+        if (!m_pools[id]) {
+            m_pools[id] = std::make_unique<ComponentPool<T>>();
+        }
+        return static_cast<ComponentPool<T>&>(*m_pools[id]);
+    }
+
+    // Nulo se nenhum componente do tipo foi adicionado
+    template <typename T>
+    ComponentPool<T>* findPool() {
+        const size_t id = typeId<T>();
+        return id < m_pools.size() ? static_cast<ComponentPool<T>*>(m_pools[id].get()) : nullptr;
+    }
+    template <typename T>
+    const ComponentPool<T>* findPool() const {
+        const size_t id = typeId<T>();
+        return id < m_pools.size() ? static_cast<const ComponentPool<T>*>(m_pools[id].get()) : nullptr;
+    }
+
+    // Chama fn(entity, First&, Rest&...) para cada entidade com todos os componentes. Percorre o array
+    // denso do primeiro tipo; os demais são buscados pelo sparse set. Se os pools foram preenchidos na
+    // mesma ordem, essas buscas também são sequenciais. Coloque primeiro o tipo mais raro.
+    // Não adicionar nem remover componentes dos tipos iterados dentro de fn.
+    template <typename First, typename... Rest, typename Fn>
+    void each(Fn&& fn) {
+        ComponentPool<First>* first = findPool<First>();
+        if (!first) {
+            return;
+        }
+        std::tuple<ComponentPool<Rest>*...> rest{findPool<Rest>()...};
+        if (!std::apply([](auto*... pools) { return (true && ... && (pools != nullptr)); }, rest)) {
+            return;
+        }
+        const size_t count = first->size();
+        for (size_t dense = 0; dense < count; ++dense) {
+            const Entity entity = first->entityAt(dense);
+            if (!(true && ... && std::get<ComponentPool<Rest>*>(rest)->contains(entity.index))) {
+                continue;
+            }
+            fn(entity, first->componentAt(dense), std::get<ComponentPool<Rest>*>(rest)->get(entity.index)...);
+        }
+    }
+
+    // Identificador do tipo de componente (índice do pool); SystemScheduler compara acessos por ele
+    template <typename T>
+    static size_t typeId() {
+        static const size_t id = nextTypeId();
+        return id;
+    }
+
+private:
+    static size_t nextTypeId();
+
+    std::vector<std::unique_ptr<IComponentPool>> m_pools; // Por typeId
+    std::vector<uint32_t> m_generations;                  // Por índice de entidade
+    std::vector<uint8_t> m_alive;
+    std::vector<uint32_t> m_freeIndices;
+    size_t m_aliveCount = 0;
+    uint64_t m_destroyVersion = 0;
+};
+
+} // namespace Ecs
+} // namespace Engine
@@ -0,0 +1,158 @@
+// engine/ecs/system_scheduler.cpp
+#include "system_scheduler.h"
+#include "./../core/jobs.h"
+#include "./../core/log.h"
+#include "./../core/profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+
+namespace Engine {
+namespace Ecs {
+
+void CommandBuffer::apply(Registry& registry) {
+    for (const Command& command : m_commands) {
+        command.fn(registry, command.entity);
+    }
+    clear();
+}
+
+SystemScheduler::SystemBuilder SystemScheduler::addSystem(std::string name) {
+    m_systems.push_back(std::make_unique<System>());
+    m_systems.back()->name = std::move(name);
+    m_scheduleValid = false;
+    return SystemBuilder(this, m_systems.back().get());
+}
+
+bool SystemScheduler::conflicts(const System& a, const System& b) {
+    if (a.exclusive || b.exclusive) {
+        return true;
+    }
+    auto overlaps = [](const std::vector<size_t>& left, const std::vector<size_t>& right) {
+        return std::any_of(left.begin(), left.end(), [&](size_t id) { return std::find(right.begin(), right.end(), id) != right.end(); });
+    };
+    return overlaps(a.writes, b.writes) || overlaps(a.writes, b.reads) || overlaps(a.reads, b.writes);
+}
+
+void SystemScheduler::buildSchedule() {
+    // Onda de cada sistema: logo depois da última onda de um sistema anterior com que ele conflita
+    m_waves.clear();
+    for (size_t i = 0; i < m_systems.size(); ++i) {
+        System& system = *m_systems[i];
+        system.wave = 0;
+        for (size_t j = 0; j < i; ++j) {
+            if (conflicts(system, *m_systems[j])) {
+                system.wave = std::max(system.wave, m_systems[j]->wave + 1);
+            }
+        }
+        if (system.wave >= m_waves.size()) {
+            m_waves.resize(static_cast<size_t>(system.wave) + 1);
+        }
+        m_waves[system.wave].push_back(&system);
+    }
+    m_scheduleValid = true;
+
+    std::string layout;
+    for (size_t wave = 0; wave < m_waves.size(); ++wave) {
+        layout += wave > 0 ? " | " : "";
+        for (size_t k = 0; k < m_waves[wave].size(); ++k) {
+            layout += (k > 0 ? ", " : "") + m_waves[wave][k]->name;
+        }
+    }
+    Engine::Log::Info(std::format("SystemScheduler: {} sistema(s) em {} onda(s): {}.", m_systems.size(), m_waves.size(), layout));
+}
+
+void SystemScheduler::runSystem(System& system, Registry& registry, float deltaTime) {
+    // O nome do sistema vive enquanto o scheduler existir
+    ENGINE_PROFILE_SCOPE(system.name.c_str());
+    if (system.fn) {
+        SystemContext context{registry, deltaTime, system.commands};
+        system.fn(context);
+        return;
+    }
+    if (!system.rangeFn) {
+        return;
+    }
+
+    const size_t count = system.count(registry);
+    if (count == 0) {
+        return;
+    }
+    if (m_deterministic) {
+        SystemContext context{registry, deltaTime, system.commands};
+        system.rangeFn(context, 0, count);
+        return;
+    }
+
+    // Cada faixa grava num buffer próprio; só as que geraram comandos entram na lista (sob a trava)
+    Engine::Jobs::JobSystem::Get().parallelFor(count, [&](size_t begin, size_t end) {
+        RangeCommands range{begin, CommandBuffer{}};
+        SystemContext context{registry, deltaTime, range.commands};
+        system.rangeFn(context, begin, end);
+        if (!range.commands.empty()) {
+            std::lock_guard<std::mutex> lock(system.rangeMutex);
+            system.rangeCommands.push_back(std::move(range));
+        }
+    }, system.minGrain);
+}
+
+size_t SystemScheduler::applyCommands(System& system, Registry& registry) {
+    size_t applied = system.commands.size();
+    system.commands.apply(registry);
+
+    // Ordem das faixas no pool, não de término dos jobs
+    std::sort(system.rangeCommands.begin(), system.rangeCommands.end(),
+              [](const RangeCommands& a, const RangeCommands& b) { return a.begin < b.begin; });
+    for (RangeCommands& range : system.rangeCommands) {
+        applied += range.commands.size();
+        range.commands.apply(registry);
+    }
+    system.rangeCommands.clear();
+    return applied;
+}
+
+void SystemScheduler::run(Registry& registry, float deltaTime) {
+    auto runStart = std::chrono::steady_clock::now();
+    if (!m_scheduleValid) {
+        buildSchedule();
+    }
+    m_stats.commands = 0;
+
+    for (std::vector<System*>& wave : m_waves) {
+        if (m_deterministic || wave.size() == 1) {
+            for (System* system : wave) {
+                runSystem(*system, registry, deltaTime);
+            }
+        } else {
+            // Um job por sistema da onda; a thread chamadora roda o primeiro e depois ajuda com o resto
+            Engine::Jobs::JobSystem& jobs = Engine::Jobs::JobSystem::Get();
+            Engine::Jobs::Counter counter;
+            for (size_t k = 1; k < wave.size(); ++k) {
+                System* system = wave[k];
+                jobs.run([this, system, &registry, deltaTime]() { runSystem(*system, registry, deltaTime); }, &counter);
+            }
+            runSystem(*wave[0], registry, deltaTime);
+            jobs.wait(counter);
+        }
+
+        // Mudanças estruturais da onda, na thread principal e na ordem de declaração
+        for (System* system : wave) {
+            m_stats.commands += applyCommands(*system, registry);
+        }
+    }
+
+    m_stats.systems = m_systems.size();
+    m_stats.waves = m_waves.size();
+    m_stats.deterministic = m_deterministic;
+    m_stats.updateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - runStart).count();
+}
+
+void SystemScheduler::logReport() const {
+    Engine::Log::Info(std::format("SystemScheduler: {} sistema(s) em {} onda(s){}, {} comandos estruturais, {:.3f} ms no último passo.",
+                                  m_stats.systems, m_stats.waves, m_stats.deterministic ? " (determinístico)" : "", m_stats.commands,
+                                  m_stats.updateMs));
+}
+
+} // namespace Ecs
+} // namespace Engine
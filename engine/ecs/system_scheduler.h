@@ -0,0 +1,190 @@
+// engine/ecs/system_scheduler.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "entity.h"
+#include "registry.h"
+#include "./../memory/frame_arena.h"
+
+namespace Engine {
+namespace Ecs {
+
+// Mudanças estruturais (adicionar/remover componentes, destruir entidades) gravadas durante um sistema
+// e aplicadas pelo SystemScheduler na thread principal, no fim da onda, em ordem fixa. Sistemas que
+// rodam em paralelo não podem mexer nos pools diretamente. Os comandos ficam na FrameArena (sem heap por passo).
+class CommandBuffer {
+public:
+    // Componente construído com o valor padrão (marcas como TransformDirty)
+    template <typename T>
+    void add(Entity entity) {
+        m_commands.push_back({entity, [](Registry& registry, Entity target) {
+                                  if (registry.isAlive(target)) {
+                                      registry.add<T>(target);
+                                  }
+                              }});
+    }
+    template <typename T>
+    void remove(Entity entity) {
+        m_commands.push_back({entity, [](Registry& registry, Entity target) { registry.remove<T>(target); }});
+    }
+    void destroy(Entity entity) {
+        m_commands.push_back({entity, [](Registry& registry, Entity target) { registry.destroy(target); }});
+    }
+
+    void apply(Registry& registry);
+    void clear() { CommandList().swap(m_commands); }
+    bool empty() const { return m_commands.empty(); }
+    size_t size() const { return m_commands.size(); }
+
+private:
+    struct Command {
+        Entity entity;
+        void (*fn)(Registry&, Entity);
+    };
+    // A capacidade não pode sobreviver ao frame: clear() e apply() devolvem o buffer
+    using CommandList = std::vector<Command, Memory::FrameAllocator<Command>>;
+    CommandList m_commands;
+};
+
+// O que um sistema recebe a cada execução
+struct SystemContext {
+    Registry& registry;
+    float deltaTime;
+    CommandBuffer& commands;
+};
+
+// Contadores do último run (logReport)
+struct SchedulerStats {
+    uint64_t systems = 0;
+    uint64_t waves = 0;       // Grupos de sistemas sem conflito, executados um depois do outro
+    uint64_t commands = 0;    // Comandos estruturais aplicados
+    bool deterministic = false;
+    double updateMs = 0.0;
+};
+
+// Executa os sistemas de jogo de um passo. Cada sistema declara os componentes que lê e escreve; dois
+// sistemas conflitam se um escreve algo que o outro lê ou escreve. Os sistemas são agrupados em ondas
+// respeitando a ordem de declaração entre os que conflitam: os de uma mesma onda rodam ao mesmo tempo em
+// jobs, e sistemas de faixa (runParallel) são divididos entre os workers com Jobs::parallelFor.
+// Os comandos estruturais de cada onda são aplicados no fim dela, na ordem dos sistemas e das faixas,
+// então o resultado não depende de quantos workers existem nem de quem pegou qual job.
+class SystemScheduler {
+    struct System;
+
+public:
+    using SystemFunction = std::function<void(SystemContext&)>;
+    // Faixa [begin, end) do array denso do pool que conduz o sistema
+    using RangeFunction = std::function<void(SystemContext&, size_t, size_t)>;
+
+    class SystemBuilder {
+    public:
+        template <typename... T>
+        SystemBuilder& reads() {
+            (m_system->reads.push_back(Registry::typeId<T>()), ...);
+            m_scheduler->m_scheduleValid = false;
+            return *this;
+        }
+        // Inclui os tipos adicionados/removidos via CommandBuffer (a mudança só aparece para a onda seguinte)
+        template <typename... T>
+        SystemBuilder& writes() {
+            (m_system->writes.push_back(Registry::typeId<T>()), ...);
+            m_scheduler->m_scheduleValid = false;
+            return *this;
+        }
+        // Conflita com todos: roda sozinho e pode alterar o Registry diretamente
+        SystemBuilder& exclusive() {
+            m_system->exclusive = true;
+            m_scheduler->m_scheduleValid = false;
+            return *this;
+        }
+
+        // Uma chamada por passo, numa thread só
+        SystemBuilder& run(SystemFunction fn) {
+            m_system->fn = std::move(fn);
+            return *this;
+        }
+        // Chama fn sobre faixas do pool de Driver (lido implicitamente), com pelo menos 'minGrain' entidades por job
+        template <typename Driver>
+        SystemBuilder& runParallel(RangeFunction fn, size_t minGrain = 256) {
+            m_system->rangeFn = std::move(fn);
+            m_system->minGrain = minGrain;
+            m_system->count = [](const Registry& registry) -> size_t {
+                const ComponentPool<Driver>* pool = registry.findPool<Driver>();
+                return pool ? pool->size() : 0;
+            };
+            return reads<Driver>();
+        }
+
+    private:
+        friend class SystemScheduler;
+        SystemBuilder(SystemScheduler* scheduler, System* system) : m_scheduler(scheduler), m_system(system) {}
+
+        SystemScheduler* m_scheduler;
+        System* m_system;
+    };
+
+    SystemScheduler() = default;
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    // Sistemas executam na ordem de declaração quando conflitam
+    SystemBuilder addSystem(std::string name);
+
+    // Na thread principal, uma vez por passo da simulação
+    void run(Registry& registry, float deltaTime);
+
+    // Determinístico: sistemas um depois do outro na thread chamadora e cada sistema de faixa numa faixa
+    // só; o resultado não depende do pool de workers nem de sistemas que (por engano) leem o que outro
+    // escreve sem declarar. Para testes de replay e para comparar com o modo paralelo.
+    void setDeterministic(bool deterministic) { m_deterministic = deterministic; }
+    bool isDeterministic() const { return m_deterministic; }
+
+    size_t getSystemCount() const { return m_systems.size(); }
+    const SchedulerStats& getStats() const { return m_stats; }
+    void logReport() const;
+
+private:
+    struct RangeCommands {
+        size_t begin;
+        CommandBuffer commands;
+    };
+
+    struct System {
+        std::string name;
+        std::vector<size_t> reads;
+        std::vector<size_t> writes;
+        bool exclusive = false;
+
+        SystemFunction fn;
+        RangeFunction rangeFn;
+        size_t (*count)(const Registry&) = nullptr;
+        size_t minGrain = 256;
+
+        uint32_t wave = 0;
+        CommandBuffer commands;                // Do run() serial
+        std::mutex rangeMutex;
+        std::vector<RangeCommands> rangeCommands; // Das faixas com comandos, ordenadas pelo início na aplicação
+    };
+
+    static bool conflicts(const System& a, const System& b);
+    void buildSchedule();
+    void runSystem(System& system, Registry& registry, float deltaTime);
+    size_t applyCommands(System& system, Registry& registry);
+
+    std::vector<std::unique_ptr<System>> m_systems;
+    std::vector<std::vector<System*>> m_waves;
+    bool m_scheduleValid = false;
+    bool m_deterministic = false;
+    SchedulerStats m_stats;
+};
+
+} // namespace Ecs
+} // namespace Engine
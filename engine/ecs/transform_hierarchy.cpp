@@ -0,0 +1,415 @@
+// engine/ecs/transform_hierarchy.cpp
+#include "transform_hierarchy.h"
+#include "components.h"
+#include "registry.h"
+#include "./../core/log.h"
+#include "./../core/profiler.h"
+#include "./../memory/scratch_arena.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_TRANSFORM_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace Engine {
+namespace Ecs {
+
+namespace {
+
+    // Posição, rotação e escala de uma faixa em arrays separados (um por componente escalar)
+    enum SoaChannel { PX = 0, PY, PZ, QX, QY, QZ, QW, SX, SY, SZ, kSoaChannelCount };
+
+    // Mesma matriz de Transform::getMatrix (translate * mat4_cast * scale), escrita coluna a coluna
+    void composeLocalScalar(const float* const* soa, size_t i, glm::mat4& out) {
+        const float x = soa[QX][i], y = soa[QY][i], z = soa[QZ][i], w = soa[QW][i];
+        const float xx = x * x * 2.0f, yy = y * y * 2.0f, zz = z * z * 2.0f;
+        const float xy = x * y * 2.0f, xz = x * z * 2.0f, yz = y * z * 2.0f;
+        const float wx = w * x * 2.0f, wy = w * y * 2.0f, wz = w * z * 2.0f;
+        const float sx = soa[SX][i], sy = soa[SY][i], sz = soa[SZ][i];
+        out[0] = glm::vec4((1.0f - (yy + zz)) * sx, (xy + wz) * sx, (xz - wy) * sx, 0.0f);
+        out[1] = glm::vec4((xy - wz) * sy, (1.0f - (xx + zz)) * sy, (yz + wx) * sy, 0.0f);
+        out[2] = glm::vec4((xz + wy) * sz, (yz - wx) * sz, (1.0f - (xx + yy)) * sz, 0.0f);
+        out[3] = glm::vec4(soa[PX][i], soa[PY][i], soa[PZ][i], 1.0f);
+    }
+
+    // Matrizes locais de 'count' entidades: 4 por iteração com SSE (uma entidade por lane), resto escalar
+    void composeLocalMatrices(const float* const* soa, size_t count, glm::mat4* out) {
+        size_t i = 0;
+#if ENGINE_TRANSFORM_SSE
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        for (; i + 4 <= count; i += 4) {
+            const __m128 x = _mm_loadu_ps(soa[QX] + i);
+            const __m128 y = _mm_loadu_ps(soa[QY] + i);
+            const __m128 z = _mm_loadu_ps(soa[QZ] + i);
+            const __m128 w = _mm_loadu_ps(soa[QW] + i);
+            const __m128 x2 = _mm_mul_ps(x, two);
+            const __m128 y2 = _mm_mul_ps(y, two);
+            const __m128 z2 = _mm_mul_ps(z, two);
+            const __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+            const __m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+            const __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+            const __m128 sx = _mm_loadu_ps(soa[SX] + i);
+            const __m128 sy = _mm_loadu_ps(soa[SY] + i);
+            const __m128 sz = _mm_loadu_ps(soa[SZ] + i);
+
+            // Cada registrador guarda um elemento da matriz para as 4 entidades; a transposta vira
+            // uma coluna por entidade
+            __m128 columns[4][4] = {
+                {_mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx), _mm_mul_ps(_mm_add_ps(xy, wz), sx),
+                 _mm_mul_ps(_mm_sub_ps(xz, wy), sx), _mm_setzero_ps()},
+                {_mm_mul_ps(_mm_sub_ps(xy, wz), sy), _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy),
+                 _mm_mul_ps(_mm_add_ps(yz, wx), sy), _mm_setzero_ps()},
+                {_mm_mul_ps(_mm_add_ps(xz, wy), sz), _mm_mul_ps(_mm_sub_ps(yz, wx), sz),
+                 _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz), _mm_setzero_ps()},
+                {_mm_loadu_ps(soa[PX] + i), _mm_loadu_ps(soa[PY] + i), _mm_loadu_ps(soa[PZ] + i), one},
+            };
+            for (int column = 0; column < 4; ++column) {
+                __m128* c = columns[column];
+                _MM_TRANSPOSE4_PS(c[0], c[1], c[2], c[3]);
+                for (int lane = 0; lane < 4; ++lane) {
+                    _mm_storeu_ps(&out[i + static_cast<size_t>(lane)][column][0], c[lane]);
+                }
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            composeLocalScalar(soa, i, out[i]);
+        }
+    }
+
+    // out = parent * local (colunas contíguas, como o glm guarda)
+    void multiplyMatrix(const glm::mat4& parent, const glm::mat4& local, glm::mat4& out) {
+#if ENGINE_TRANSFORM_SSE
+        const __m128 p0 = _mm_loadu_ps(&parent[0][0]);
+        const __m128 p1 = _mm_loadu_ps(&parent[1][0]);
+        const __m128 p2 = _mm_loadu_ps(&parent[2][0]);
+        const __m128 p3 = _mm_loadu_ps(&parent[3][0]);
+        for (int column = 0; column < 4; ++column) {
+            __m128 result = _mm_mul_ps(p0, _mm_set1_ps(local[column][0]));
+            result = _mm_add_ps(result, _mm_mul_ps(p1, _mm_set1_ps(local[column][1])));
+            result = _mm_add_ps(result, _mm_mul_ps(p2, _mm_set1_ps(local[column][2])));
+            result = _mm_add_ps(result, _mm_mul_ps(p3, _mm_set1_ps(local[column][3])));
+            _mm_storeu_ps(&out[column][0], result);
+        }
+#else
+        out = parent * local;
+#endif
+    }
+
+} // namespace
+
+const glm::mat4 TransformHierarchy::kIdentity(1.0f);
+
+float TransformHierarchy::getMaxScale(const glm::mat4& matrix) {
+    const float x = glm::dot(glm::vec3(matrix[0]), glm::vec3(matrix[0]));
+    const float y = glm::dot(glm::vec3(matrix[1]), glm::vec3(matrix[1]));
+    const float z = glm::dot(glm::vec3(matrix[2]), glm::vec3(matrix[2]));
+    return std::sqrt(std::max({x, y, z}));
+}
+
+glm::mat4 TransformHierarchy::getRenderMatrix(Entity entity, float alpha) const {
+    const uint32_t node = findNode(entity);
+    if (node == kNoNode) {
+        return kIdentity;
+    }
+    if (m_moveState[node] != MoveMoving || alpha >= 1.0f) {
+        return m_world[node];
+    }
+    const glm::mat4& previous = m_previous[node];
+    const glm::mat4& current = m_world[node];
+    return glm::mat4(glm::mix(previous[0], current[0], alpha), glm::mix(previous[1], current[1], alpha),
+                     glm::mix(previous[2], current[2], alpha), glm::mix(previous[3], current[3], alpha));
+}
+
+void TransformHierarchy::update(Registry& registry) {
+    ENGINE_PROFILE_SCOPE("TransformHierarchy::update");
+    auto updateStart = std::chrono::steady_clock::now();
+    m_stats.dirtyEntities = 0;
+    m_stats.recomputed = 0;
+    m_pendingEntities.clear();
+    m_dirtyNodes.clear();
+
+    // O estado atual vira o anterior: só os nós que se moveram no último update têm algo a copiar
+    for (const uint32_t node : m_movedNodes) {
+        m_previous[node] = m_world[node];
+        m_moveState[node] = MoveStill;
+    }
+    m_movedNodes.clear();
+
+    // Entidades destruídas deixam nós órfãos: só uma reordenação os descarta
+    bool structureChanged = registry.getDestroyVersion() != m_destroyVersion;
+    m_destroyVersion = registry.getDestroyVersion();
+
+    ComponentPool<TransformDirty>* dirtyPool = registry.findPool<TransformDirty>();
+    if (dirtyPool) {
+        for (const Entity entity : dirtyPool->entities()) {
+            if (!registry.has<Transform>(entity)) {
+                continue;
+            }
+            m_pendingEntities.push_back(entity);
+
+            const Parent* parent = registry.tryGet<Parent>(entity);
+            const Entity parentEntity = parent && registry.isAlive(parent->entity) ? parent->entity : kNullEntity;
+            const uint32_t node = findNode(entity);
+            if (node == kNoNode) {
+                // Raiz nova vai para o fim (continua em ordem de profundidade); filho novo exige reordenar
+                if (parentEntity.isNull() && !structureChanged) {
+                    appendRoot(entity);
+                } else {
+                    structureChanged = true;
+                }
+            } else {
+                const uint32_t parentNode = m_parents[node];
+                const Entity currentParent = parentNode == kNoNode ? kNullEntity : m_entities[parentNode];
+                if (currentParent != parentEntity) {
+                    structureChanged = true;
+                }
+            }
+        }
+        dirtyPool->clear();
+    }
+    m_stats.dirtyEntities = m_pendingEntities.size();
+
+    if (structureChanged) {
+        rebuild(registry);
+    }
+
+    for (const Entity entity : m_pendingEntities) {
+        const uint32_t node = findNode(entity);
+        if (node != kNoNode && !m_dirty[node]) {
+            m_dirty[node] = 1;
+            m_dirtyNodes.push_back(node);
+        }
+    }
+
+    // Subárvores em ordem crescente: um nó dentro de uma faixa já recalculada é pulado, e o pai de
+    // cada faixa (fora dela, com índice menor) já está válido
+    std::sort(m_dirtyNodes.begin(), m_dirtyNodes.end());
+    uint32_t coveredEnd = 0;
+    for (const uint32_t node : m_dirtyNodes) {
+        m_dirty[node] = 0;
+        if (node < coveredEnd) {
+            continue;
+        }
+        coveredEnd = m_subtreeEnd[node];
+        computeRange(registry, node, coveredEnd);
+        m_stats.recomputed += coveredEnd - node;
+    }
+
+    m_stats.nodes = m_entities.size();
+    m_stats.updateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+}
+
+void TransformHierarchy::logReport() const {
+    Engine::Log::Info(std::format("TransformHierarchy: {} nós, {} marcados e {} matrizes recalculadas no último update ({:.3f} ms), {} reordenações.",
+                                  m_stats.nodes, m_stats.dirtyEntities, m_stats.recomputed, m_stats.updateMs, m_stats.rebuilds));
+}
+
+void TransformHierarchy::appendRoot(Entity entity) {
+    const uint32_t node = static_cast<uint32_t>(m_entities.size());
+    m_entities.push_back(entity);
+    m_parents.push_back(kNoNode);
+    m_subtreeEnd.push_back(node + 1);
+    m_world.push_back(kIdentity);
+    m_dirty.push_back(0);
+    m_previous.push_back(kIdentity);
+    m_moveState.push_back(MoveFresh);
+    if (entity.index >= m_nodeOf.size()) {
+        m_nodeOf.resize(static_cast<size_t>(entity.index) + 1, kNoNode);
+    }
+    m_nodeOf[entity.index] = node;
+}
+
+void TransformHierarchy::rebuild(Registry& registry) {
+    m_stats.rebuilds++;
+
+    // Temporários da reordenação na arena da thread; só os arrays finais vão para o heap
+    Memory::ScratchScope scratch;
+
+    // Candidatos: nós antigos ainda válidos, depois as entidades novas (na ordem em que foram marcadas)
+    Memory::ScratchVector<Entity> candidates;
+    Memory::ScratchVector<uint32_t> oldNode;
+    candidates.reserve(m_entities.size() + m_pendingEntities.size());
+    oldNode.reserve(candidates.capacity());
+    for (uint32_t node = 0; node < m_entities.size(); ++node) {
+        if (registry.isAlive(m_entities[node]) && registry.has<Transform>(m_entities[node])) {
+            candidates.push_back(m_entities[node]);
+            oldNode.push_back(node);
+        }
+    }
+    for (const Entity entity : m_pendingEntities) {
+        if (findNode(entity) == kNoNode) {
+            candidates.push_back(entity);
+            oldNode.push_back(kNoNode);
+        }
+    }
+
+    const size_t count = candidates.size();
+    uint32_t maxIndex = 0;
+    for (const Entity entity : candidates) {
+        maxIndex = std::max(maxIndex, entity.index);
+    }
+    Memory::ScratchVector<uint32_t> candidateOf(count > 0 ? static_cast<size_t>(maxIndex) + 1 : 0, kNoNode);
+    for (uint32_t c = 0; c < count; ++c) {
+        candidateOf[candidates[c].index] = c;
+    }
+
+    // Pai de cada candidato (precisa estar vivo e na hierarquia) e filhos em listas compactas
+    Memory::ScratchVector<uint32_t> parentOf(count, kNoNode);
+    Memory::ScratchVector<uint32_t> childStart(count + 1, 0);
+    for (uint32_t c = 0; c < count; ++c) {
+        const Parent* parent = registry.tryGet<Parent>(candidates[c]);
+        if (parent && registry.isAlive(parent->entity) && parent->entity.index < candidateOf.size() &&
+            candidateOf[parent->entity.index] != kNoNode) {
+            parentOf[c] = candidateOf[parent->entity.index];
+            childStart[parentOf[c] + 1]++;
+        }
+    }
+    for (size_t c = 0; c < count; ++c) {
+        childStart[c + 1] += childStart[c];
+    }
+    Memory::ScratchVector<uint32_t> children(childStart[count]);
+    Memory::ScratchVector<uint32_t> childFill(childStart.begin(), childStart.end() - 1);
+    for (uint32_t c = 0; c < count; ++c) {
+        if (parentOf[c] != kNoNode) {
+            children[childFill[parentOf[c]]++] = c;
+        }
+    }
+
+    std::vector<Entity> entities(count);
+    std::vector<uint32_t> parents(count, kNoNode);
+    std::vector<uint32_t> subtreeEnd(count, 0);
+    std::vector<glm::mat4> world(count, kIdentity);
+    std::vector<uint8_t> dirty(count, 0);
+    std::vector<glm::mat4> previousWorld(count, kIdentity);
+    std::vector<uint8_t> moveState(count, MoveFresh);
+    Memory::ScratchVector<uint32_t> newNode(count, kNoNode);
+    m_dirtyNodes.clear();
+
+    // Busca em profundidade iterativa; o bit alto na pilha marca a saída do nó (fim da subárvore)
+    constexpr uint32_t kExitBit = 0x80000000u;
+    Memory::ScratchVector<uint32_t> stack;
+    stack.reserve(64);
+    uint32_t next = 0;
+    auto visit = [&](uint32_t root) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const uint32_t item = stack.back();
+            stack.pop_back();
+            if (item & kExitBit) {
+                subtreeEnd[newNode[item & ~kExitBit]] = next;
+                continue;
+            }
+            const uint32_t node = next++;
+            newNode[item] = node;
+            entities[node] = candidates[item];
+            parents[node] = parentOf[item] != kNoNode ? newNode[parentOf[item]] : kNoNode;
+
+            // Matriz antiga continua válida se o pai não mudou; senão a subárvore é recalculada
+            const uint32_t previous = oldNode[item];
+            if (previous != kNoNode) {
+                // Pai trocado também interpola: a subárvore desliza da posição antiga para a nova
+                previousWorld[node] = m_world[previous];
+                moveState[node] = MoveStill;
+            }
+            const Entity previousParent = previous != kNoNode && m_parents[previous] != kNoNode ? m_entities[m_parents[previous]] : kNullEntity;
+            const Entity currentParent = parents[node] != kNoNode ? entities[parents[node]] : kNullEntity;
+            if (previous != kNoNode && previousParent == currentParent) {
+                world[node] = m_world[previous];
+            } else {
+                dirty[node] = 1;
+                m_dirtyNodes.push_back(node);
+            }
+
+            stack.push_back(item | kExitBit);
+            for (uint32_t k = childStart[item + 1]; k > childStart[item]; --k) {
+                stack.push_back(children[k - 1]); // Ordem inversa: o primeiro filho sai antes
+            }
+        }
+    };
+    for (uint32_t c = 0; c < count; ++c) {
+        if (parentOf[c] == kNoNode) {
+            visit(c);
+        }
+    }
+    // Ciclos (ninguém do grupo é raiz): o primeiro nó não visitado vira raiz
+    for (uint32_t c = 0; c < count; ++c) {
+        if (newNode[c] == kNoNode) {
+            Engine::Log::Warn(std::format("TransformHierarchy: ciclo de pais na entidade {}; tratada como raiz.", candidates[c].index));
+            parentOf[c] = kNoNode;
+            visit(c);
+        }
+    }
+
+    m_entities = std::move(entities);
+    m_parents = std::move(parents);
+    m_subtreeEnd = std::move(subtreeEnd);
+    m_world = std::move(world);
+    m_dirty = std::move(dirty);
+    m_previous = std::move(previousWorld);
+    m_moveState = std::move(moveState);
+    std::fill(m_nodeOf.begin(), m_nodeOf.end(), kNoNode);
+    for (uint32_t node = 0; node < m_entities.size(); ++node) {
+        const uint32_t index = m_entities[node].index;
+        if (index >= m_nodeOf.size()) {
+            m_nodeOf.resize(static_cast<size_t>(index) + 1, kNoNode);
+        }
+        m_nodeOf[index] = node;
+    }
+}
+
+void TransformHierarchy::computeRange(Registry& registry, uint32_t begin, uint32_t end) {
+    const size_t count = end - begin;
+    m_soa.resize(count * kSoaChannelCount);
+    float* channels[kSoaChannelCount];
+    for (size_t channel = 0; channel < kSoaChannelCount; ++channel) {
+        channels[channel] = m_soa.data() + channel * count;
+    }
+
+    // Coleta do Transform de cada entidade para os arrays da faixa
+    const ComponentPool<Transform>* transforms = registry.findPool<Transform>();
+    for (size_t i = 0; i < count; ++i) {
+        const Transform* transform = transforms ? transforms->tryGet(m_entities[begin + i].index) : nullptr;
+        const Transform local = transform ? *transform : Transform{};
+        channels[PX][i] = local.position.x;
+        channels[PY][i] = local.position.y;
+        channels[PZ][i] = local.position.z;
+        channels[QX][i] = local.rotation.x;
+        channels[QY][i] = local.rotation.y;
+        channels[QZ][i] = local.rotation.z;
+        channels[QW][i] = local.rotation.w;
+        channels[SX][i] = local.scale.x;
+        channels[SY][i] = local.scale.y;
+        channels[SZ][i] = local.scale.z;
+    }
+
+    m_local.resize(count);
+    composeLocalMatrices(channels, count, m_local.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t node = begin + static_cast<uint32_t>(i);
+        const uint32_t parent = m_parents[node];
+        if (parent == kNoNode) {
+            m_world[node] = m_local[i];
+        } else {
+            multiplyMatrix(m_world[parent], m_local[i], m_world[node]);
+        }
+
+        if (m_moveState[node] == MoveFresh) {
+            m_previous[node] = m_world[node];
+            m_moveState[node] = MoveStill;
+        } else if (m_moveState[node] == MoveStill) {
+            m_moveState[node] = MoveMoving;
+            m_movedNodes.push_back(node);
+        }
+    }
+}
+
+} // namespace Ecs
+} // namespace Engine
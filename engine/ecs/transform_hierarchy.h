@@ -0,0 +1,104 @@
+// engine/ecs/transform_hierarchy.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "entity.h"
+
+namespace Engine {
+namespace Ecs {
+
+class Registry;
+
+// Contadores do último update (logReport)
+struct TransformStats {
+    uint64_t nodes = 0;
+    uint64_t dirtyEntities = 0;   // Entidades com TransformDirty neste frame
+    uint64_t recomputed = 0;      // Matrizes de mundo recalculadas (subárvores inteiras)
+    uint64_t rebuilds = 0;        // Reordenações completas desde o início (pai trocado, filho novo, remoção)
+    double updateMs = 0.0;
+};
+
+// Matrizes de mundo em cache de todas as entidades com Transform, em arrays paralelos (SoA) na ordem de
+// uma busca em profundidade: o pai vem sempre antes dos filhos e cada subárvore é uma faixa contígua
+// [nó, fim da subárvore). Só as entidades marcadas com TransformDirty (e as subárvores delas) são
+// recalculadas, em lote: matrizes locais 4 por vez com SSE a partir de Transform, depois
+// mundo = mundo do pai * local na ordem dos arrays. Objetos parados não custam nada por frame.
+// Guarda também a matriz do update anterior dos nós que se moveram, para o desenho interpolar entre os
+// dois últimos passos da simulação em passo fixo (getRenderMatrix).
+class TransformHierarchy {
+public:
+    static constexpr uint32_t kNoNode = std::numeric_limits<uint32_t>::max();
+
+    // Na thread principal, depois dos sistemas que movem entidades e antes da gravação do frame.
+    // Integra entidades novas, pais trocados e entidades destruídas; remove todas as marcas TransformDirty.
+    void update(Registry& registry);
+
+    // Identidade se a entidade ainda não passou por update()
+    const glm::mat4& getWorldMatrix(Entity entity) const {
+        const uint32_t node = findNode(entity);
+        return node != kNoNode ? m_world[node] : kIdentity;
+    }
+    // Entre a matriz do update anterior e a atual (alpha 0..1); nós parados devolvem a atual.
+    // Interpolação linear das colunas: a rotação perde um pouco de escala no meio do intervalo,
+    // desprezível para o giro de um passo.
+    glm::mat4 getRenderMatrix(Entity entity, float alpha) const;
+    uint32_t findNode(Entity entity) const {
+        if (entity.index >= m_nodeOf.size()) {
+            return kNoNode;
+        }
+        const uint32_t node = m_nodeOf[entity.index];
+        return node != kNoNode && m_entities[node] == entity ? node : kNoNode;
+    }
+
+    size_t getNodeCount() const { return m_entities.size(); }
+    const TransformStats& getStats() const { return m_stats; }
+    void logReport() const;
+
+    // Maior escala de uma matriz de mundo (comprimento da maior coluna da parte 3x3), para raios de bounds
+    static float getMaxScale(const glm::mat4& matrix);
+
+private:
+    enum MoveState : uint8_t {
+        MoveStill = 0,
+        MoveMoving,   // Recalculado no último update: m_previous guarda a matriz de antes
+        MoveFresh,    // Entrou na hierarquia: a primeira matriz não interpola a partir da identidade
+    };
+
+    void appendRoot(Entity entity);
+    // Refaz a ordem em profundidade (descarta entidades mortas ou sem Transform) preservando as matrizes já válidas
+    void rebuild(Registry& registry);
+    // Recalcula as matrizes de mundo da faixa [begin, end) de nós (pais fora da faixa já estão válidos)
+    void computeRange(Registry& registry, uint32_t begin, uint32_t end);
+
+    static const glm::mat4 kIdentity;
+
+    // Por nó, na ordem em profundidade
+    std::vector<Entity> m_entities;
+    std::vector<uint32_t> m_parents;     // kNoNode para raízes; sempre menor que o índice do filho
+    std::vector<uint32_t> m_subtreeEnd;  // Um depois do último descendente
+    std::vector<glm::mat4> m_world;
+    std::vector<uint8_t> m_dirty;
+    std::vector<glm::mat4> m_previous;   // Matriz de mundo do update anterior (igual à atual se parado)
+    std::vector<uint8_t> m_moveState;    // MoveState
+
+    std::vector<uint32_t> m_nodeOf;      // Índice da entidade -> nó (kNoNode se fora da hierarquia)
+    uint64_t m_destroyVersion = 0;
+
+    // Temporários do update (reaproveitados entre frames)
+    std::vector<Entity> m_pendingEntities;
+    std::vector<uint32_t> m_dirtyNodes;
+    std::vector<float> m_soa;            // Posição, rotação e escala da faixa em arrays separados
+    std::vector<glm::mat4> m_local;
+    std::vector<uint32_t> m_movedNodes;  // Nós com MoveMoving, acomodados no início do próximo update
+
+    TransformStats m_stats;
+};
+
+} // namespace Ecs
+} // namespace Engine
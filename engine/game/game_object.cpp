@@ -3,101 +3,168 @@
 #include "./../core/log.h"
 #include "./../asset/model.h"
 #include "./../../engine/render/shader.h"
-#include "./../../engine/input/input_manager.h"
 
 #include <glm/gtx/quaternion.hpp>
 #include <format>
 
-#include <GLFW/glfw3.h>                           // Para códigos de tecla, se GameObject usar diretamente (apenas para PlayerCharacter agora)
-#include "./../../engine/render/camera/icamera.h" // Para CameraMovement enum (apenas para PlayerCharacter agora)
-
 namespace Engine
 {
     namespace Game
     {
 
-        GameObject::GameObject()
-            : m_position(0.0f), m_rotation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f)), m_scale(1.0f), m_model(nullptr), name("GameObject")
+        GameObject::GameObject(Ecs::Registry &registry)
+            : m_registry(&registry), m_entity(registry.create())
+        {
+            registry.add<Ecs::Transform>(m_entity);
+            registry.add<Ecs::Name>(m_entity, std::string("GameObject"));
+            registry.add<Ecs::StaticTag>(m_entity);
+            registry.add<Ecs::TransformDirty>(m_entity);
+            ENGINE_LOG_TRACE("GameObject: entidade {} criada.", m_entity.index);
+        }
+
+        GameObject::GameObject(Ecs::Registry &registry, std::unique_ptr<Engine::Asset::Model> model)
+            : GameObject(registry)
+        {
+            setModel(std::move(model));
+        }
+
+        GameObject::GameObject(Ecs::Registry &registry, Ecs::Entity entity)
+            : m_registry(&registry), m_entity(entity)
         {
-            Engine::Log::Trace("GameObject: Construtor padrão chamado.");
         }
 
-        GameObject::GameObject(std::unique_ptr<Engine::Asset::Model> model)
-            : m_position(0.0f), m_rotation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f)), m_scale(1.0f), m_model(std::move(model)), name("GameObject")
+        void GameObject::destroy()
         {
-            Engine::Log::Trace(std::format("GameObject: Construtor chamado com modelo."));
+            m_registry->destroy(m_entity);
         }
 
         void GameObject::setPosition(const glm::vec3 &position)
         {
-            m_position = position;
-            Engine::Log::Trace(std::format("GameObject '{}': Posição definida para ({},{},{}).", name, position.x, position.y, position.z));
+            transform().position = position;
+            markDirty();
+            ENGINE_LOG_TRACE("GameObject '{}': Posição definida para ({},{},{}).", getName(), position.x, position.y, position.z);
         }
 
         void GameObject::setRotation(const glm::quat &rotation)
         {
-            m_rotation = rotation;
-            Engine::Log::Trace(std::format("GameObject '{}': Rotação definida por quaternion.", name));
+            transform().rotation = rotation;
+            markDirty();
+            ENGINE_LOG_TRACE("GameObject '{}': Rotação definida por quaternion.", getName());
         }
 
         void GameObject::setRotationEuler(float pitch_deg, float yaw_deg, float roll_deg)
         {
             glm::vec3 euler_rad = glm::radians(glm::vec3(pitch_deg, yaw_deg, roll_deg));
-            m_rotation = glm::quat(euler_rad);
-            Engine::Log::Trace(std::format("GameObject '{}': Rotação definida por Euler (Pitch: {}, Yaw: {}, Roll: {}).", name, pitch_deg, yaw_deg, roll_deg));
+            transform().rotation = glm::quat(euler_rad);
+            markDirty();
+            ENGINE_LOG_TRACE("GameObject '{}': Rotação definida por Euler (Pitch: {}, Yaw: {}, Roll: {}).", getName(), pitch_deg, yaw_deg, roll_deg);
         }
 
         float GameObject::getRotationYaw() const
         {
-            return glm::degrees(glm::yaw(m_rotation));
+            return glm::degrees(glm::yaw(transform().rotation));
         }
 
         void GameObject::setScale(const glm::vec3 &scale)
         {
-            m_scale = scale;
-            Engine::Log::Trace(std::format("GameObject '{}': Escala definida para ({},{},{}).", name, scale.x, scale.y, scale.z));
+            transform().scale = scale;
+            markDirty();
+            ENGINE_LOG_TRACE("GameObject '{}': Escala definida para ({},{},{}).", getName(), scale.x, scale.y, scale.z);
         }
 
         void GameObject::setScale(float scale)
         {
-            m_scale = glm::vec3(scale);
-            Engine::Log::Trace(std::format("GameObject '{}': Escala definida para {}.", name, scale));
+            transform().scale = glm::vec3(scale);
+            markDirty();
+            ENGINE_LOG_TRACE("GameObject '{}': Escala definida para {}.", getName(), scale);
         }
 
-        glm::mat4 GameObject::getTransformMatrix() const
+        void GameObject::setParent(const GameObject *parent)
         {
-            glm::mat4 modelMatrix = glm::mat4(1.0f);
-            modelMatrix = glm::translate(modelMatrix, m_position);
-            modelMatrix = modelMatrix * glm::mat4_cast(m_rotation);
-            modelMatrix = glm::scale(modelMatrix, m_scale);
-            return modelMatrix;
+            if (!parent || parent->m_entity.isNull())
+            {
+                m_registry->remove<Ecs::Parent>(m_entity);
+                markDirty();
+                return;
+            }
+            // Sobe a cadeia de pais do novo pai: encontrar esta entidade seria um ciclo
+            for (Ecs::Entity ancestor = parent->m_entity; !ancestor.isNull();)
+            {
+                if (ancestor == m_entity)
+                {
+                    Engine::Log::Warn(std::format("GameObject '{}': pai recusado ('{}' é descendente).", getName(), parent->getName()));
+                    return;
+                }
+                const Ecs::Parent *next = m_registry->tryGet<Ecs::Parent>(ancestor);
+                ancestor = next ? next->entity : Ecs::kNullEntity;
+            }
+            m_registry->add<Ecs::Parent>(m_entity, parent->m_entity);
+            markDirty();
+            ENGINE_LOG_TRACE("GameObject '{}': filho de '{}'.", getName(), parent->getName());
+        }
+
+        Ecs::Entity GameObject::getParent() const
+        {
+            const Ecs::Parent *parent = m_registry->tryGet<Ecs::Parent>(m_entity);
+            return parent ? parent->entity : Ecs::kNullEntity;
         }
 
         void GameObject::setModel(std::unique_ptr<Engine::Asset::Model> model)
         {
-            m_model = std::move(model);
-            Engine::Log::Trace(std::format("GameObject '{}': Modelo definido.", name));
+            if (model)
+            {
+                // Novo modelo: as LODs serão selecionadas do zero
+                m_registry->add<Ecs::MeshRef>(m_entity, std::shared_ptr<Engine::Asset::Model>(std::move(model)));
+            }
+            else
+            {
+                m_registry->remove<Ecs::MeshRef>(m_entity);
+            }
+            ENGINE_LOG_TRACE("GameObject '{}': Modelo definido.", getName());
+        }
+
+        Engine::Asset::Model *GameObject::getModel() const
+        {
+            const Ecs::MeshRef *meshRef = m_registry->tryGet<Ecs::MeshRef>(m_entity);
+            return meshRef ? meshRef->model.get() : nullptr;
         }
 
-        void GameObject::draw(const Render::Shader &shader) const
+        void GameObject::setStatic(bool isStatic)
         {
-            if (m_model)
+            if (isStatic)
             {
-                shader.setMat4("uModel", getTransformMatrix());
-                m_model->draw(shader);
+                m_registry->add<Ecs::StaticTag>(m_entity);
             }
             else
             {
-                Engine::Log::Trace(std::format("GameObject '{}': Sem modelo para desenhar.", name));
+                m_registry->remove<Ecs::StaticTag>(m_entity);
             }
         }
 
-        // **** MUDANÇA: Implementação padrão (vazia) do método update() ****
-        void GameObject::update(float deltaTime, const Input::InputManager &inputManager, const Camera::ICamera &camera)
-        { // MUDANÇA: Aceita camera
-            // Default implementation, typically does nothing.
-            // Derived classes will override this.
+        void GameObject::setName(const std::string &name)
+        {
+            m_registry->add<Ecs::Name>(m_entity, name);
+        }
+
+        const std::string &GameObject::getName() const
+        {
+            static const std::string unnamed = "GameObject";
+            const Ecs::Name *name = m_registry->tryGet<Ecs::Name>(m_entity);
+            return name ? name->value : unnamed;
+        }
+
+        void GameObject::draw(const Render::Shader &shader) const
+        {
+            if (Engine::Asset::Model *model = getModel())
+            {
+                shader.setMat4("uModel", getTransformMatrix());
+                model->draw(shader);
+            }
+            else
+            {
+                ENGINE_LOG_TRACE("GameObject '{}': Sem modelo para desenhar.", getName());
+            }
         }
 
     } // namespace Game
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -6,6 +6,10 @@
 #include <glm/gtc/quaternion.hpp> 
 #include <memory> 
 #include <string> 
+#include <vector>
+
+#include "./../../engine/ecs/components.h"
+#include "./../../engine/ecs/registry.h"
 
 // Forward declarations
 namespace Engine {
@@ -15,24 +19,26 @@ namespace Asset {
 namespace Render {
     class Shader; 
 }
-namespace Input { 
-    class InputManager; 
-    enum class CameraMovement; 
-}
-// **** MUDANÇA CRUCIAL AQUI: Forward declare Engine::Camera::ICamera ****
-namespace Camera { 
-    class ICamera; 
-}
 } // namespace Engine
 
 namespace Engine {
 namespace Game {
 
+// Fachada leve sobre uma entidade do Ecs::Registry: os dados vivem nos pools de componentes
+// (Transform, Parent, MeshRef, Name, StaticTag) e os sistemas iteram os pools direto. Copiar a fachada
+// copia só o identificador; destruir a fachada não destrói a entidade (use destroy()).
+// Os setters de transformação marcam TransformDirty; a matriz de mundo em cache fica em Ecs::TransformHierarchy.
 class GameObject {
 public:
-    GameObject();
-    GameObject(std::unique_ptr<Engine::Asset::Model> model);
-    virtual ~GameObject() = default; // Destrutor virtual para herança
+    // Cria uma entidade estática com Transform e Name (e MeshRef, se houver modelo)
+    explicit GameObject(Ecs::Registry& registry);
+    GameObject(Ecs::Registry& registry, std::unique_ptr<Engine::Asset::Model> model);
+    // Envolve uma entidade já existente (precisa ter Transform)
+    GameObject(Ecs::Registry& registry, Ecs::Entity entity);
+
+    Ecs::Entity getEntity() const { return m_entity; }
+    bool isValid() const { return m_registry->isAlive(m_entity); }
+    void destroy();
 
     void setPosition(const glm::vec3& position);
     void setRotation(const glm::quat& rotation); 
@@ -40,30 +46,39 @@ public:
     void setScale(const glm::vec3& scale);
     void setScale(float scale); 
 
-    const glm::vec3& getPosition() const { return m_position; }
-    const glm::quat& getRotation() const { return m_rotation; }
+    const glm::vec3& getPosition() const { return transform().position; }
+    const glm::quat& getRotation() const { return transform().rotation; }
     float getRotationYaw() const; 
-    const glm::vec3& getScale() const { return m_scale; }
+    const glm::vec3& getScale() const { return transform().scale; }
+
+    // Matriz local (relativa ao pai), calculada na hora
+    glm::mat4 getTransformMatrix() const { return transform().getMatrix(); }
 
-    glm::mat4 getTransformMatrix() const;
+    // Filho de 'parent' (nulo = raiz): a transformação passa a ser relativa à do pai.
+    // Recusado (com aviso) se criaria um ciclo.
+    void setParent(const GameObject* parent);
+    Ecs::Entity getParent() const;
 
     void setModel(std::unique_ptr<Engine::Asset::Model> model);
-    Engine::Asset::Model* getModel() const { return m_model.get(); } 
+    Engine::Asset::Model* getModel() const; 
 
     void draw(const Render::Shader& shader) const;
 
-    // update() agora aceita o InputManager e a ICamera
-    virtual void update(float deltaTime, const Input::InputManager& inputManager, const Camera::ICamera& camera); 
+    // Objetos estáticos não se movem durante o jogo: podem entrar em caches (ex.: cascatas de sombra distantes)
+    void setStatic(bool isStatic);
+    bool isStatic() const { return m_registry->has<Ecs::StaticTag>(m_entity); }
 
-    std::string name;
+    void setName(const std::string& name);
+    const std::string& getName() const;
 
 protected: 
-    glm::vec3 m_position;
-    glm::quat m_rotation; 
-    glm::vec3 m_scale;
+    Ecs::Transform& transform() { return m_registry->get<Ecs::Transform>(m_entity); }
+    const Ecs::Transform& transform() const { return m_registry->get<Ecs::Transform>(m_entity); }
+    void markDirty() { m_registry->add<Ecs::TransformDirty>(m_entity); }
 
-    std::unique_ptr<Engine::Asset::Model> m_model; 
+    Ecs::Registry* m_registry;
+    Ecs::Entity m_entity;
 };
 
 } // namespace Game
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
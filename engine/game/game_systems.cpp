@@ -0,0 +1,115 @@
+// engine/game/game_systems.cpp
+#define GLFW_INCLUDE_NONE
+#include "game_systems.h"
+#include "./../core/log.h"
+#include "./../../engine/ecs/components.h"
+#include "./../../engine/input/input_manager.h"
+
+#include <glm/gtx/string_cast.hpp>
+#include <format>
+
+#include <GLFW/glfw3.h>
+#include "./../../engine/render/camera/icamera.h"
+
+namespace Engine
+{
+    namespace Game
+    {
+
+        void GameSystems::updatePlayerControl(Ecs::Registry &registry, float deltaTime, const Input::InputManager &inputManager,
+                                              const Camera::ICamera &camera)
+        {
+            const bool isRightMouseButtonPressed = inputManager.IsRightMouseButtonPressed();
+            const glm::vec3 cameraForwardHorizontal = camera.getForwardVector();
+            const glm::vec3 cameraRightHorizontal = camera.getRightVector();
+
+            registry.each<Ecs::PlayerControl, Ecs::Velocity, Ecs::Transform>(
+                [&](Ecs::Entity entity, const Ecs::PlayerControl &control, Ecs::Velocity &velocity, Ecs::Transform &transform)
+                {
+                    glm::vec3 direction(0.0f);
+                    if (inputManager.IsKeyPressed(GLFW_KEY_W))
+                    {
+                        direction += cameraForwardHorizontal;
+                    }
+                    if (inputManager.IsKeyPressed(GLFW_KEY_S))
+                    {
+                        direction -= cameraForwardHorizontal;
+                    }
+
+                    if (isRightMouseButtonPressed)
+                    {
+                        // RMB held: A/Q movem para ESQUERDA; D/E movem para DIREITA (personagem strafa)
+                        if (inputManager.IsKeyPressed(GLFW_KEY_Q) || inputManager.IsKeyPressed(GLFW_KEY_A))
+                        {
+                            direction -= cameraRightHorizontal;
+                        }
+                        if (inputManager.IsKeyPressed(GLFW_KEY_E) || inputManager.IsKeyPressed(GLFW_KEY_D))
+                        {
+                            direction += cameraRightHorizontal;
+                        }
+                        // Personagem rotaciona para onde a câmera está olhando horizontalmente
+                        const glm::quat rotation = glm::quat(glm::radians(glm::vec3(0.0f, camera.getYaw(), 0.0f)));
+                        if (rotation != transform.rotation)
+                        {
+                            transform.rotation = rotation;
+                            registry.add<Ecs::TransformDirty>(entity);
+                        }
+                    }
+                    else
+                    {
+                        // RMB não segurado: Q/E movem (strafe); A/D rotacionam (personagem gira)
+                        if (inputManager.IsKeyPressed(GLFW_KEY_Q))
+                        {
+                            direction -= cameraRightHorizontal;
+                        }
+                        if (inputManager.IsKeyPressed(GLFW_KEY_E))
+                        {
+                            direction += cameraRightHorizontal;
+                        }
+                        const float rotationStep = control.rotationSpeed * deltaTime;
+                        if (inputManager.IsKeyPressed(GLFW_KEY_A))
+                        {
+                            transform.rotation = glm::angleAxis(glm::radians(rotationStep), glm::vec3(0.0f, 1.0f, 0.0f)) * transform.rotation;
+                            registry.add<Ecs::TransformDirty>(entity);
+                        }
+                        if (inputManager.IsKeyPressed(GLFW_KEY_D))
+                        {
+                            transform.rotation = glm::angleAxis(glm::radians(-rotationStep), glm::vec3(0.0f, 1.0f, 0.0f)) * transform.rotation;
+                            registry.add<Ecs::TransformDirty>(entity);
+                        }
+                    }
+
+                    velocity.linear = direction * control.movementSpeed;
+                    velocity.linear.y = 0.0f;
+
+                    ENGINE_LOG_TRACE("GameSystems: entidade {} controlada pelo jogador, velocidade {}, rotação {}.", entity.index,
+                                     glm::to_string(velocity.linear), glm::to_string(glm::degrees(glm::eulerAngles(transform.rotation))));
+                });
+        }
+
+        void GameSystems::integrateVelocity(Ecs::SystemContext &context, size_t begin, size_t end)
+        {
+            // Velocity é o pool menor: percorre a faixa do array denso dele e busca o Transform pelo sparse set.
+            // Entidades paradas não são marcadas (a matriz de mundo em cache continua valendo).
+            const Ecs::ComponentPool<Ecs::Velocity> *velocities = context.registry.findPool<Ecs::Velocity>();
+            Ecs::ComponentPool<Ecs::Transform> *transforms = context.registry.findPool<Ecs::Transform>();
+            if (!velocities || !transforms)
+            {
+                return;
+            }
+            for (size_t dense = begin; dense < end; ++dense)
+            {
+                const Ecs::Velocity &velocity = velocities->componentAt(dense);
+                const Ecs::Entity entity = velocities->entityAt(dense);
+                Ecs::Transform *transform = transforms->tryGet(entity.index);
+                if (!transform || velocity.linear == glm::vec3(0.0f))
+                {
+                    continue;
+                }
+                transform->position += velocity.linear * context.deltaTime;
+                context.commands.add<Ecs::TransformDirty>(entity);
+            }
+        }
+
+    } // namespace Game
+} // namespace Engine
@@ -0,0 +1,40 @@
+// engine/game/game_systems.h
+#pragma once
+
+#include "./../../engine/ecs/registry.h"
+#include "./../../engine/ecs/system_scheduler.h"
+
+// Forward declarations
+namespace Engine {
+namespace Input {
+    class InputManager;
+}
+namespace Camera {
+    class ICamera;
+}
+} // namespace Engine
+
+namespace Engine {
+namespace Game {
+
+// Sistemas de jogo sobre o Registry: cada um percorre os pools dos componentes que usa, sem GameObjects.
+// A Scene os registra no Ecs::SystemScheduler com os componentes que cada um lê e escreve.
+class GameSystems {
+public:
+    GameSystems() = delete;
+
+    // Teclado -> Velocity e rotação das entidades com PlayerControl, em relação à câmera:
+    // W/S andam para frente/trás; sem o botão direito, Q/E andam de lado e A/D giram o personagem;
+    // com o botão direito, A/Q e D/E andam de lado e o personagem segue o yaw da câmera.
+    // A velocidade é só horizontal (a altura vem do chão, em Scene::update).
+    // Adiciona TransformDirty direto no Registry: registrar como sistema exclusivo.
+    static void updatePlayerControl(Ecs::Registry& registry, float deltaTime, const Input::InputManager& inputManager,
+                                    const Camera::ICamera& camera);
+
+    // Transform.position += Velocity * deltaTime para a faixa [begin, end) do pool de Velocity; as entidades
+    // que se moveram recebem TransformDirty pelo CommandBuffer. Lê Velocity, escreve Transform e TransformDirty.
+    static void integrateVelocity(Ecs::SystemContext& context, size_t begin, size_t end);
+};
+
+} // namespace Game
+} // namespace Engine
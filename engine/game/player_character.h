@@ -2,28 +2,26 @@
 #pragma once
 
 #include "game_object.h" // Herda de GameObject
-#include "./../../engine/input/input_manager.h" // Para Input::InputManager
 
 namespace Engine {
 namespace Game {
 
+// Fachada do personagem do jogador: entidade dinâmica com PlayerControl e Velocity.
+// O movimento em si é feito por GameSystems::updatePlayerControl e GameSystems::integrateVelocity.
 class PlayerCharacter : public GameObject {
 public:
-    PlayerCharacter();
-    PlayerCharacter(std::unique_ptr<Engine::Asset::Model> model);
-    virtual ~PlayerCharacter() = default; // Destrutor virtual
+    explicit PlayerCharacter(Ecs::Registry& registry);
+    PlayerCharacter(Ecs::Registry& registry, std::unique_ptr<Engine::Asset::Model> model);
 
-    // Sobrescrever o método update() do GameObject
-    void update(float deltaTime, const Input::InputManager& inputManager, const Camera::ICamera& camera) override;
+    void setMovementSpeed(float speed) { m_registry->get<Ecs::PlayerControl>(m_entity).movementSpeed = speed; }
+    void setRotationSpeed(float degreesPerSecond) { m_registry->get<Ecs::PlayerControl>(m_entity).rotationSpeed = degreesPerSecond; }
 
 private:
-    // Propriedades específicas do PlayerCharacter
-    float m_movementSpeed;
-    float m_rotationSpeed;
+    void addPlayerComponents();
 
     // Para controlar a altura no terreno (futuro)
     // float m_targetHeight; 
 };
 
 } // namespace Game
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
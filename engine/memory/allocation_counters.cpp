@@ -0,0 +1,248 @@
+// engine/memory/allocation_counters.cpp
+#include "allocation_counters.h"
+#include "./../core/log.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <format>
+#include <new>
+#include <string>
+
+namespace Engine {
+namespace Memory {
+
+namespace {
+
+    struct TagCounters {
+        std::atomic<uint64_t> heapAllocations{0};
+        std::atomic<uint64_t> heapBytes{0};
+        std::atomic<uint64_t> served{0};
+    };
+
+    // Inicialização constante: o operator new pode ser chamado antes de main
+    std::array<TagCounters, kMemoryTagCount> g_totals;
+    std::array<AllocationCounts, kMemoryTagCount> g_frameStart; // Totais no início do frame anterior
+    std::array<AllocationCounts, kMemoryTagCount> g_lastFrame;
+
+    size_t indexOf(MemoryTag tag) {
+        const size_t index = static_cast<size_t>(tag);
+        return index < kMemoryTagCount ? index : 0;
+    }
+
+    thread_local MemoryTag t_currentTag = MemoryTag::General;
+
+} // namespace
+
+const char* getMemoryTagName(MemoryTag tag) {
+    static constexpr const char* kNames[kMemoryTagCount] = {"General", "Asset", "Render", "Game", "Ecs", "World", "Log"};
+    return kNames[indexOf(tag)];
+}
+
+void AllocationCounters::recordServed(MemoryTag tag) {
+    g_totals[indexOf(tag)].served.fetch_add(1, std::memory_order_relaxed);
+}
+
+MemoryTag AllocationCounters::getCurrentTag() {
+    return t_currentTag;
+}
+
+AllocationScope::AllocationScope(MemoryTag tag) : m_previous(t_currentTag) {
+    t_currentTag = tag;
+}
+
+AllocationScope::~AllocationScope() {
+    t_currentTag = m_previous;
+}
+
+void AllocationCounters::beginFrame() {
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        const AllocationCounts now = getTotalCounts(static_cast<MemoryTag>(i));
+        g_lastFrame[i].heapAllocations = now.heapAllocations - g_frameStart[i].heapAllocations;
+        g_lastFrame[i].heapBytes = now.heapBytes - g_frameStart[i].heapBytes;
+        g_lastFrame[i].served = now.served - g_frameStart[i].served;
+        g_frameStart[i] = now;
+    }
+}
+
+AllocationCounts AllocationCounters::getFrameCounts(MemoryTag tag) {
+    return g_lastFrame[indexOf(tag)];
+}
+
+AllocationCounts AllocationCounters::getTotalCounts(MemoryTag tag) {
+    const TagCounters& counters = g_totals[indexOf(tag)];
+    AllocationCounts counts;
+    counts.heapAllocations = counters.heapAllocations.load(std::memory_order_relaxed);
+    counts.heapBytes = counters.heapBytes.load(std::memory_order_relaxed);
+    counts.served = counters.served.load(std::memory_order_relaxed);
+    return counts;
+}
+
+void AllocationCounters::logFrameReport() {
+    // A meta é nenhuma alocação de heap no regime permanente
+    std::string heapByTag;
+    uint64_t served = 0;
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        const AllocationCounts& counts = g_lastFrame[i];
+        served += counts.served;
+        if (counts.heapAllocations > 0) {
+            heapByTag += std::format("{}{} {} ({:.1f} KB)", heapByTag.empty() ? "" : ", ", getMemoryTagName(static_cast<MemoryTag>(i)),
+                                     counts.heapAllocations, counts.heapBytes / 1024.0);
+        }
+    }
+    if (!countsHeapAllocations()) {
+        heapByTag = "não contado (ENGINE_COUNT_HEAP_ALLOCATIONS desligado)";
+    }
+    Engine::Log::Info(std::format("AllocationCounters: último frame: heap {}; {} atendidas por pools/arenas.",
+                                  heapByTag.empty() ? "nenhuma" : heapByTag, served));
+}
+
+} // namespace Memory
+} // namespace Engine
+
+#if ENGINE_COUNT_HEAP_ALLOCATIONS
+
+namespace Engine {
+namespace Memory {
+
+namespace {
+
+    void recordHeapAllocation(size_t bytes) {
+        TagCounters& counters = g_totals[indexOf(t_currentTag)];
+        counters.heapAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.heapBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void* heapAllocate(size_t size) {
+        void* pointer = std::malloc(size > 0 ? size : 1);
+        if (pointer) {
+            recordHeapAllocation(size);
+        }
+        return pointer;
+    }
+
+    void* heapAllocateAligned(size_t size, size_t alignment) {
+#ifdef _WIN32
+        void* pointer = _aligned_malloc(size > 0 ? size : 1, alignment);
+#else
+        // aligned_alloc exige tamanho múltiplo do alinhamento
+        const size_t rounded = (size + alignment - 1) / alignment * alignment;
+        void* pointer = std::aligned_alloc(alignment, rounded > 0 ? rounded : alignment);
+#endif
+        if (pointer) {
+            recordHeapAllocation(size);
+        }
+        return pointer;
+    }
+
+    void heapFreeAligned(void* pointer) {
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+
+    // Comportamento do operator new padrão: tenta o new_handler antes de lançar bad_alloc
+    template <typename Allocate>
+    void* allocateOrThrow(Allocate allocate) {
+        for (;;) {
+            if (void* pointer = allocate()) {
+                return pointer;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+} // namespace
+
+} // namespace Memory
+} // namespace Engine
+
+// Operator new/delete globais (opção de CMake ENGINE_COUNT_HEAP_ALLOCATIONS): substituem os da biblioteca
+// padrão no programa inteiro para que toda alocação de heap passe pelos contadores (malloc/free por baixo)
+void* operator new(std::size_t size) {
+    return Engine::Memory::allocateOrThrow([size]() { return Engine::Memory::heapAllocate(size); });
+}
+
+void* operator new[](std::size_t size) {
+    return Engine::Memory::allocateOrThrow([size]() { return Engine::Memory::heapAllocate(size); });
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return Engine::Memory::heapAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return Engine::Memory::heapAllocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return Engine::Memory::allocateOrThrow([=]() { return Engine::Memory::heapAllocateAligned(size, static_cast<std::size_t>(alignment)); });
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return Engine::Memory::allocateOrThrow([=]() { return Engine::Memory::heapAllocateAligned(size, static_cast<std::size_t>(alignment)); });
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Engine::Memory::heapAllocateAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Engine::Memory::heapAllocateAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    Engine::Memory::heapFreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    Engine::Memory::heapFreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    Engine::Memory::heapFreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    Engine::Memory::heapFreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    Engine::Memory::heapFreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    Engine::Memory::heapFreeAligned(pointer);
+}
+
+#endif // ENGINE_COUNT_HEAP_ALLOCATIONS
@@ -0,0 +1,80 @@
+// engine/memory/allocation_counters.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 1 substitui o operator new/delete global para contar toda alocação de heap. Definido pelo CMake com a
+// opção ENGINE_COUNT_HEAP_ALLOCATIONS (desligada por padrão); sem ela, heapAllocations fica em zero.
+#ifndef ENGINE_COUNT_HEAP_ALLOCATIONS
+#define ENGINE_COUNT_HEAP_ALLOCATIONS 0
+#endif
+
+namespace Engine {
+namespace Memory {
+
+// Subsistema dono de uma alocação (contadores e relatórios por tag)
+enum class MemoryTag : uint8_t {
+    General = 0,
+    Asset,
+    Render,
+    Game,
+    Ecs,
+    World,
+    Log,
+    Count
+};
+
+constexpr size_t kMemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+const char* getMemoryTagName(MemoryTag tag);
+
+struct AllocationCounts {
+    uint64_t heapAllocations = 0; // Toda alocação de heap (só com ENGINE_COUNT_HEAP_ALLOCATIONS), na tag da thread que alocou
+    uint64_t heapBytes = 0;
+    uint64_t served = 0;          // Atendidas por pools e arenas sem ir ao heap
+};
+
+// Contadores por subsistema. Pools e arenas contam sempre o que atendem sem ir ao heap. Com
+// ENGINE_COUNT_HEAP_ALLOCATIONS, o operator new global da engine também conta cada alocação de heap
+// (std::vector, std::function, std::string, blocos novos de pools e arenas...) na tag atual da thread,
+// definida por AllocationScope. O objetivo é heapAllocations = 0 por frame no regime permanente.
+// Os registros são atômicos (qualquer thread); beginFrame() só na thread principal.
+class AllocationCounters {
+public:
+    AllocationCounters() = delete;
+
+    static void recordServed(MemoryTag tag);
+
+    // Falso sem ENGINE_COUNT_HEAP_ALLOCATIONS (heapAllocations e heapBytes ficam em zero)
+    static constexpr bool countsHeapAllocations() { return ENGINE_COUNT_HEAP_ALLOCATIONS != 0; }
+
+    // Tag usada pelo operator new global nesta thread (General fora de qualquer AllocationScope)
+    static MemoryTag getCurrentTag();
+
+    // Fecha o frame anterior: getFrameCounts passa a devolver o que aconteceu nele
+    static void beginFrame();
+
+    static AllocationCounts getFrameCounts(MemoryTag tag);
+    static AllocationCounts getTotalCounts(MemoryTag tag);
+
+    // Uma linha com as alocações de heap do último frame por tag e o total atendido por pools e arenas
+    static void logFrameReport();
+};
+
+// Define a tag das alocações de heap da thread atual até o fim do escopo (escopos podem ser aninhados;
+// o destrutor restaura a tag anterior). Jobs herdam a tag de quem os agendou.
+class AllocationScope {
+public:
+    explicit AllocationScope(MemoryTag tag);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    MemoryTag m_previous;
+};
+
+} // namespace Memory
+} // namespace Engine
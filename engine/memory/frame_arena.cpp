@@ -0,0 +1,47 @@
+// engine/memory/frame_arena.cpp
+#include "frame_arena.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+
+#include <algorithm>
+#include <format>
+
+namespace Engine {
+namespace Memory {
+
+namespace {
+    constexpr size_t kFrameBlockSize = 1024 * 1024;
+}
+
+FrameArena& FrameArena::Get() {
+    static FrameArena instance;
+    return instance;
+}
+
+FrameArena::FrameArena() {
+    const size_t slotCount = static_cast<size_t>(std::max(Engine::RENDER_MAX_FRAME_LATENCY, 0)) + 2;
+    for (size_t i = 0; i < slotCount; ++i) {
+        m_slots.push_back(std::make_unique<LinearArena>(kFrameBlockSize, MemoryTag::Render));
+    }
+}
+
+void FrameArena::beginFrame() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lastFrameBytes = m_slots[m_slot]->getUsedBytes();
+    m_peakFrameBytes = std::max(m_peakFrameBytes, m_lastFrameBytes);
+    m_slot = (m_slot + 1) % m_slots.size();
+    m_slots[m_slot]->reset();
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slots[m_slot]->allocate(size, alignment);
+}
+
+void FrameArena::logReport() const {
+    Engine::Log::Info(std::format("FrameArena: {:.1f} KB no último frame (pico {:.1f} KB), {} slots.", m_lastFrameBytes / 1024.0,
+                                  m_peakFrameBytes / 1024.0, m_slots.size()));
+}
+
+} // namespace Memory
+} // namespace Engine
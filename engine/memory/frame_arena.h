@@ -0,0 +1,64 @@
+// engine/memory/frame_arena.h
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "linear_arena.h"
+
+namespace Engine {
+namespace Memory {
+
+// Memória temporária de um frame: tudo o que é alocado aqui vale até o mesmo slot voltar a ser usado,
+// RENDER_MAX_FRAME_LATENCY + 2 frames depois (cobre um frame ainda sendo reproduzido pela thread de
+// renderização). Não há liberação individual nem destrutores: só para dados triviais ou contêineres
+// com FrameAllocator. Thread-safe (uma trava curta por alocação).
+class FrameArena {
+public:
+    static FrameArena& Get();
+
+    // Na thread principal, no início de cada frame: passa para o próximo slot e o esvazia
+    void beginFrame();
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Bytes usados pelo frame anterior e o maior uso de um frame até agora
+    size_t getLastFrameBytes() const { return m_lastFrameBytes; }
+    size_t getPeakFrameBytes() const { return m_peakFrameBytes; }
+    void logReport() const;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+private:
+    FrameArena();
+    ~FrameArena() = default;
+
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<LinearArena>> m_slots;
+    size_t m_slot = 0;
+    size_t m_lastFrameBytes = 0;
+    size_t m_peakFrameBytes = 0;
+};
+
+// Alocador STL sobre a FrameArena (deallocate não faz nada: a memória volta no reset do slot)
+template <typename T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    FrameAllocator() = default;
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>&) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(FrameArena::Get().allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    template <typename U>
+    bool operator==(const FrameAllocator<U>&) const { return true; }
+};
+
+} // namespace Memory
+} // namespace Engine
@@ -0,0 +1,82 @@
+// engine/memory/linear_arena.cpp
+#include "linear_arena.h"
+#include "memory_tracker.h"
+
+#include <algorithm>
+#include <new>
+
+namespace Engine {
+namespace Memory {
+
+LinearArena::LinearArena(size_t blockSize, MemoryTag tag) : m_blockSize(std::max<size_t>(blockSize, 256)), m_tag(tag) {
+}
+
+LinearArena::~LinearArena() {
+    for (const Block& block : m_blocks) {
+        ::operator delete(block.data);
+        MemoryTracker::untrack(m_tag, MemoryDomain::Cpu, block.size);
+    }
+}
+
+void* LinearArena::allocate(size_t size, size_t alignment) {
+    size = std::max<size_t>(size, 1);
+    while (true) {
+        if (m_current < m_blocks.size()) {
+            const Block& block = m_blocks[m_current];
+            const uintptr_t base = reinterpret_cast<uintptr_t>(block.data);
+            const uintptr_t aligned = (base + m_offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+            const size_t start = static_cast<size_t>(aligned - base);
+            if (start + size <= block.size) {
+                m_offset = start + size;
+                AllocationCounters::recordServed(m_tag);
+                return block.data + start;
+            }
+            // Não coube: segue para o próximo bloco (o fim deste fica sem uso até o rewind)
+            if (m_current + 1 < m_blocks.size() && size + alignment <= m_blocks[m_current + 1].size) {
+                ++m_current;
+                m_offset = 0;
+                continue;
+            }
+        }
+
+        // Bloco novo logo depois do atual; blocos seguintes (menores que o pedido) continuam na lista
+        const size_t bytes = std::max(m_blockSize, size + alignment);
+        Block block{nullptr, bytes};
+        {
+            AllocationScope scope(m_tag);
+            block.data = static_cast<std::byte*>(::operator new(bytes));
+        }
+        MemoryTracker::track(m_tag, MemoryDomain::Cpu, bytes);
+        const size_t position = m_blocks.empty() ? 0 : m_current + 1;
+        m_blocks.insert(m_blocks.begin() + static_cast<std::ptrdiff_t>(position), block);
+        m_current = position;
+        m_offset = 0;
+    }
+}
+
+void LinearArena::rewind(Marker marker) {
+    if (marker.block > m_current || (marker.block == m_current && marker.offset > m_offset)) {
+        return; // Marca à frente da posição atual: nada a liberar
+    }
+    m_current = marker.block;
+    m_offset = marker.offset;
+}
+
+size_t LinearArena::getUsedBytes() const {
+    size_t used = m_offset;
+    for (size_t i = 0; i < m_current && i < m_blocks.size(); ++i) {
+        used += m_blocks[i].size;
+    }
+    return used;
+}
+
+size_t LinearArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : m_blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+} // namespace Memory
+} // namespace Engine
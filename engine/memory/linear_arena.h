@@ -0,0 +1,57 @@
+// engine/memory/linear_arena.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "allocation_counters.h"
+
+namespace Engine {
+namespace Memory {
+
+// Alocador linear ("bump"): cada alocação avança um deslocamento dentro do bloco atual; não existe
+// liberação individual, só voltar a uma marca (rewind) ou esvaziar tudo (reset). Os blocos são mantidos
+// entre resets, então depois do aquecimento a arena não pede mais memória ao sistema.
+// Não é thread-safe (ver FrameArena e ScratchArena).
+class LinearArena {
+public:
+    struct Marker {
+        size_t block = 0;
+        size_t offset = 0;
+    };
+
+    LinearArena(size_t blockSize, MemoryTag tag);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    // Pedidos maiores que o bloco ganham um bloco próprio do tamanho certo
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    Marker getMarker() const { return {m_current, m_offset}; }
+    // Libera tudo o que foi alocado depois da marca
+    void rewind(Marker marker);
+    void reset() { rewind(Marker{}); }
+
+    // Bytes em uso desde o último reset (aproximado: inclui o fim não usado dos blocos já deixados)
+    size_t getUsedBytes() const;
+    size_t getCapacity() const;
+    MemoryTag getTag() const { return m_tag; }
+
+private:
+    struct Block {
+        std::byte* data;
+        size_t size;
+    };
+
+    size_t m_blockSize;
+    MemoryTag m_tag;
+    std::vector<Block> m_blocks;
+    size_t m_current = 0; // Bloco em uso
+    size_t m_offset = 0;  // Próximo byte livre nele
+};
+
+} // namespace Memory
+} // namespace Engine
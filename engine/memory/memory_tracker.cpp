@@ -0,0 +1,179 @@
+// engine/memory/memory_tracker.cpp
+#include "memory_tracker.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+
+#include <array>
+#include <atomic>
+#include <format>
+#include <string>
+
+namespace Engine {
+namespace Memory {
+
+namespace {
+
+    constexpr uint64_t kMegabyte = 1024ull * 1024ull;
+
+    struct TagUsage {
+        std::atomic<uint64_t> current[2]{};   // Por MemoryDomain
+        std::atomic<uint64_t> peak[2]{};
+        std::atomic<uint64_t> peakTotal{0};
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> released{0};
+        std::atomic<uint64_t> budget{0};
+        std::atomic<bool> overBudget{false};  // Já avisado; rearmado abaixo de 90% do orçamento
+    };
+
+    std::array<TagUsage, kMemoryTagCount> g_usage;
+
+    size_t indexOf(MemoryTag tag) {
+        const size_t index = static_cast<size_t>(tag);
+        return index < kMemoryTagCount ? index : 0;
+    }
+
+    uint64_t configuredBudget(size_t index) {
+        switch (static_cast<MemoryTag>(index)) {
+            case MemoryTag::Asset: return static_cast<uint64_t>(Engine::MEMORY_BUDGET_ASSET_MB) * kMegabyte;
+            case MemoryTag::Render: return static_cast<uint64_t>(Engine::MEMORY_BUDGET_RENDER_MB) * kMegabyte;
+            case MemoryTag::Game: return static_cast<uint64_t>(Engine::MEMORY_BUDGET_GAME_MB) * kMegabyte;
+            case MemoryTag::World: return static_cast<uint64_t>(Engine::MEMORY_BUDGET_WORLD_MB) * kMegabyte;
+            default: return 0;
+        }
+    }
+
+    // Orçamentos da configuração aplicados no primeiro uso (antes de qualquer track)
+    std::array<TagUsage, kMemoryTagCount>& usage() {
+        static const bool initialized = [] {
+            for (size_t i = 0; i < kMemoryTagCount; ++i) {
+                g_usage[i].budget.store(configuredBudget(i), std::memory_order_relaxed);
+            }
+            return true;
+        }();
+        (void)initialized;
+        return g_usage;
+    }
+
+    void raise(std::atomic<uint64_t>& peak, uint64_t value) {
+        uint64_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    double toMegabytes(uint64_t bytes) {
+        return static_cast<double>(bytes) / static_cast<double>(kMegabyte);
+    }
+
+} // namespace
+
+void MemoryTracker::track(MemoryTag tag, MemoryDomain domain, size_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+    TagUsage& tagUsage = usage()[indexOf(tag)];
+    const size_t slot = static_cast<size_t>(domain);
+    const uint64_t now = tagUsage.current[slot].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    tagUsage.allocations.fetch_add(1, std::memory_order_relaxed);
+    raise(tagUsage.peak[slot], now);
+
+    const uint64_t total = tagUsage.current[0].load(std::memory_order_relaxed) + tagUsage.current[1].load(std::memory_order_relaxed);
+    raise(tagUsage.peakTotal, total);
+
+    const uint64_t budget = tagUsage.budget.load(std::memory_order_relaxed);
+    if (budget > 0 && total > budget && !tagUsage.overBudget.exchange(true, std::memory_order_relaxed)) {
+        Engine::Log::Warn(std::format("MemoryTracker: {} passou do orçamento: {:.1f} MB de {:.1f} MB (CPU {:.1f} MB, GPU {:.1f} MB).",
+                                      getMemoryTagName(tag), toMegabytes(total), toMegabytes(budget),
+                                      toMegabytes(tagUsage.current[0].load(std::memory_order_relaxed)),
+                                      toMegabytes(tagUsage.current[1].load(std::memory_order_relaxed))));
+    }
+}
+
+void MemoryTracker::untrack(MemoryTag tag, MemoryDomain domain, size_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+    TagUsage& tagUsage = usage()[indexOf(tag)];
+    tagUsage.current[static_cast<size_t>(domain)].fetch_sub(bytes, std::memory_order_relaxed);
+    tagUsage.allocations.fetch_sub(1, std::memory_order_relaxed);
+
+    const uint64_t budget = tagUsage.budget.load(std::memory_order_relaxed);
+    if (tagUsage.overBudget.load(std::memory_order_relaxed)) {
+        const uint64_t total = tagUsage.current[0].load(std::memory_order_relaxed) + tagUsage.current[1].load(std::memory_order_relaxed);
+        if (total < budget - budget / 10) {
+            tagUsage.overBudget.store(false, std::memory_order_relaxed);
+        }
+    }
+}
+
+void MemoryTracker::trackReleased(MemoryTag tag, size_t bytes) {
+    usage()[indexOf(tag)].released.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::untrackReleased(MemoryTag tag, size_t bytes) {
+    usage()[indexOf(tag)].released.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::setBudget(MemoryTag tag, size_t bytes) {
+    TagUsage& tagUsage = usage()[indexOf(tag)];
+    tagUsage.budget.store(bytes, std::memory_order_relaxed);
+    tagUsage.overBudget.store(false, std::memory_order_relaxed);
+}
+
+MemoryUsage MemoryTracker::getUsage(MemoryTag tag) {
+    const TagUsage& tagUsage = usage()[indexOf(tag)];
+    MemoryUsage result;
+    result.cpuBytes = tagUsage.current[0].load(std::memory_order_relaxed);
+    result.gpuBytes = tagUsage.current[1].load(std::memory_order_relaxed);
+    result.peakCpuBytes = tagUsage.peak[0].load(std::memory_order_relaxed);
+    result.peakGpuBytes = tagUsage.peak[1].load(std::memory_order_relaxed);
+    result.peakTotalBytes = tagUsage.peakTotal.load(std::memory_order_relaxed);
+    result.budgetBytes = tagUsage.budget.load(std::memory_order_relaxed);
+    result.allocations = tagUsage.allocations.load(std::memory_order_relaxed);
+    result.releasedBytes = tagUsage.released.load(std::memory_order_relaxed);
+    return result;
+}
+
+MemoryUsage MemoryTracker::getTotalUsage() {
+    // Os picos somados são um limite superior: cada tag pode ter atingido o seu em momentos diferentes
+    MemoryUsage total;
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        const MemoryUsage tagUsage = getUsage(static_cast<MemoryTag>(i));
+        total.cpuBytes += tagUsage.cpuBytes;
+        total.gpuBytes += tagUsage.gpuBytes;
+        total.peakCpuBytes += tagUsage.peakCpuBytes;
+        total.peakGpuBytes += tagUsage.peakGpuBytes;
+        total.peakTotalBytes += tagUsage.peakTotalBytes;
+        total.budgetBytes += tagUsage.budgetBytes;
+        total.allocations += tagUsage.allocations;
+        total.releasedBytes += tagUsage.releasedBytes;
+    }
+    return total;
+}
+
+void MemoryTracker::logReport() {
+    const MemoryUsage total = getTotalUsage();
+    Engine::Log::Info(std::format("MemoryTracker: {:.1f} MB em uso (CPU {:.1f} MB, GPU {:.1f} MB) em {} recursos.",
+                                  toMegabytes(total.totalBytes()), toMegabytes(total.cpuBytes), toMegabytes(total.gpuBytes), total.allocations));
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        const MemoryTag tag = static_cast<MemoryTag>(i);
+        const MemoryUsage tagUsage = getUsage(tag);
+        if (tagUsage.peakTotalBytes == 0) {
+            continue;
+        }
+        std::string budget = "sem orçamento";
+        if (tagUsage.budgetBytes > 0) {
+            budget = std::format("orçamento {:.1f} MB ({:.0f}%{})", toMegabytes(tagUsage.budgetBytes),
+                                 100.0 * static_cast<double>(tagUsage.totalBytes()) / static_cast<double>(tagUsage.budgetBytes),
+                                 tagUsage.totalBytes() > tagUsage.budgetBytes ? ", ACIMA" : "");
+        }
+        const std::string released =
+            tagUsage.releasedBytes > 0 ? std::format(", {:.2f} MB liberados após o upload", toMegabytes(tagUsage.releasedBytes)) : std::string();
+        Engine::Log::Info(std::format("MemoryTracker:   {:<7} CPU {:8.2f} MB (pico {:8.2f}), GPU {:8.2f} MB (pico {:8.2f}), {} recursos, {}{}.",
+                                      getMemoryTagName(tag), toMegabytes(tagUsage.cpuBytes), toMegabytes(tagUsage.peakCpuBytes),
+                                      toMegabytes(tagUsage.gpuBytes), toMegabytes(tagUsage.peakGpuBytes), tagUsage.allocations, budget,
+                                      released));
+    }
+}
+
+} // namespace Memory
+} // namespace Engine
@@ -0,0 +1,61 @@
+// engine/memory/memory_tracker.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "allocation_counters.h"
+
+namespace Engine {
+namespace Memory {
+
+// Onde a memória mora: RAM do processo ou recursos do driver (buffers e texturas GL)
+enum class MemoryDomain : uint8_t {
+    Cpu = 0,
+    Gpu
+};
+
+// Uso de um subsistema (bytes). O pico é o maior valor já atingido desde o início.
+struct MemoryUsage {
+    uint64_t cpuBytes = 0;
+    uint64_t gpuBytes = 0;
+    uint64_t peakCpuBytes = 0;
+    uint64_t peakGpuBytes = 0;
+    uint64_t peakTotalBytes = 0;  // Pico de CPU + GPU (comparado com o orçamento)
+    uint64_t budgetBytes = 0;     // 0 = sem orçamento
+    uint64_t allocations = 0;     // Recursos vivos registrados (buffers, texturas, blocos de pools e arenas)
+    uint64_t releasedBytes = 0;   // Devolvido por recursos ainda vivos (fora de cpuBytes; ver trackReleased)
+
+    uint64_t totalBytes() const { return cpuBytes + gpuBytes; }
+};
+
+// Memória viva por subsistema, registrada por quem cria e destrói o recurso: meshes (vetores de CPU e
+// buffers GL), texturas (imagem decodificada e mips na GPU), alvos de renderização, terreno, vegetação
+// e os blocos dos pools e arenas de Engine::Memory. Os tamanhos de GPU são calculados na criação a partir
+// do formato (o driver pode alinhar ou duplicar; é uma estimativa por baixo).
+// Cada tag tem um orçamento opcional (MEMORY_BUDGET_*_MB): ao passar dele o uso é avisado no log uma vez,
+// e o aviso é rearmado quando o uso volta para baixo de 90% do orçamento.
+// Thread-safe (atômicos); track/untrack de um mesmo recurso devem usar a mesma tag, domínio e tamanho.
+class MemoryTracker {
+public:
+    MemoryTracker() = delete;
+
+    static void track(MemoryTag tag, MemoryDomain domain, size_t bytes);
+    static void untrack(MemoryTag tag, MemoryDomain domain, size_t bytes);
+    // Memória que um recurso vivo já devolveu (cópias em CPU das meshes GpuOnly, liberadas após o
+    // upload). Não entra no uso nem no orçamento; o relatório mostra a economia. O dono chama
+    // untrackReleased com o mesmo tamanho ao ser destruído.
+    static void trackReleased(MemoryTag tag, size_t bytes);
+    static void untrackReleased(MemoryTag tag, size_t bytes);
+
+    static void setBudget(MemoryTag tag, size_t bytes);
+    static MemoryUsage getUsage(MemoryTag tag);
+    // Soma de todas as tags (o orçamento é a soma dos orçamentos definidos)
+    static MemoryUsage getTotalUsage();
+
+    // Tabela no log: uso atual, pico e orçamento por tag (tags sem uso são omitidas)
+    static void logReport();
+};
+
+} // namespace Memory
+} // namespace Engine
@@ -0,0 +1,76 @@
+// engine/memory/pool_allocator.cpp
+#include "pool_allocator.h"
+#include "memory_tracker.h"
+
+#include <algorithm>
+
+namespace Engine {
+namespace Memory {
+
+PoolAllocator::PoolAllocator(size_t blockSize, size_t blocksPerChunk, MemoryTag tag)
+    : m_blocksPerChunk(std::max<size_t>(blocksPerChunk, 1)), m_tag(tag) {
+    // Cabe o ponteiro da lista livre e todo bloco mantém o alinhamento do início do pedaço
+    constexpr size_t kAlignment = alignof(std::max_align_t);
+    m_blockSize = (std::max(blockSize, sizeof(FreeBlock)) + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+PoolAllocator::~PoolAllocator() {
+    for (void* chunk : m_chunks) {
+        ::operator delete(chunk);
+        MemoryTracker::untrack(m_tag, MemoryDomain::Cpu, m_blockSize * m_blocksPerChunk);
+    }
+}
+
+void PoolAllocator::addChunk() {
+    const size_t bytes = m_blockSize * m_blocksPerChunk;
+    std::byte* chunk = nullptr;
+    {
+        AllocationScope scope(m_tag);
+        chunk = static_cast<std::byte*>(::operator new(bytes));
+    }
+    MemoryTracker::track(m_tag, MemoryDomain::Cpu, bytes);
+    m_chunks.push_back(chunk);
+
+    // Encadeia de trás para frente: os primeiros blocos do pedaço saem primeiro
+    for (size_t i = m_blocksPerChunk; i > 0; --i) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * m_blockSize);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+}
+
+void* PoolAllocator::allocate() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_freeList) {
+        addChunk();
+    }
+    FreeBlock* block = m_freeList;
+    m_freeList = block->next;
+    m_liveCount++;
+    AllocationCounters::recordServed(m_tag);
+    return block;
+}
+
+void PoolAllocator::deallocate(void* pointer) {
+    if (!pointer) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FreeBlock* block = static_cast<FreeBlock*>(pointer);
+    block->next = m_freeList;
+    m_freeList = block;
+    m_liveCount--;
+}
+
+size_t PoolAllocator::getLiveCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_liveCount;
+}
+
+size_t PoolAllocator::getCapacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_chunks.size() * m_blocksPerChunk;
+}
+
+} // namespace Memory
+} // namespace Engine
@@ -0,0 +1,83 @@
+// engine/memory/pool_allocator.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "allocation_counters.h"
+
+namespace Engine {
+namespace Memory {
+
+// Blocos de tamanho fixo tirados de pedaços grandes (um pedido ao sistema a cada 'blocksPerChunk' blocos).
+// Blocos livres formam uma lista encadeada dentro deles mesmos; alocar e liberar são O(1) e a memória
+// nunca volta ao sistema (o pool é reaproveitado). Thread-safe (trava curta por operação).
+class PoolAllocator {
+public:
+    PoolAllocator(size_t blockSize, size_t blocksPerChunk, MemoryTag tag);
+    ~PoolAllocator();
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    void* allocate();
+    void deallocate(void* block);
+
+    size_t getBlockSize() const { return m_blockSize; }
+    size_t getLiveCount() const;
+    size_t getCapacity() const;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    void addChunk();
+
+    size_t m_blockSize;
+    size_t m_blocksPerChunk;
+    MemoryTag m_tag;
+
+    mutable std::mutex m_mutex;
+    FreeBlock* m_freeList = nullptr;
+    std::vector<void*> m_chunks;
+    size_t m_liveCount = 0;
+};
+
+// Base CRTP que troca o new/delete da classe pelo pool do tipo: make_unique<T> continua igual para quem
+// cria o objeto. Classes derivadas maiores que T vão para o heap comum (contadas na tag do pool).
+// O pool de cada tipo nunca é destruído: objetos liberados depois dos destrutores estáticos continuam válidos.
+template <typename T, MemoryTag Tag, size_t BlocksPerChunk = 64>
+class Pooled {
+public:
+    static void* operator new(size_t size) {
+        if (size != sizeof(T)) {
+            AllocationScope scope(Tag);
+            return ::operator new(size);
+        }
+        return pool().allocate();
+    }
+
+    static void operator delete(void* pointer, size_t size) {
+        if (!pointer) {
+            return;
+        }
+        if (size != sizeof(T)) {
+            ::operator delete(pointer);
+            return;
+        }
+        pool().deallocate(pointer);
+    }
+
+    static PoolAllocator& pool() {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Pooled: alinhamento acima do garantido pelo pool");
+        static PoolAllocator* instance = new PoolAllocator(sizeof(T), BlocksPerChunk, Tag);
+        return *instance;
+    }
+};
+
+} // namespace Memory
+} // namespace Engine
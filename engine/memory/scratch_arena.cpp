@@ -0,0 +1,17 @@
+// engine/memory/scratch_arena.cpp
+#include "scratch_arena.h"
+
+namespace Engine {
+namespace Memory {
+
+namespace {
+    constexpr size_t kScratchBlockSize = 256 * 1024;
+}
+
+LinearArena& ScratchArena::get() {
+    thread_local LinearArena arena(kScratchBlockSize, MemoryTag::General);
+    return arena;
+}
+
+} // namespace Memory
+} // namespace Engine
@@ -0,0 +1,59 @@
+// engine/memory/scratch_arena.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "linear_arena.h"
+
+namespace Engine {
+namespace Memory {
+
+// Uma LinearArena por thread para temporários de carregadores e cozimento de malhas (adjacências,
+// cópias de índices antes do upload). Usar dentro de um ScratchScope: ao sair do escopo tudo o que foi
+// alocado nele volta para a arena, então escopos podem ser aninhados (chamadas internas abrem o seu).
+class ScratchArena {
+public:
+    ScratchArena() = delete;
+
+    // Arena da thread atual (criada no primeiro uso)
+    static LinearArena& get();
+};
+
+class ScratchScope {
+public:
+    ScratchScope() : m_arena(ScratchArena::get()), m_marker(m_arena.getMarker()) {}
+    ~ScratchScope() { m_arena.rewind(m_marker); }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+private:
+    LinearArena& m_arena;
+    LinearArena::Marker m_marker;
+};
+
+// Alocador STL sobre a arena da thread que aloca. O contêiner não pode sair do ScratchScope em que foi
+// criado; reserve antes de crescer (a realocação deixa o buffer antigo sem uso até o fim do escopo).
+// Outras threads podem ler e escrever os elementos (ex.: parallelFor), só não realocar.
+template <typename T>
+class ScratchAllocator {
+public:
+    using value_type = T;
+
+    ScratchAllocator() = default;
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>&) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(ScratchArena::get().allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U>&) const { return true; }
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
+} // namespace Memory
+} // namespace Engine
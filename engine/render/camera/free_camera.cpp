@@ -19,7 +19,7 @@ FreeCamera::FreeCamera()
 
 void FreeCamera::setPosition(const glm::vec3& position) { 
     this->position = position;
-    Engine::Log::Debug(std::format("FreeCamera: Posição definida para {}", glm::to_string(position)));
+    ENGINE_LOG_DEBUG("FreeCamera: Posição definida para {}", glm::to_string(position));
 }
 
 const glm::vec3& FreeCamera::getPosition() const { 
@@ -50,7 +50,7 @@ void FreeCamera::processMouseMovement(double xpos, double ypos) {
         m_lastMouseX = xpos;
         m_lastMouseY = ypos;
         m_firstMouse = false;
-        Engine::Log::Debug(std::format("FreeCamera: First mouse movement handled. Initializing lastX: {}, lastY: {}", m_lastMouseX, m_lastMouseY));
+        ENGINE_LOG_DEBUG("FreeCamera: First mouse movement handled. Initializing lastX: {}, lastY: {}", m_lastMouseX, m_lastMouseY);
         return; 
     }
 
@@ -97,10 +97,10 @@ void FreeCamera::processKeyboard(CameraMovement direction, float deltaTime) {
             position -= worldUp * velocity;
             break;
         case ROTATE_LEFT: 
-            Engine::Log::Trace("FreeCamera: Ignoring ROTATE_LEFT keyboard input.");
+            ENGINE_LOG_TRACE("FreeCamera: Ignoring ROTATE_LEFT keyboard input.");
             break;
         case ROTATE_RIGHT: 
-            Engine::Log::Trace("FreeCamera: Ignoring ROTATE_RIGHT keyboard input.");
+            ENGINE_LOG_TRACE("FreeCamera: Ignoring ROTATE_RIGHT keyboard input.");
             break;
     }
 }
@@ -111,7 +111,7 @@ glm::mat4 FreeCamera::getViewMatrix() const {
 
 void FreeCamera::resetMouseState() { 
     m_firstMouse = true;
-    Engine::Log::Debug("FreeCamera: Mouse state reset (m_firstMouse = true).");
+    ENGINE_LOG_DEBUG("FreeCamera: Mouse state reset (m_firstMouse = true).");
 }
 
 void FreeCamera::processScroll(double yOffset) { 
@@ -124,13 +124,13 @@ void FreeCamera::setTarget(const glm::vec3& target) {
 
 void FreeCamera::setZoom(float zoom_value) { 
     zoom = glm::clamp(zoom_value, 1.0f, 90.0f);
-    Engine::Log::Debug(std::format("FreeCamera: Zoom (FOV) definido para {}.", zoom));
+    ENGINE_LOG_DEBUG("FreeCamera: Zoom (FOV) definido para {}.", zoom);
 }
 
 void FreeCamera::setYaw(float yaw_degrees) { 
     yaw = yaw_degrees;
     updateVectors(); 
-    Engine::Log::Trace(std::format("FreeCamera: Yaw definido para {}.", yaw_degrees));
+    ENGINE_LOG_TRACE("FreeCamera: Yaw definido para {}.", yaw_degrees);
 }
 
 // **** NOVOS: Implementação de getForwardVector e getRightVector ****
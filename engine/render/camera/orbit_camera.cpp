@@ -23,20 +23,20 @@ namespace Engine
         void OrbitCamera::setTarget(const glm::vec3 &target)
         {
             target_ = target;
-            Engine::Log::Debug(std::format("OrbitCamera: Target definido para {}", glm::to_string(target_)));
+            ENGINE_LOG_DEBUG("OrbitCamera: Target definido para {}", glm::to_string(target_));
         }
 
         void OrbitCamera::setDistance(float distance)
         {
             distance_ = glm::clamp(distance, 1.0f, 50.0f);
-            Engine::Log::Debug(std::format("OrbitCamera: Distância definida para {}", distance_));
+            ENGINE_LOG_DEBUG("OrbitCamera: Distância definida para {}", distance_);
         }
 
         void OrbitCamera::setRotation(float pitch, float yaw)
         {
             pitch_ = pitch;
             yaw_ = yaw;
-            Engine::Log::Debug(std::format("OrbitCamera: Rotação definida (pitch: {}, yaw: {}).", pitch_, yaw_));
+            ENGINE_LOG_DEBUG("OrbitCamera: Rotação definida (pitch: {}, yaw: {}).", pitch_, yaw_);
         }
 
         void OrbitCamera::processMouseMovement(double xpos, double ypos)
@@ -46,7 +46,7 @@ namespace Engine
                 m_lastMouseX = xpos;
                 m_lastMouseY = ypos;
                 m_firstMouse = false;
-                Engine::Log::Debug(std::format("OrbitCamera: First mouse movement handled. Initializing lastX: {}, lastY: {}", m_lastMouseX, m_lastMouseY));
+                ENGINE_LOG_DEBUG("OrbitCamera: First mouse movement handled. Initializing lastX: {}, lastY: {}", m_lastMouseX, m_lastMouseY);
                 return;
             }
 
@@ -63,13 +63,13 @@ namespace Engine
 
             pitch_ = glm::clamp(pitch_, -0.8f, 0.8f);
 
-            Engine::Log::Trace(std::format("OrbitCamera: Mouse moved (deltaX: {}, deltaY: {}). Pitch: {}, Yaw: {}.", deltaX, deltaY, pitch_, yaw_));
+            ENGINE_LOG_TRACE("OrbitCamera: Mouse moved (deltaX: {}, deltaY: {}). Pitch: {}, Yaw: {}.", deltaX, deltaY, pitch_, yaw_);
         }
 
         void OrbitCamera::processScroll(double yOffset)
         {
             setDistance(distance_ - static_cast<float>(yOffset));
-            Engine::Log::Debug(std::format("OrbitCamera: Processed scroll. New distance: {}.", distance_));
+            ENGINE_LOG_DEBUG("OrbitCamera: Processed scroll. New distance: {}.", distance_);
         }
 
         void OrbitCamera::processKeyboard(CameraMovement direction, float deltaTime)
@@ -129,19 +129,19 @@ namespace Engine
         void OrbitCamera::resetMouseState()
         { // REMOVIDO: override
             m_firstMouse = true;
-            Engine::Log::Debug("OrbitCamera: Mouse state reset (m_firstMouse = true).");
+            ENGINE_LOG_DEBUG("OrbitCamera: Mouse state reset (m_firstMouse = true).");
         }
 
         void OrbitCamera::setZoom(float zoom_value)
         { // REMOVIDO: override
             m_zoom = glm::clamp(zoom_value, 1.0f, 90.0f);
-            Engine::Log::Debug(std::format("OrbitCamera: Zoom (FOV) definido para {}.", m_zoom));
+            ENGINE_LOG_DEBUG("OrbitCamera: Zoom (FOV) definido para {}.", m_zoom);
         }
 
         void OrbitCamera::setYaw(float yaw_degrees)
         { // REMOVIDO: override
             yaw_ = yaw_degrees;
-            Engine::Log::Trace(std::format("OrbitCamera: Yaw definido para {}.", yaw_degrees));
+            ENGINE_LOG_TRACE("OrbitCamera: Yaw definido para {}.", yaw_degrees);
         }
 
     } // namespace Camera
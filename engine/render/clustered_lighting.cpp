@@ -0,0 +1,63 @@
+// engine/render/clustered_lighting.cpp
+#include "clustered_lighting.h"
+#include "command_list.h"
+#include "./../core/config.h"
+
+namespace Engine {
+namespace Render {
+
+namespace {
+    // Recria o buffer com o tamanho exato (orphaning) e associa ao binding; nunca vazio para o bind ser válido
+    template <typename T>
+    void uploadStorage(GLuint& buffer, GLuint binding, const std::vector<T>& data) {
+        if (buffer == 0) {
+            glCreateBuffers(1, &buffer);
+        }
+        static const T empty{};
+        const void* bytes = data.empty() ? static_cast<const void*>(&empty) : static_cast<const void*>(data.data());
+        GLsizeiptr size = static_cast<GLsizeiptr>(data.empty() ? sizeof(T) : data.size() * sizeof(T));
+        glNamedBufferData(buffer, size, bytes, GL_STREAM_DRAW);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, buffer);
+    }
+}
+
+LightClusterBuffers::~LightClusterBuffers() {
+    GLuint buffers[] = {m_lightBuffer, m_clusterBuffer, m_indexBuffer};
+    glDeleteBuffers(3, buffers);
+}
+
+void LightClusterBuffers::upload(const std::vector<GpuPointLight>& lights, const std::vector<GpuCluster>& clusters,
+                                 const std::vector<uint32_t>& lightIndices) {
+    const GLuint binding = static_cast<GLuint>(Engine::CLUSTER_LIGHT_BINDING);
+    uploadStorage(m_lightBuffer, binding, lights);
+    uploadStorage(m_clusterBuffer, binding + 1, clusters);
+    uploadStorage(m_indexBuffer, binding + 2, lightIndices);
+}
+
+ClusteredLighting::ClusteredLighting()
+    : m_buffers(std::make_shared<LightClusterBuffers>()) {
+}
+
+void ClusteredLighting::build(const std::vector<PointLight>& lights, const glm::mat4& view, const glm::mat4& projection) {
+    m_grid.build(lights, view, projection);
+}
+
+void ClusteredLighting::record(CommandList& commands) const {
+    // A lista do frame pode ser reproduzida enquanto o próximo build acontece: o upload leva uma cópia
+    commands.upload([buffers = m_buffers, lights = m_grid.getLights(), clusters = m_grid.getClusters(),
+                     indices = m_grid.getLightIndices()]() {
+        buffers->upload(lights, clusters, indices);
+    });
+    recordUniforms(commands);
+}
+
+void ClusteredLighting::recordUniforms(CommandList& commands) const {
+    commands.setUniform("uClusterGrid", glm::vec4(static_cast<float>(Engine::CLUSTER_GRID_X),
+                                                  static_cast<float>(Engine::CLUSTER_GRID_Y),
+                                                  static_cast<float>(Engine::CLUSTER_GRID_Z),
+                                                  m_grid.getSliceScale()));
+    commands.setUniform("uClusterNear", m_grid.getNear());
+}
+
+} // namespace Render
+} // namespace Engine
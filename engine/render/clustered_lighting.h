@@ -0,0 +1,55 @@
+// engine/render/clustered_lighting.h
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include "light.h"
+#include "light_clusters.h"
+
+namespace Engine {
+namespace Render {
+
+class CommandList;
+
+// Buffers GL (SSBOs) consumidos por basic.frag. Só são tocados na thread de renderização.
+class LightClusterBuffers {
+public:
+    LightClusterBuffers() = default;
+    ~LightClusterBuffers();
+
+    LightClusterBuffers(const LightClusterBuffers&) = delete;
+    LightClusterBuffers& operator=(const LightClusterBuffers&) = delete;
+
+    void upload(const std::vector<GpuPointLight>& lights, const std::vector<GpuCluster>& clusters,
+                const std::vector<uint32_t>& lightIndices);
+
+private:
+    GLuint m_lightBuffer = 0;   // binding = CLUSTER_LIGHT_BINDING
+    GLuint m_clusterBuffer = 0; // binding = CLUSTER_LIGHT_BINDING + 1
+    GLuint m_indexBuffer = 0;   // binding = CLUSTER_LIGHT_BINDING + 2
+};
+
+// Forward clusterizado: atribui as luzes aos froxels na thread principal e grava o upload dos SSBOs
+// e os uniforms da grade na CommandList do frame.
+class ClusteredLighting {
+public:
+    ClusteredLighting();
+
+    void build(const std::vector<PointLight>& lights, const glm::mat4& view, const glm::mat4& projection);
+    // Deve ser gravado depois do bindShader do shader que usa os clusters
+    void record(CommandList& commands) const;
+    // Só os uniforms (para um segundo shader no mesmo frame; os buffers já foram enviados por record)
+    void recordUniforms(CommandList& commands) const;
+
+    const LightClusterGrid& getGrid() const { return m_grid; }
+
+private:
+    LightClusterGrid m_grid;
+    std::shared_ptr<LightClusterBuffers> m_buffers; // Compartilhado com os uploads gravados
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,171 @@
+// engine/render/command_list.cpp
+#include "command_list.h"
+#include "shader.h"
+#include "gpu_profiler.h"
+#include "./../asset/model.h"
+#include "./../core/log.h"
+
+#include <algorithm>
+#include <format>
+#include <type_traits>
+
+namespace Engine {
+namespace Render {
+
+void CommandList::setViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    m_commands.emplace_back(SetViewportCommand{x, y, width, height});
+}
+
+void CommandList::clear(const glm::vec4& color, GLbitfield mask) {
+    m_commands.emplace_back(ClearCommand{color, mask});
+}
+
+void CommandList::setDepthState(GLenum func, bool write) {
+    m_commands.emplace_back(DepthStateCommand{func, write});
+}
+
+void CommandList::bindShader(const Shader* shader) {
+    m_commands.emplace_back(BindShaderCommand{shader});
+}
+
+void CommandList::setUniform(const char* name, int value) {
+    m_commands.emplace_back(SetUniformCommand{name, value});
+}
+
+void CommandList::setUniform(const char* name, float value) {
+    m_commands.emplace_back(SetUniformCommand{name, value});
+}
+
+void CommandList::setUniform(const char* name, const glm::vec3& value) {
+    m_commands.emplace_back(SetUniformCommand{name, value});
+}
+
+void CommandList::setUniform(const char* name, const glm::vec4& value) {
+    m_commands.emplace_back(SetUniformCommand{name, value});
+}
+
+void CommandList::setUniform(const char* name, const glm::mat4& value) {
+    m_commands.emplace_back(SetUniformCommand{name, value});
+}
+
+void CommandList::drawMesh(const Asset::Mesh* mesh, const glm::mat4& modelMatrix, uint32_t lod, float lodFade) {
+    m_commands.emplace_back(DrawMeshCommand{mesh, modelMatrix, lod, lodFade});
+}
+
+void CommandList::drawMeshDepthOnly(const Asset::Mesh* mesh, const glm::mat4& modelMatrix, uint32_t lod) {
+    m_commands.emplace_back(DrawMeshCommand{mesh, modelMatrix, lod, 1.0f, true});
+}
+
+void CommandList::upload(std::function<void()> upload) {
+    m_commands.emplace_back(UploadCommand{std::move(upload)});
+}
+
+void CommandList::beginGpuZone(const char* name) {
+    m_commands.emplace_back(GpuZoneCommand{name});
+}
+
+void CommandList::endGpuZone() {
+    m_commands.emplace_back(GpuZoneCommand{nullptr});
+}
+
+void CommandList::sortDrawPackets(std::vector<DrawPacket>& packets) {
+    std::sort(packets.begin(), packets.end(), [](const DrawPacket& a, const DrawPacket& b) {
+        if (a.sortKey != b.sortKey) return a.sortKey < b.sortKey;
+        if (a.objectIndex != b.objectIndex) return a.objectIndex < b.objectIndex;
+        return a.sequence < b.sequence;
+    });
+}
+
+void CommandList::mergeDrawPackets(const std::vector<std::vector<DrawPacket>>& jobPackets, std::vector<DrawPacket>& merged) {
+    merged.clear();
+    for (const std::vector<DrawPacket>& packets : jobPackets) {
+        merged.insert(merged.end(), packets.begin(), packets.end());
+    }
+    sortDrawPackets(merged);
+}
+
+void CommandList::appendDrawPackets(const std::vector<DrawPacket>& sortedPackets, bool depthOnly) {
+    m_commands.reserve(m_commands.size() + sortedPackets.size());
+    for (const DrawPacket& packet : sortedPackets) {
+        DrawMeshCommand command = packet.command;
+        command.depthOnly = command.depthOnly || depthOnly;
+        m_commands.emplace_back(command);
+    }
+}
+
+uint32_t CommandList::appendIndexRanges(const std::vector<Asset::IndexRange>& ranges) {
+    const uint32_t offset = static_cast<uint32_t>(m_indexRanges.size());
+    m_indexRanges.insert(m_indexRanges.end(), ranges.begin(), ranges.end());
+    return offset;
+}
+
+void CommandList::reset() {
+    m_commands.clear();
+    m_indexRanges.clear();
+}
+
+void CommandList::execute() const {
+    const Shader* currentShader = nullptr;
+
+    for (const RenderCommand& command : m_commands) {
+        std::visit([this, &currentShader](const auto& cmd) {
+            using T = std::decay_t<decltype(cmd)>;
+
+            if constexpr (std::is_same_v<T, SetViewportCommand>) {
+                glViewport(cmd.x, cmd.y, cmd.width, cmd.height);
+            } else if constexpr (std::is_same_v<T, ClearCommand>) {
+                glClearColor(cmd.color.r, cmd.color.g, cmd.color.b, cmd.color.a);
+                glClear(cmd.mask);
+            } else if constexpr (std::is_same_v<T, DepthStateCommand>) {
+                glDepthFunc(cmd.func);
+                glDepthMask(cmd.write ? GL_TRUE : GL_FALSE);
+            } else if constexpr (std::is_same_v<T, BindShaderCommand>) {
+                currentShader = cmd.shader;
+                if (currentShader) {
+                    currentShader->use();
+                }
+            } else if constexpr (std::is_same_v<T, SetUniformCommand>) {
+                if (!currentShader) {
+                    return;
+                }
+                std::visit([&](const auto& value) {
+                    using V = std::decay_t<decltype(value)>;
+                    if constexpr (std::is_same_v<V, int>) { currentShader->setInt(cmd.name, value); }
+                    else if constexpr (std::is_same_v<V, float>) { currentShader->setFloat(cmd.name, value); }
+                    else if constexpr (std::is_same_v<V, glm::vec3>) { currentShader->setVec3(cmd.name, value); }
+                    else if constexpr (std::is_same_v<V, glm::vec4>) { currentShader->setVec4(cmd.name, value); }
+                    else if constexpr (std::is_same_v<V, glm::mat4>) { currentShader->setMat4(cmd.name, value); }
+                }, cmd.value);
+            } else if constexpr (std::is_same_v<T, DrawMeshCommand>) {
+                if (!currentShader || !cmd.mesh) {
+                    Engine::Log::Warn("CommandList: DrawMesh sem shader ativo ou sem mesh. Ignorando.");
+                    return;
+                }
+                // Todos os shaders de desenho (inclusive os de profundidade) aplicam o dither de LOD,
+                // senão o pré-pass e o pass principal divergiriam durante o cross-fade
+                currentShader->setMat4("uModel", cmd.modelMatrix);
+                currentShader->setFloat("uLodFade", cmd.lodFade);
+                if (cmd.rangeCount > 0) {
+                    cmd.mesh->drawRanges(*currentShader, m_indexRanges.data() + cmd.rangeOffset, cmd.rangeCount, cmd.depthOnly);
+                } else if (cmd.depthOnly) {
+                    cmd.mesh->drawDepthOnly(*currentShader, cmd.lod);
+                } else {
+                    cmd.mesh->draw(*currentShader, cmd.lod);
+                }
+            } else if constexpr (std::is_same_v<T, UploadCommand>) {
+                if (cmd.upload) {
+                    cmd.upload();
+                }
+            } else if constexpr (std::is_same_v<T, GpuZoneCommand>) {
+                if (cmd.name) {
+                    GpuProfiler::Get().beginZone(cmd.name);
+                } else {
+                    GpuProfiler::Get().endZone();
+                }
+            }
+        }, command);
+    }
+}
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,139 @@
+// engine/render/command_list.h
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <variant>
+#include <vector>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include "./../asset/meshlet.h" // Asset::IndexRange
+
+// Forward declarations
+namespace Engine {
+namespace Asset {
+    class Mesh;
+}
+namespace Render {
+    class Shader;
+}
+} // namespace Engine
+
+namespace Engine {
+namespace Render {
+
+// --- Comandos gravados pela thread principal e reproduzidos pela thread de renderização ---
+
+struct SetViewportCommand {
+    GLint x, y;
+    GLsizei width, height;
+};
+
+struct ClearCommand {
+    glm::vec4 color;
+    GLbitfield mask;
+};
+
+// Teste/escrita de profundidade (ex.: GL_EQUAL sem escrita depois do pré-pass)
+struct DepthStateCommand {
+    GLenum func;
+    bool write;
+};
+
+struct BindShaderCommand {
+    const Shader* shader;
+};
+
+// 'name' deve ter duração estática (literal): o comando só guarda o ponteiro
+struct SetUniformCommand {
+    const char* name;
+    std::variant<int, float, glm::vec3, glm::vec4, glm::mat4> value;
+};
+
+// Pacote de desenho: uma mesh, sua transformação e a LOD escolhida na gravação
+struct DrawMeshCommand {
+    const Asset::Mesh* mesh;
+    glm::mat4 modelMatrix;
+    uint32_t lod;
+    float lodFade; // Ver uLodFade em basic.frag (1.0 = sem cross-fade)
+    bool depthOnly = false; // Passes de profundidade: stream só de posições, sem material
+    // Faixas de meshlets visíveis em CommandList::getIndexRanges; 0 = LOD inteira
+    uint32_t rangeOffset = 0;
+    uint32_t rangeCount = 0;
+};
+
+// Trabalho arbitrário que precisa do contexto GL (upload de buffers, texturas, liberação de recursos)
+struct UploadCommand {
+    std::function<void()> upload;
+};
+
+// Abre (name != nullptr) ou fecha a zona de tempo de GPU atual (GpuProfiler). 'name' deve ser literal.
+struct GpuZoneCommand {
+    const char* name;
+};
+
+// Desenho gravado por um job de gravação paralela, antes da junção e ordenação.
+// A chave completa (sortKey, objectIndex, sequence) é única, então a ordem final é determinística
+// independentemente de quantas threads gravaram ou de como os blocos foram distribuídos.
+struct DrawPacket {
+    uint64_t sortKey;     // Agrupa trocas de estado (ver Asset::Mesh::getSortId)
+    uint32_t objectIndex; // Índice do objeto na cena
+    uint32_t sequence;    // Ordem dentro do objeto (mesh e passo de cross-fade)
+    DrawMeshCommand command;
+};
+
+using RenderCommand = std::variant<SetViewportCommand, ClearCommand, DepthStateCommand, BindShaderCommand,
+                                   SetUniformCommand, DrawMeshCommand, UploadCommand, GpuZoneCommand>;
+
+// Lista de comandos de um frame. A gravação não toca no OpenGL; execute() só pode ser chamado
+// na thread que possui o contexto GL.
+class CommandList {
+public:
+    CommandList() = default;
+
+    void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    void clear(const glm::vec4& color, GLbitfield mask);
+    void setDepthState(GLenum func, bool write);
+    void bindShader(const Shader* shader);
+    void setUniform(const char* name, int value);
+    void setUniform(const char* name, float value);
+    void setUniform(const char* name, const glm::vec3& value);
+    void setUniform(const char* name, const glm::vec4& value);
+    void setUniform(const char* name, const glm::mat4& value);
+    void drawMesh(const Asset::Mesh* mesh, const glm::mat4& modelMatrix, uint32_t lod, float lodFade = 1.0f);
+    void drawMeshDepthOnly(const Asset::Mesh* mesh, const glm::mat4& modelMatrix, uint32_t lod);
+    void upload(std::function<void()> upload);
+    // Mede o tempo de GPU dos comandos entre as duas chamadas (pares aninháveis)
+    void beginGpuZone(const char* name);
+    void endGpuZone();
+
+    // Ordena pela chave completa (sortKey, objectIndex, sequence)
+    static void sortDrawPackets(std::vector<DrawPacket>& packets);
+    // Junta os buffers de pacotes (um por job) em 'merged' e ordena. 'merged' é reaproveitado entre frames.
+    static void mergeDrawPackets(const std::vector<std::vector<DrawPacket>>& jobPackets, std::vector<DrawPacket>& merged);
+    // Grava os DrawMesh de pacotes já ordenados; 'depthOnly' força a versão só de profundidade (pré-pass)
+    void appendDrawPackets(const std::vector<DrawPacket>& sortedPackets, bool depthOnly = false);
+
+    // Copia faixas de índices para a lista (válidas até o reset) e retorna a posição da primeira;
+    // DrawMeshCommand::rangeOffset aponta para cá
+    uint32_t appendIndexRanges(const std::vector<Asset::IndexRange>& ranges);
+    const std::vector<Asset::IndexRange>& getIndexRanges() const { return m_indexRanges; }
+
+    // Limpa os comandos mantendo a capacidade (sem alocações no regime permanente)
+    void reset();
+
+    size_t size() const { return m_commands.size(); }
+    const std::vector<RenderCommand>& getCommands() const { return m_commands; }
+
+    // Reproduz os comandos no contexto GL atual
+    void execute() const;
+
+private:
+    std::vector<RenderCommand> m_commands;
+    std::vector<Asset::IndexRange> m_indexRanges;
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,52 @@
+// engine/render/frustum.cpp
+#include "frustum.h"
+
+namespace Engine {
+namespace Render {
+
+Frustum::Frustum(const glm::mat4& viewProjection) {
+    // Gribb & Hartmann: cada plano é a soma/diferença da 4ª linha com as linhas x, y, z
+    const glm::mat4& m = viewProjection;
+    glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    m_planes[0] = row3 + row0; // Esquerda
+    m_planes[1] = row3 - row0; // Direita
+    m_planes[2] = row3 + row1; // Baixo
+    m_planes[3] = row3 - row1; // Cima
+    m_planes[4] = row3 + row2; // Perto
+    m_planes[5] = row3 - row2; // Longe
+
+    for (glm::vec4& plane : m_planes) {
+        float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) {
+            plane /= length;
+        }
+    }
+}
+
+bool Frustum::intersectsSphere(const glm::vec3& center, float radius) const {
+    for (const glm::vec4& plane : m_planes) {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::intersectsBox(const glm::vec3& min, const glm::vec3& max) const {
+    for (const glm::vec4& plane : m_planes) {
+        glm::vec3 positive(plane.x >= 0.0f ? max.x : min.x,
+                           plane.y >= 0.0f ? max.y : min.y,
+                           plane.z >= 0.0f ? max.z : min.z);
+        if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,26 @@
+// engine/render/frustum.h
+#pragma once
+
+#include <array>
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Render {
+
+// Frustum de visão como 6 planos (normal apontando para dentro), extraídos da matriz projeção * visão
+class Frustum {
+public:
+    Frustum() = default;
+    explicit Frustum(const glm::mat4& viewProjection);
+
+    // true se a esfera toca o volume (conservador: esferas perto dos cantos podem passar)
+    bool intersectsSphere(const glm::vec3& center, float radius) const;
+    // true se a caixa alinhada aos eixos toca o volume (teste do vértice mais positivo de cada plano)
+    bool intersectsBox(const glm::vec3& min, const glm::vec3& max) const;
+
+private:
+    std::array<glm::vec4, 6> m_planes{}; // xyz = normal, w = distância
+};
+
+} // namespace Render
+} // namespace Engine
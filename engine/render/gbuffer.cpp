@@ -0,0 +1,115 @@
+// engine/render/gbuffer.cpp
+#include "gbuffer.h"
+#include "./../core/log.h"
+#include "./../memory/memory_tracker.h"
+
+#include <format>
+
+namespace Engine {
+namespace Render {
+
+namespace {
+    constexpr GLenum kColorFormats[GBuffer::kColorTargets] = {GL_RGBA8, GL_RG16_SNORM, GL_RGBA8, GL_R11F_G11F_B10F};
+}
+
+GBuffer::~GBuffer() {
+    destroyTargets();
+    if (m_emptyVAO) {
+        glDeleteVertexArrays(1, &m_emptyVAO);
+    }
+}
+
+void GBuffer::destroyTargets() {
+    if (m_framebuffer) {
+        Memory::MemoryTracker::untrack(Memory::MemoryTag::Render, Memory::MemoryDomain::Gpu, getGpuBytes());
+        glDeleteFramebuffers(1, &m_framebuffer);
+        m_framebuffer = 0;
+    }
+    glDeleteTextures(kColorTargets, m_colorTextures);
+    for (GLuint& texture : m_colorTextures) {
+        texture = 0;
+    }
+    if (m_depthTexture) {
+        glDeleteTextures(1, &m_depthTexture);
+        m_depthTexture = 0;
+    }
+}
+
+void GBuffer::resize(int width, int height) {
+    destroyTargets();
+    m_width = width;
+    m_height = height;
+
+    glCreateFramebuffers(1, &m_framebuffer);
+
+    GLenum drawBuffers[kColorTargets];
+    for (int i = 0; i < kColorTargets; ++i) {
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_colorTextures[i]);
+        glTextureStorage2D(m_colorTextures[i], 1, kColorFormats[i], width, height);
+        glTextureParameteri(m_colorTextures[i], GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(m_colorTextures[i], GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_colorTextures[i], GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_colorTextures[i], GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glNamedFramebufferTexture(m_framebuffer, GL_COLOR_ATTACHMENT0 + i, m_colorTextures[i], 0);
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    }
+    glNamedFramebufferDrawBuffers(m_framebuffer, kColorTargets, drawBuffers);
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_depthTexture);
+    glTextureStorage2D(m_depthTexture, 1, GL_DEPTH_COMPONENT32F, width, height);
+    glTextureParameteri(m_depthTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTextureParameteri(m_depthTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glNamedFramebufferTexture(m_framebuffer, GL_DEPTH_ATTACHMENT, m_depthTexture, 0);
+
+    Memory::MemoryTracker::track(Memory::MemoryTag::Render, Memory::MemoryDomain::Gpu, getGpuBytes());
+
+    GLenum status = glCheckNamedFramebufferStatus(m_framebuffer, GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        Engine::Log::Error(std::format("GBuffer: framebuffer incompleto (0x{:X}).", status));
+    } else {
+        Engine::Log::Info(std::format("GBuffer: alvos recriados em {}x{}.", width, height));
+    }
+}
+
+void GBuffer::beginGeometryPass() {
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    if (viewport[2] != m_width || viewport[3] != m_height || !m_framebuffer) {
+        resize(viewport[2], viewport[3]);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+    const float zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < kColorTargets; ++i) {
+        glClearNamedFramebufferfv(m_framebuffer, GL_COLOR, i, zero);
+    }
+    const float farDepth = 1.0f;
+    glClearNamedFramebufferfv(m_framebuffer, GL_DEPTH, 0, &farDepth);
+}
+
+void GBuffer::endGeometryPass() {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void GBuffer::bindTextures(GLuint firstUnit) const {
+    for (int i = 0; i < kColorTargets; ++i) {
+        glBindTextureUnit(firstUnit + i, m_colorTextures[i]);
+    }
+    glBindTextureUnit(firstUnit + kColorTargets, m_depthTexture);
+}
+
+void GBuffer::drawFullscreen() {
+    if (!m_emptyVAO) {
+        glCreateVertexArrays(1, &m_emptyVAO);
+    }
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glBindVertexArray(m_emptyVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_DEPTH_TEST);
+}
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,53 @@
+// engine/render/gbuffer.h
+#pragma once
+
+#include <glad/gl.h>
+#include <cstddef>
+
+namespace Engine {
+namespace Render {
+
+// G-buffer do modo deferred:
+//   0: RGBA8        cor base
+//   1: RG16_SNORM   normal (octaedro)
+//   2: RGBA8        metallic, roughness, oclusão
+//   3: R11F_G11F_B10F emissiva
+//   profundidade: DEPTH_COMPONENT32F (posição reconstruída no resolve)
+// Só pode ser usado na thread que possui o contexto GL; os alvos acompanham o tamanho do viewport.
+class GBuffer {
+public:
+    static constexpr int kColorTargets = 4;
+
+    GBuffer() = default;
+    ~GBuffer();
+
+    GBuffer(const GBuffer&) = delete;
+    GBuffer& operator=(const GBuffer&) = delete;
+
+    // Redimensiona para o viewport atual se preciso, liga o framebuffer e limpa cor/profundidade
+    void beginGeometryPass();
+    // Volta ao framebuffer padrão
+    void endGeometryPass();
+
+    // Liga os alvos nas unidades firstUnit..firstUnit+4 (profundidade por último)
+    void bindTextures(GLuint firstUnit) const;
+    // Desenha o triângulo de tela cheia do resolve (sem teste/escrita de profundidade)
+    void drawFullscreen();
+
+    // Quatro alvos de cor de 32 bits e a profundidade de 32 bits por pixel (registrado no MemoryTracker)
+    size_t getGpuBytes() const { return m_framebuffer ? static_cast<size_t>(m_width) * static_cast<size_t>(m_height) * (kColorTargets + 1) * 4 : 0; }
+
+private:
+    void resize(int width, int height);
+    void destroyTargets();
+
+    int m_width = 0;
+    int m_height = 0;
+    GLuint m_framebuffer = 0;
+    GLuint m_colorTextures[kColorTargets] = {0, 0, 0, 0};
+    GLuint m_depthTexture = 0;
+    GLuint m_emptyVAO = 0; // O core profile exige um VAO ligado mesmo sem atributos
+};
+
+} // namespace Render
+} // namespace Engine
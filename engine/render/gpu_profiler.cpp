@@ -0,0 +1,193 @@
+// engine/render/gpu_profiler.cpp
+#include "gpu_profiler.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+
+#include <algorithm>
+#include <format>
+
+namespace Engine {
+namespace Render {
+
+namespace {
+    constexpr size_t kNoQuery = static_cast<size_t>(-1);
+    constexpr size_t kQueryBatch = 16; // Queries criadas de uma vez quando um slot precisa de mais
+}
+
+GpuProfiler& GpuProfiler::Get() {
+    static GpuProfiler instance;
+    return instance;
+}
+
+bool GpuProfiler::initialize() {
+    m_initialized = true;
+
+    // Timer queries são núcleo do GL 3.3; GL_QUERY_COUNTER_BITS = 0 indica timestamps sem suporte real
+    bool supported = Engine::RENDER_GPU_PROFILER_ENABLED && GLAD_GL_VERSION_3_3;
+    if (supported) {
+        GLint bits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+        supported = bits > 0;
+    }
+    if (supported) {
+        m_track = Profiling::Profiler::createTrack("GPU");
+        Engine::Log::Info(std::format("GpuProfiler: queries GL_TIMESTAMP com {} frame(s) de atraso.", kLatency));
+    } else {
+        Engine::Log::Info("GpuProfiler: desligado (sem timer queries no contexto ou RENDER_GPU_PROFILER_ENABLED = false).");
+    }
+
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    m_supported = supported;
+    return supported;
+}
+
+void GpuProfiler::beginFrame() {
+    if (!m_initialized) {
+        initialize();
+    }
+    if (!isSupported()) {
+        return;
+    }
+
+    // O slot foi usado kLatency frames atrás: lê se já estiver pronto, senão descarta
+    FrameSlot& slot = m_slots[m_current];
+    if (slot.pending) {
+        collect(slot);
+    }
+    slot.used = 0;
+    slot.zones.clear();
+
+    // Relógios da CPU e da GPU no mesmo instante (glGet de GL_TIMESTAMP não espera os comandos anteriores)
+    GLint64 gpuNow = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+    slot.clockOffsetNs = static_cast<int64_t>(Profiling::Profiler::now()) - static_cast<int64_t>(gpuNow);
+
+    m_inFrame = true;
+    m_openZones.clear();
+    beginZone("Frame");
+}
+
+void GpuProfiler::endFrame() {
+    if (!m_inFrame) {
+        return;
+    }
+    while (!m_openZones.empty()) {
+        endZone(); // Inclui a zona do frame e zonas que a gravação esqueceu de fechar
+    }
+    m_slots[m_current].pending = true;
+    m_current = (m_current + 1) % kLatency;
+    m_inFrame = false;
+}
+
+void GpuProfiler::beginZone(const char* name) {
+    if (!m_inFrame) {
+        return;
+    }
+    FrameSlot& slot = m_slots[m_current];
+    slot.zones.push_back({name, writeTimestamp(slot), kNoQuery});
+    m_openZones.push_back(slot.zones.size() - 1);
+}
+
+void GpuProfiler::endZone() {
+    if (!m_inFrame || m_openZones.empty()) {
+        return;
+    }
+    FrameSlot& slot = m_slots[m_current];
+    slot.zones[m_openZones.back()].endQuery = writeTimestamp(slot);
+    m_openZones.pop_back();
+}
+
+size_t GpuProfiler::writeTimestamp(FrameSlot& slot) {
+    if (slot.used == slot.queries.size()) {
+        const size_t first = slot.queries.size();
+        slot.queries.resize(first + kQueryBatch);
+        glGenQueries(static_cast<GLsizei>(kQueryBatch), slot.queries.data() + first);
+    }
+    glQueryCounter(slot.queries[slot.used], GL_TIMESTAMP);
+    return slot.used++;
+}
+
+void GpuProfiler::collect(FrameSlot& slot) {
+    slot.pending = false;
+    if (slot.used == 0) {
+        return;
+    }
+
+    // A última query do frame pronta implica todas as anteriores prontas
+    GLint available = 0;
+    glGetQueryObjectiv(slot.queries[slot.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        std::lock_guard<std::mutex> lock(m_resultsMutex);
+        ++m_droppedFrames; // GPU mais de kLatency frames atrasada: perde a amostra em vez de esperar
+        return;
+    }
+
+    std::vector<GLuint64>& timestamps = m_timestamps;
+    timestamps.resize(slot.used);
+    for (size_t i = 0; i < slot.used; ++i) {
+        glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+
+    double frameMs = 0.0;
+    std::vector<GpuPassTime>& passes = m_collectedPasses;
+    passes.clear();
+    for (size_t i = 0; i < slot.zones.size(); ++i) {
+        const Zone& zone = slot.zones[i];
+        if (zone.endQuery == kNoQuery) {
+            continue;
+        }
+        const GLuint64 startGpu = timestamps[zone.beginQuery];
+        const GLuint64 endGpu = std::max(timestamps[zone.endQuery], startGpu);
+        const double ms = static_cast<double>(endGpu - startGpu) / 1.0e6;
+        Profiling::Profiler::recordZone(m_track, zone.name, static_cast<uint64_t>(static_cast<int64_t>(startGpu) + slot.clockOffsetNs),
+                                        static_cast<uint64_t>(static_cast<int64_t>(endGpu) + slot.clockOffsetNs));
+        if (i == 0) {
+            frameMs = ms; // Zona do frame inteiro, aberta em beginFrame
+            continue;
+        }
+
+        auto existing = std::find_if(passes.begin(), passes.end(), [&](const GpuPassTime& pass) { return std::string_view(pass.name) == zone.name; });
+        if (existing != passes.end()) {
+            existing->ms += ms;
+        } else {
+            passes.push_back({zone.name, ms});
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    m_lastPasses.swap(passes);
+    m_lastFrameMs = frameMs;
+}
+
+bool GpuProfiler::isSupported() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_supported;
+}
+
+double GpuProfiler::getPassMs(std::string_view name) const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    for (const GpuPassTime& pass : m_lastPasses) {
+        if (name == pass.name) {
+            return pass.ms;
+        }
+    }
+    return 0.0;
+}
+
+std::vector<GpuPassTime> GpuProfiler::getPassTimes() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_lastPasses;
+}
+
+double GpuProfiler::getFrameMs() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_lastFrameMs;
+}
+
+uint64_t GpuProfiler::getDroppedFrames() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_droppedFrames;
+}
+
+} // namespace Render
+} // namespace Engine
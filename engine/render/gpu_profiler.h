@@ -0,0 +1,92 @@
+// engine/render/gpu_profiler.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <glad/gl.h>
+
+#include "./../core/profiler.h"
+
+namespace Engine {
+namespace Render {
+
+// Tempo de GPU de um pass no último frame lido (zonas com o mesmo nome são somadas)
+struct GpuPassTime {
+    const char* name;
+    double ms;
+};
+
+// Tempo de GPU por pass com pares de queries GL_TIMESTAMP. As zonas são gravadas na CommandList
+// (beginGpuZone/endGpuZone) e reproduzidas na thread do contexto; cada frame usa um slot de um anel
+// de kLatency frames, lido só quando o slot volta a ser usado, então nada espera a GPU (um slot ainda
+// não pronto é descartado). Os resultados vão para a trilha "GPU" do Profiling::Profiler, alinhados ao
+// relógio da CPU por uma leitura de GL_TIMESTAMP no início de cada frame, e ficam disponíveis por nome.
+// Sem timer queries no contexto (ou com RENDER_GPU_PROFILER_ENABLED = false) tudo vira no-op.
+class GpuProfiler {
+public:
+    static constexpr int kLatency = 4;
+
+    static GpuProfiler& Get();
+
+    // Thread do contexto GL, em volta da reprodução de cada frame. As queries morrem com o contexto.
+    void beginFrame();
+    void endFrame();
+    // 'name' deve ter duração estática (literal); zonas podem ser aninhadas
+    void beginZone(const char* name);
+    void endZone();
+
+    // Qualquer thread. Falso até o primeiro beginFrame e em contextos sem timer queries.
+    bool isSupported() const;
+    // Alguns frames de atraso; 0 para um pass que não apareceu no último frame lido
+    double getPassMs(std::string_view name) const;
+    std::vector<GpuPassTime> getPassTimes() const; // Na ordem de início
+    double getFrameMs() const;
+    uint64_t getDroppedFrames() const;
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+private:
+    GpuProfiler() = default;
+
+    struct Zone {
+        const char* name;
+        size_t beginQuery;
+        size_t endQuery;
+    };
+
+    struct FrameSlot {
+        std::vector<GLuint> queries; // Só cresce; 'used' por frame
+        size_t used = 0;
+        std::vector<Zone> zones;
+        int64_t clockOffsetNs = 0;   // Relógio da CPU (Profiler::now) - relógio da GPU
+        bool pending = false;
+    };
+
+    bool initialize();
+    size_t writeTimestamp(FrameSlot& slot);
+    void collect(FrameSlot& slot);
+
+    // Só a thread do contexto
+    FrameSlot m_slots[kLatency];
+    int m_current = 0;
+    bool m_initialized = false;
+    bool m_inFrame = false;
+    std::vector<size_t> m_openZones;
+    std::vector<GLuint64> m_timestamps;        // Leitura de um slot (reaproveitado)
+    std::vector<GpuPassTime> m_collectedPasses; // Trocado com m_lastPasses a cada leitura
+    Profiling::Profiler::TrackId m_track = 0;
+
+    mutable std::mutex m_resultsMutex;
+    bool m_supported = false;
+    std::vector<GpuPassTime> m_lastPasses;
+    double m_lastFrameMs = 0.0;
+    uint64_t m_droppedFrames = 0;
+};
+
+} // namespace Render
+} // namespace Engine
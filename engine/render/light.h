@@ -0,0 +1,18 @@
+// engine/render/light.h
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Render {
+
+// Luz pontual dinâmica (tochas, postes, efeitos de magia). A contribuição vai a zero em 'radius'.
+struct PointLight {
+    glm::vec3 position = glm::vec3(0.0f);
+    float radius = 10.0f;
+    glm::vec3 color = glm::vec3(1.0f);
+    float intensity = 1.0f;
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,183 @@
+// engine/render/light_clusters.cpp
+#include "light_clusters.h"
+#include "./../core/config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_LIGHT_CLUSTERS_SSE 1
+#endif
+
+namespace Engine {
+namespace Render {
+
+namespace {
+    constexpr int kGridX = Engine::CLUSTER_GRID_X;
+    constexpr int kGridY = Engine::CLUSTER_GRID_Y;
+    constexpr int kGridZ = Engine::CLUSTER_GRID_Z;
+    constexpr int kClusterCount = kGridX * kGridY * kGridZ;
+
+    static_assert(kGridX % 4 == 0, "CLUSTER_GRID_X precisa ser múltiplo de 4 (testes SIMD por 4 froxels)");
+}
+
+LightClusterGrid::LightClusterGrid()
+    : m_minX(kClusterCount), m_maxX(kClusterCount),
+      m_minY(kClusterCount), m_maxY(kClusterCount),
+      m_minZ(kClusterCount), m_maxZ(kClusterCount),
+      m_clusters(kClusterCount) {
+}
+
+int LightClusterGrid::sliceForDepth(float depth) const {
+    int slice = static_cast<int>(std::floor(std::log(std::max(depth, m_near) / m_near) * m_sliceScale));
+    return std::clamp(slice, 0, kGridZ - 1);
+}
+
+void LightClusterGrid::rebuildFroxelBounds(float near, float far, float tanHalfX, float tanHalfY) {
+    m_near = near;
+    m_far = far;
+    m_tanHalfX = tanHalfX;
+    m_tanHalfY = tanHalfY;
+    m_sliceScale = static_cast<float>(kGridZ) / std::log(far / near);
+
+    for (int z = 0; z < kGridZ; ++z) {
+        // Fatias exponenciais: froxels com proporções parecidas em qualquer distância
+        float sliceNear = near * std::pow(far / near, static_cast<float>(z) / kGridZ);
+        float sliceFar = near * std::pow(far / near, static_cast<float>(z + 1) / kGridZ);
+
+        for (int y = 0; y < kGridY; ++y) {
+            float ndcY0 = -1.0f + 2.0f * y / kGridY;
+            float ndcY1 = -1.0f + 2.0f * (y + 1) / kGridY;
+
+            for (int x = 0; x < kGridX; ++x) {
+                float ndcX0 = -1.0f + 2.0f * x / kGridX;
+                float ndcX1 = -1.0f + 2.0f * (x + 1) / kGridX;
+
+                // O bloco de tela alarga com a profundidade: a AABB cobre os cantos nas duas faces da fatia
+                float xs[4] = {ndcX0 * tanHalfX * sliceNear, ndcX1 * tanHalfX * sliceNear,
+                               ndcX0 * tanHalfX * sliceFar, ndcX1 * tanHalfX * sliceFar};
+                float ys[4] = {ndcY0 * tanHalfY * sliceNear, ndcY1 * tanHalfY * sliceNear,
+                               ndcY0 * tanHalfY * sliceFar, ndcY1 * tanHalfY * sliceFar};
+
+                size_t c = static_cast<size_t>((z * kGridY + y) * kGridX + x);
+                m_minX[c] = *std::min_element(xs, xs + 4);
+                m_maxX[c] = *std::max_element(xs, xs + 4);
+                m_minY[c] = *std::min_element(ys, ys + 4);
+                m_maxY[c] = *std::max_element(ys, ys + 4);
+                m_minZ[c] = -sliceFar; // Câmera olha para -Z
+                m_maxZ[c] = -sliceNear;
+            }
+        }
+    }
+}
+
+void LightClusterGrid::build(const std::vector<PointLight>& lights, const glm::mat4& view, const glm::mat4& projection) {
+    auto buildStart = std::chrono::steady_clock::now();
+
+    // Perspectiva padrão: P[2][2] = -(f+n)/(f-n), P[3][2] = -2fn/(f-n)
+    float near = projection[3][2] / (projection[2][2] - 1.0f);
+    float far = projection[3][2] / (projection[2][2] + 1.0f);
+    float tanHalfX = 1.0f / projection[0][0];
+    float tanHalfY = 1.0f / projection[1][1];
+    if (near != m_near || far != m_far || tanHalfX != m_tanHalfX || tanHalfY != m_tanHalfY) {
+        rebuildFroxelBounds(near, far, tanHalfX, tanHalfY);
+    }
+
+    m_gpuLights.resize(lights.size());
+    m_pairs.clear();
+
+    std::vector<uint32_t>& counts = m_counts;
+    counts.assign(kClusterCount, 0);
+
+    for (size_t lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+        const PointLight& light = lights[lightIndex];
+        m_gpuLights[lightIndex] = {glm::vec4(light.position, light.radius), glm::vec4(light.color, light.intensity)};
+
+        glm::vec3 p = glm::vec3(view * glm::vec4(light.position, 1.0f));
+        float r = light.radius;
+        float depth = -p.z;
+        if (depth + r < m_near || depth - r > m_far) {
+            continue;
+        }
+
+        int z0 = sliceForDepth(depth - r);
+        int z1 = sliceForDepth(depth + r);
+        float r2 = r * r;
+
+#ifdef ENGINE_LIGHT_CLUSTERS_SSE
+        const __m128 px = _mm_set1_ps(p.x);
+        const __m128 py = _mm_set1_ps(p.y);
+        const __m128 pz = _mm_set1_ps(p.z);
+        const __m128 radius2 = _mm_set1_ps(r2);
+        const __m128 zero = _mm_setzero_ps();
+#endif
+
+        for (int z = z0; z <= z1; ++z) {
+            for (int y = 0; y < kGridY; ++y) {
+                const size_t rowStart = static_cast<size_t>((z * kGridY + y) * kGridX);
+
+                // Rejeição da linha inteira pelo Y/Z do primeiro froxel (todos da linha compartilham)
+                float dy = std::max({m_minY[rowStart] - p.y, 0.0f, p.y - m_maxY[rowStart]});
+                float dz = std::max({m_minZ[rowStart] - p.z, 0.0f, p.z - m_maxZ[rowStart]});
+                if (dy * dy + dz * dz > r2) {
+                    continue;
+                }
+
+                for (int x = 0; x < kGridX; x += 4) {
+                    const size_t c = rowStart + static_cast<size_t>(x);
+                    int mask = 0;
+#ifdef ENGINE_LIGHT_CLUSTERS_SSE
+                    // Distância² da esfera a 4 AABBs: soma de max(min - p, 0, p - max)² por eixo
+                    __m128 ex = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_minX[c]), px), zero),
+                                           _mm_sub_ps(px, _mm_loadu_ps(&m_maxX[c])));
+                    __m128 ey = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_minY[c]), py), zero),
+                                           _mm_sub_ps(py, _mm_loadu_ps(&m_maxY[c])));
+                    __m128 ez = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_minZ[c]), pz), zero),
+                                           _mm_sub_ps(pz, _mm_loadu_ps(&m_maxZ[c])));
+                    __m128 dist2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), _mm_mul_ps(ez, ez));
+                    mask = _mm_movemask_ps(_mm_cmple_ps(dist2, radius2));
+#else
+                    for (int lane = 0; lane < 4; ++lane) {
+                        float ex = std::max({m_minX[c + lane] - p.x, 0.0f, p.x - m_maxX[c + lane]});
+                        float ey = std::max({m_minY[c + lane] - p.y, 0.0f, p.y - m_maxY[c + lane]});
+                        float ez = std::max({m_minZ[c + lane] - p.z, 0.0f, p.z - m_maxZ[c + lane]});
+                        if (ex * ex + ey * ey + ez * ez <= r2) {
+                            mask |= 1 << lane;
+                        }
+                    }
+#endif
+                    while (mask) {
+                        int lane = 0;
+                        while (!(mask & (1 << lane))) {
+                            ++lane;
+                        }
+                        mask &= ~(1 << lane);
+                        uint32_t cluster = static_cast<uint32_t>(c + lane);
+                        m_pairs.push_back(cluster);
+                        m_pairs.push_back(static_cast<uint32_t>(lightIndex));
+                        counts[cluster]++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Lista compacta: faixas por froxel (soma de prefixos) e índices em ordem crescente de luz
+    uint32_t offset = 0;
+    for (int c = 0; c < kClusterCount; ++c) {
+        m_clusters[c] = {offset, 0};
+        offset += counts[c];
+    }
+    m_lightIndices.resize(offset);
+    for (size_t i = 0; i < m_pairs.size(); i += 2) {
+        GpuCluster& cluster = m_clusters[m_pairs[i]];
+        m_lightIndices[cluster.offset + cluster.count++] = m_pairs[i + 1];
+    }
+
+    m_lastBuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+}
+
+} // namespace Render
+} // namespace Engine
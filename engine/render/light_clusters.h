@@ -0,0 +1,69 @@
+// engine/render/light_clusters.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "light.h"
+
+namespace Engine {
+namespace Render {
+
+// Luz como o shader a lê (std430): posição no mundo + raio, cor + intensidade
+struct GpuPointLight {
+    glm::vec4 positionRadius;
+    glm::vec4 colorIntensity;
+};
+
+// Faixa de um froxel na lista compacta de índices (std430 uvec2)
+struct GpuCluster {
+    uint32_t offset;
+    uint32_t count;
+};
+
+// Atribuição de luzes a froxels (clusters 3D do frustum) na CPU.
+// O frustum é dividido em CLUSTER_GRID_X x CLUSTER_GRID_Y blocos de tela e CLUSTER_GRID_Z fatias de
+// profundidade exponenciais. Cada luz é testada (esfera x AABB no espaço de visão) apenas contra as
+// fatias que sua esfera alcança, 4 froxels por vez com SSE.
+class LightClusterGrid {
+public:
+    LightClusterGrid();
+
+    // 'projection' deve ser perspectiva; near/far são extraídos dela
+    void build(const std::vector<PointLight>& lights, const glm::mat4& view, const glm::mat4& projection);
+
+    const std::vector<GpuPointLight>& getLights() const { return m_gpuLights; }
+    const std::vector<GpuCluster>& getClusters() const { return m_clusters; }
+    const std::vector<uint32_t>& getLightIndices() const { return m_lightIndices; }
+
+    float getNear() const { return m_near; }
+    float getFar() const { return m_far; }
+    // Fatias por unidade de log(profundidade): slice = floor((log(d) - log(near)) * scale)
+    float getSliceScale() const { return m_sliceScale; }
+
+    double getLastBuildMs() const { return m_lastBuildMs; }
+
+private:
+    void rebuildFroxelBounds(float near, float far, float tanHalfX, float tanHalfY);
+    int sliceForDepth(float depth) const;
+
+    // Limites dos froxels no espaço de visão, em SoA para os testes SIMD (índice = (z * Y + y) * X + x)
+    std::vector<float> m_minX, m_maxX, m_minY, m_maxY, m_minZ, m_maxZ;
+
+    std::vector<GpuPointLight> m_gpuLights;
+    std::vector<GpuCluster> m_clusters;
+    std::vector<uint32_t> m_lightIndices;
+    std::vector<uint32_t> m_pairs; // Pares (froxel, luz) intercalados, antes do agrupamento por froxel
+    std::vector<uint32_t> m_counts; // Luzes por froxel no frame atual
+
+    float m_near = 0.0f;
+    float m_far = 0.0f;
+    float m_tanHalfX = 0.0f;
+    float m_tanHalfY = 0.0f;
+    float m_sliceScale = 0.0f;
+    double m_lastBuildMs = 0.0;
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,70 @@
+// engine/render/lod_selector.cpp
+#include "lod_selector.h"
+#include "./../core/config.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace Engine {
+namespace Render {
+
+float LodSelector::computeScreenSize(const glm::vec3& worldCenter, float worldRadius,
+                                     const glm::vec3& cameraPosition, float projectionScaleY) {
+    float distance = glm::length(worldCenter - cameraPosition);
+    if (distance <= worldRadius) {
+        return 1.0e6f; // Câmera dentro da esfera: sempre detalhe máximo
+    }
+    return worldRadius * projectionScaleY / distance;
+}
+
+int LodSelector::lodForScreenSize(float screenSize, size_t lodCount, int currentLod) {
+    constexpr int thresholdCount = static_cast<int>(std::size(Engine::LOD_SCREEN_SIZES));
+    const int maxLod = std::min(static_cast<int>(lodCount) - 1, thresholdCount);
+    if (maxLod <= 0) {
+        return 0;
+    }
+
+    // Primeira seleção: sem histerese
+    const float hysteresis = currentLod < 0 ? 0.0f : Engine::LOD_HYSTERESIS;
+    int lod = std::clamp(currentLod, 0, maxLod);
+
+    // Mais detalhe: o tamanho precisa passar do limiar do nível atual com folga
+    while (lod > 0 && screenSize > Engine::LOD_SCREEN_SIZES[lod - 1] * (1.0f + hysteresis)) {
+        --lod;
+    }
+    // Menos detalhe: o tamanho precisa ficar abaixo do limiar do próximo nível com folga
+    while (lod < maxLod && screenSize < Engine::LOD_SCREEN_SIZES[lod] * (1.0f - hysteresis)) {
+        ++lod;
+    }
+    return lod;
+}
+
+LodSelection LodSelector::select(LodState& state, float screenSize, size_t lodCount, float time) {
+    int lod = lodForScreenSize(screenSize, lodCount, state.currentLod);
+
+    if (state.currentLod < 0) {
+        state.currentLod = lod;
+        state.previousLod = -1;
+    } else if (lod != state.currentLod) {
+        state.previousLod = Engine::LOD_DITHER_CROSSFADE ? state.currentLod : -1;
+        state.currentLod = lod;
+        state.transitionStart = time;
+    }
+
+    LodSelection selection;
+    selection.lod = state.currentLod;
+
+    if (state.previousLod >= 0) {
+        float progress = (time - state.transitionStart) / Engine::LOD_CROSSFADE_SECONDS;
+        if (progress >= 1.0f) {
+            state.previousLod = -1;
+        } else {
+            selection.fadingLod = state.previousLod;
+            selection.fade = std::max(progress, 0.0f);
+        }
+    }
+    return selection;
+}
+
+} // namespace Render
+} // namespace Engine
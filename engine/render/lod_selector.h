@@ -0,0 +1,42 @@
+// engine/render/lod_selector.h
+#pragma once
+
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Render {
+
+// Estado de LOD de uma instância (objeto + mesh), mantido entre frames para histerese e cross-fade
+struct LodState {
+    int currentLod = -1;          // -1: ainda não selecionada
+    int previousLod = -1;         // LOD que está saindo durante o cross-fade (-1: nenhuma)
+    float transitionStart = 0.0f; // Instante (segundos) em que a troca começou
+};
+
+// O que desenhar neste frame
+struct LodSelection {
+    int lod = 0;
+    int fadingLod = -1; // >= 0 durante o cross-fade: esta LOD também é desenhada, com dither complementar
+    float fade = 1.0f;  // Progresso (0..1) da entrada de 'lod'
+};
+
+// Seleção de LOD por tamanho projetado na tela, com histerese e cross-fade opcional (ver config.h)
+class LodSelector {
+public:
+    // Raio projetado da esfera envolvente em frações da meia-altura do viewport (1.0 = cobre a tela).
+    // 'projectionScaleY' é projection[1][1] (= 1 / tan(fov / 2)).
+    static float computeScreenSize(const glm::vec3& worldCenter, float worldRadius,
+                                   const glm::vec3& cameraPosition, float projectionScaleY);
+
+    // Atualiza 'state' e devolve as LODs a desenhar. 'time' é o tempo da cena em segundos.
+    static LodSelection select(LodState& state, float screenSize, size_t lodCount, float time);
+
+private:
+    LodSelector() = delete;
+
+    static int lodForScreenSize(float screenSize, size_t lodCount, int currentLod);
+};
+
+} // namespace Render
+} // namespace Engine
@@ -5,6 +5,8 @@
 #include <memory>
 #include <glm/glm.hpp>
 
+#include "./../memory/pool_allocator.h"
+
 // Forward declaration para a classe Texture
 namespace Engine
 {
@@ -22,7 +24,8 @@ namespace Engine
 
         // Classe para representar um Material PBR (Physically Based Rendering)
         // Encapsula os diferentes mapas de textura e propriedades do material.
-        class Material
+        // Criado com make_unique pelos carregadores: vem do pool de Material (Memory::Pooled).
+        class Material : public Memory::Pooled<Material, Memory::MemoryTag::Render>
         {
         public:
             // Construtor padrão
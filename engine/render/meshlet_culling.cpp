@@ -0,0 +1,39 @@
+// engine/render/meshlet_culling.cpp
+#include "meshlet_culling.h"
+
+namespace Engine {
+namespace Render {
+
+MeshletCullResult MeshletCulling::cull(const std::vector<Asset::Meshlet>& meshlets, const Frustum& localFrustum,
+                                       const glm::vec3& localCamera, std::vector<Asset::IndexRange>& ranges) {
+    MeshletCullResult result;
+    const size_t firstRange = ranges.size();
+
+    for (const Asset::Meshlet& meshlet : meshlets) {
+        if (!localFrustum.intersectsSphere(meshlet.center, meshlet.radius)) {
+            result.culledByFrustum++;
+            continue;
+        }
+
+        // Cone de normais: todos os triângulos de costas para a câmera
+        const glm::vec3 toMeshlet = meshlet.center - localCamera;
+        if (glm::dot(toMeshlet, meshlet.coneAxis) >= meshlet.coneCutoff * glm::length(toMeshlet) + meshlet.radius) {
+            result.culledByCone++;
+            continue;
+        }
+
+        result.visibleTriangles += meshlet.indexCount / 3;
+        // Meshlets são contíguos no index buffer: vizinhos visíveis estendem a última faixa
+        if (ranges.size() > firstRange && ranges.back().first + ranges.back().count == meshlet.indexOffset) {
+            ranges.back().count += meshlet.indexCount;
+        } else {
+            ranges.push_back({meshlet.indexOffset, meshlet.indexCount});
+        }
+    }
+
+    result.rangeCount = static_cast<uint32_t>(ranges.size() - firstRange);
+    return result;
+}
+
+} // namespace Render
+} // namespace Engine
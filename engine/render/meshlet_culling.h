@@ -0,0 +1,34 @@
+// engine/render/meshlet_culling.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "frustum.h"
+#include "./../asset/meshlet.h"
+
+namespace Engine {
+namespace Render {
+
+struct MeshletCullResult {
+    uint32_t rangeCount = 0;       // Faixas acrescentadas (meshlets visíveis vizinhos viram uma faixa)
+    uint64_t visibleTriangles = 0;
+    uint32_t culledByFrustum = 0;
+    uint32_t culledByCone = 0;
+};
+
+// Culling fino por meshlet, feito na CPU durante a gravação (chamado em paralelo pelos jobs:
+// só escreve em 'ranges'). Tudo em espaço local da mesh: frustum de (viewProj * model) e câmera
+// transformada pela inversa do model, o que vale também para escalas não uniformes.
+class MeshletCulling {
+public:
+    static MeshletCullResult cull(const std::vector<Asset::Meshlet>& meshlets, const Frustum& localFrustum,
+                                  const glm::vec3& localCamera, std::vector<Asset::IndexRange>& ranges);
+
+private:
+    MeshletCulling() = delete;
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,24 @@
+// engine/render/render_path.h
+#pragma once
+
+namespace Engine {
+namespace Render {
+
+// Caminho de renderização do pass principal
+enum class RenderPath {
+    Forward,  // basic.frag ilumina cada fragmento desenhado (inclusive os sobrepostos)
+    Deferred  // G-buffer + resolve em tela cheia: iluminação uma vez por pixel
+};
+
+inline const char* toString(RenderPath path) {
+    return path == RenderPath::Deferred ? "deferred" : "forward";
+}
+
+// Opções do frame escolhidas pelo Renderer e repassadas a Scene::render
+struct FrameSettings {
+    RenderPath path = RenderPath::Forward;
+    bool depthPrepass = false; // Pré-pass só de profundidade; o pass principal testa com GL_EQUAL
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,65 @@
+// engine/render/render_stats.h
+#pragma once
+
+#include <cstdint>
+
+#include "shadow_cascades.h" // kMaxShadowCascades
+
+namespace Engine {
+namespace Render {
+
+// Contadores do que foi submetido à GPU em um frame
+struct RenderStats {
+    uint64_t drawCalls = 0;
+    uint64_t triangles = 0;           // Triângulos efetivamente submetidos
+    uint64_t trianglesFullDetail = 0; // Triângulos que seriam submetidos só com a LOD 0 (para comparação)
+    uint64_t crossFadingMeshes = 0;   // Meshes desenhadas duas vezes por estarem em cross-fade de LOD
+    uint64_t culledMeshes = 0;        // Meshes descartadas pelo frustum culling
+    uint64_t recordJobs = 0;          // Jobs de gravação usados no frame
+    uint64_t meshletsTested = 0;      // Meshlets avaliados (meshes na LOD 0 com meshlets)
+    uint64_t meshletsCulledFrustum = 0;
+    uint64_t meshletsCulledCone = 0;  // Descartados por estarem de costas (cone de normais)
+    double recordMs = 0.0;            // Tempo de culling + LOD + gravação + junção (thread principal)
+    uint64_t pointLights = 0;         // Luzes pontuais na cena
+    uint64_t lightIndices = 0;        // Pares (froxel, luz) gerados pelo binning
+    double lightBinningMs = 0.0;      // Tempo de atribuição das luzes aos froxels
+
+    // Terreno (CDLOD): pedaços desenhados (nós inteiros e quadrantes), triângulos e custo da seleção
+    uint64_t terrainChunks = 0;
+    uint64_t terrainQuadrants = 0;
+    uint64_t terrainTriangles = 0;
+    uint64_t terrainNodesVisited = 0;
+    double terrainSelectMs = 0.0;
+
+    // Vegetação instanciada: instâncias e blocos desenhados, chamadas de multi-draw indireto e custo da seleção
+    uint64_t vegetationInstances = 0;
+    uint64_t vegetationPatches = 0;
+    uint64_t vegetationMultiDraws = 0;
+    double vegetationSelectMs = 0.0;
+
+    // Tempos de GPU (GL_TIMESTAMP, alguns frames de atraso); 0 = pass desligado ou sem medição ainda
+    double gpuPrepassMs = 0.0;
+    double gpuMainPassMs = 0.0;
+
+    // Sombras por cascata: projetores gravados, tempo de culling + gravação e se a camada veio do cache
+    uint64_t shadowCasters[kMaxShadowCascades] = {};
+    double shadowCascadeMs[kMaxShadowCascades] = {};
+    bool shadowCascadeCached[kMaxShadowCascades] = {};
+
+    void reset() { *this = RenderStats{}; }
+
+    // Soma os contadores de um job (tempos e número de jobs são do frame, não somados)
+    void accumulate(const RenderStats& other) {
+        drawCalls += other.drawCalls;
+        triangles += other.triangles;
+        trianglesFullDetail += other.trianglesFullDetail;
+        crossFadingMeshes += other.crossFadingMeshes;
+        culledMeshes += other.culledMeshes;
+        meshletsTested += other.meshletsTested;
+        meshletsCulledFrustum += other.meshletsCulledFrustum;
+        meshletsCulledCone += other.meshletsCulledCone;
+    }
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,159 @@
+// engine/render/render_thread.cpp
+#include "render_thread.h"
+#include "./../window/window.h"
+#include "gpu_profiler.h"
+#include "./../core/log.h"
+#include "./../core/profiler.h"
+#include "./../memory/allocation_counters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+
+namespace Engine {
+namespace Render {
+
+namespace {
+    double elapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+RenderThread::RenderThread(Window& window, bool threaded, int maxFrameLatency)
+    : m_window(window),
+      m_threaded(threaded),
+      m_maxFrameLatency(std::max(0, maxFrameLatency)),
+      m_frames(static_cast<size_t>(std::max(0, maxFrameLatency)) + 1) {
+    Engine::Log::Info(std::format("RenderThread: modo {}, latência máxima de {} frame(s).",
+                                  m_threaded ? "thread dedicada" : "inline", m_maxFrameLatency));
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start() {
+    if (m_running) {
+        return;
+    }
+    m_running = true;
+    m_stopRequested = false;
+
+    if (!m_threaded) {
+        return;
+    }
+
+    // O contexto só pode estar ativo em uma thread: a principal o libera antes da thread nova assumir
+    m_window.releaseContext();
+    m_thread = std::thread(&RenderThread::threadMain, this);
+    Engine::Log::Info("RenderThread: contexto GL transferido para a thread de renderização.");
+}
+
+void RenderThread::stop() {
+    if (!m_running) {
+        return;
+    }
+
+    if (m_threaded) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopRequested = true;
+        }
+        m_frameSubmitted.notify_one();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        // Recursos GL ainda são destruídos na thread principal ao encerrar a aplicação
+        m_window.makeContextCurrent();
+        Engine::Log::Info("RenderThread: thread encerrada, contexto GL devolvido à thread principal.");
+    }
+    m_running = false;
+}
+
+CommandList& RenderThread::beginFrame() {
+    uint64_t frameIndex = 0;
+    {
+        ENGINE_PROFILE_SCOPE("RenderThread::waitForFreeFrame");
+        auto waitStart = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // A lista do anel que será reutilizada pertence ao frame (submitted - ringSize): ele precisa ter terminado
+        m_frameCompleted.wait(lock, [this] {
+            return m_submittedFrames - m_completedFrames <= static_cast<uint64_t>(m_maxFrameLatency);
+        });
+        frameIndex = m_submittedFrames;
+        m_lastWaitMs = elapsedMs(waitStart);
+    }
+
+    CommandList& commands = m_frames[frameIndex % m_frames.size()];
+    commands.reset();
+    return commands;
+}
+
+void RenderThread::submitFrame() {
+    if (!m_threaded || !m_running) {
+        // Modo inline: reproduz imediatamente na thread chamadora (que possui o contexto)
+        std::lock_guard<std::mutex> lock(m_mutex);
+        replay(m_frames[m_submittedFrames % m_frames.size()]);
+        ++m_submittedFrames;
+        ++m_completedFrames;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_submittedFrames;
+    }
+    m_frameSubmitted.notify_one();
+}
+
+void RenderThread::waitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_frameCompleted.wait(lock, [this] { return m_completedFrames == m_submittedFrames; });
+}
+
+void RenderThread::threadMain() {
+    Engine::Profiling::Profiler::setThreadName("Render");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::Render);
+    m_window.makeContextCurrent();
+
+    while (true) {
+        uint64_t frameIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_frameSubmitted.wait(lock, [this] { return m_stopRequested || m_completedFrames < m_submittedFrames; });
+            if (m_completedFrames == m_submittedFrames) {
+                break; // Parada pedida e fila vazia
+            }
+            frameIndex = m_completedFrames;
+        }
+
+        // A lista do frame em reprodução não é tocada pela thread principal até m_completedFrames avançar
+        replay(m_frames[frameIndex % m_frames.size()]);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_completedFrames;
+        }
+        m_frameCompleted.notify_all();
+    }
+
+    m_window.releaseContext();
+}
+
+void RenderThread::replay(const CommandList& commands) {
+    auto replayStart = std::chrono::steady_clock::now();
+    {
+        ENGINE_PROFILE_SCOPE("CommandList::execute");
+        GpuProfiler::Get().beginFrame();
+        commands.execute();
+        GpuProfiler::Get().endFrame();
+    }
+    {
+        ENGINE_PROFILE_SCOPE("Window::swapBuffers");
+        m_window.swapBuffers();
+    }
+    m_lastReplayMs.store(elapsedMs(replayStart), std::memory_order_relaxed);
+}
+
+} // namespace Render
+} // namespace Engine
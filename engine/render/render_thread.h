@@ -0,0 +1,77 @@
+// engine/render/render_thread.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "command_list.h"
+
+namespace Engine {
+    class Window;
+}
+
+namespace Engine {
+namespace Render {
+
+// Thread dedicada que possui o contexto GL e reproduz as CommandLists gravadas pela thread principal.
+// As listas formam um anel de (maxFrameLatency + 1) frames: enquanto a thread de renderização
+// submete o frame N, a thread principal já simula e grava o frame N+1. beginFrame() bloqueia quando
+// a thread principal está mais de maxFrameLatency frames à frente da submissão.
+// Com threaded = false os frames são reproduzidos na própria thread que chama submitFrame()
+// (mesmo caminho de gravação, útil para depuração com ferramentas de captura GL).
+class RenderThread {
+public:
+    RenderThread(Window& window, bool threaded, int maxFrameLatency);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // Transfere o contexto GL da thread chamadora para a thread de renderização
+    void start();
+    // Esvazia a fila, encerra a thread e devolve o contexto GL para a thread chamadora
+    void stop();
+
+    // Lista do próximo frame (já limpa). Pode bloquear para respeitar a latência máxima.
+    CommandList& beginFrame();
+    // Publica a lista obtida em beginFrame() para reprodução seguida de swapBuffers
+    void submitFrame();
+    // Bloqueia até todos os frames submetidos terem sido reproduzidos
+    void waitIdle();
+
+    bool isThreaded() const { return m_threaded; }
+    bool isRunning() const { return m_running; }
+
+    // Estatísticas do último frame (milissegundos)
+    double getLastReplayMs() const { return m_lastReplayMs.load(std::memory_order_relaxed); }
+    double getLastWaitMs() const { return m_lastWaitMs; } // Tempo da thread principal bloqueada em beginFrame
+
+private:
+    void threadMain();
+    void replay(const CommandList& commands);
+
+    Window& m_window;
+    bool m_threaded;
+    int m_maxFrameLatency;
+    std::vector<CommandList> m_frames; // Anel de listas, indexado por número do frame
+
+    std::mutex m_mutex;
+    std::condition_variable m_frameSubmitted;
+    std::condition_variable m_frameCompleted;
+    uint64_t m_submittedFrames = 0; // Protegido por m_mutex
+    uint64_t m_completedFrames = 0; // Protegido por m_mutex
+    bool m_stopRequested = false;   // Protegido por m_mutex
+
+    bool m_running = false;
+    std::thread m_thread;
+
+    std::atomic<double> m_lastReplayMs{0.0};
+    double m_lastWaitMs = 0.0;
+};
+
+} // namespace Render
+} // namespace Engine
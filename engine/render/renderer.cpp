@@ -5,6 +5,9 @@
 #include "./../core/log.h"   // Inclua o sistema de log
 #include "./camera/icamera.h" // Use a interface ICamera
 #include "./../../src/app/scene.h" // Inclua Scene para renderizar
+#include "./../core/config.h"
+#include "./../core/profiler.h"
+#include "gpu_profiler.h"
 
 #include <glad/gl.h> // Para comandos OpenGL
 #include <glm/gtc/matrix_transform.hpp> // Para glm::perspective
@@ -12,50 +15,146 @@
 
 namespace Engine {
 
-Renderer::Renderer(const Window& window, const Camera::ICamera& camera)
-    : m_window(window), m_camera(camera) {
+// Último alcance de LOD do terreno: a LOD 0 cobre TERRAIN_LEAF_LOD_RANGE e cada nível dobra até o tamanho do tile
+static_assert(Engine::CAMERA_FAR_PLANE >= Engine::TERRAIN_LEAF_LOD_RANGE * (Engine::TERRAIN_TILE_SIZE / Engine::TERRAIN_LEAF_CHUNK_SIZE),
+              "CAMERA_FAR_PLANE corta as LODs mais distantes do terreno");
+
+Renderer::Renderer(Window& window, const Camera::ICamera& camera)
+    : m_window(window), m_camera(camera), m_nearPlane(Engine::CAMERA_NEAR_PLANE), m_farPlane(Engine::CAMERA_FAR_PLANE),
+      m_frameSettings{Engine::RENDER_DEFAULT_DEFERRED ? Render::RenderPath::Deferred : Render::RenderPath::Forward,
+                      Engine::DEPTH_PREPASS_ENABLED} {
     Engine::Log::Info("Renderer: Construtor chamado.");
+    m_renderThread = std::make_unique<Render::RenderThread>(m_window, Engine::RENDER_THREAD_ENABLED, Engine::RENDER_MAX_FRAME_LATENCY);
     // A matriz de projeção será configurada em setProjectionMatrix
 }
 
 Renderer::~Renderer() {
     Engine::Log::Info("Renderer: Destrutor chamado.");
+    stopRenderThread();
+}
+
+void Renderer::startRenderThread() {
+    m_renderThread->start();
+}
+
+void Renderer::stopRenderThread() {
+    m_renderThread->stop();
 }
 
 void Renderer::render(const Scene& scene) {
-    clearScreen();
+    ENGINE_PROFILE_SCOPE("Renderer::render");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::Render);
+    // Espera uma lista livre do anel (limita o quanto a simulação pode se adiantar à submissão GL)
+    Render::CommandList& commands = m_renderThread->beginFrame();
+
+    clearScreen(commands);
     // **** NOVO: Chamar configureViewport e setProjectionMatrix a cada frame ****
     // Isso garante que o viewport e a projeção se ajustem a qualquer redimensionamento.
-    configureViewport();
-    setProjectionMatrix(m_camera.getZoom(), 0.1f, 100.0f); // Use o FOV da câmera atual
+    configureViewport(commands);
+    setProjectionMatrix(m_camera.getZoom(), m_nearPlane, m_farPlane); // Use o FOV da câmera atual
 
     // Obtém as matrizes de visão e projeção
     glm::mat4 view = m_camera.getViewMatrix();
     glm::mat4 projection = m_projectionMatrix;
 
-    scene.render(projection, view); 
+    scene.render(commands, projection, view, m_frameSettings); 
+
+    m_renderThread->submitFrame();
+
+    // Log periódico do que foi submetido (triângulos com LOD vs. só LOD 0)
+    m_framesSinceStatsLog++;
+    double now = m_window.getTime();
+    if (now - m_lastStatsLogTime >= 5.0) {
+        double averageFrameMs = 1000.0 * (now - m_lastStatsLogTime) / static_cast<double>(m_framesSinceStatsLog);
+        m_lastStatsLogTime = now;
+        m_framesSinceStatsLog = 0;
+        const Render::RenderStats& stats = scene.getRenderStats();
+        Engine::Log::Info(std::format("Renderer: modo {}, pré-pass {}, {:.2f} ms por frame em média.", Render::toString(m_frameSettings.path),
+                                      m_frameSettings.depthPrepass ? "ligado" : "desligado", averageFrameMs));
+        Engine::Log::Info(std::format("Renderer: GPU pré-pass {:.3f} ms, pass principal {:.3f} ms (soma {:.3f} ms).",
+                                      stats.gpuPrepassMs, stats.gpuMainPassMs, stats.gpuPrepassMs + stats.gpuMainPassMs));
+        const Render::GpuProfiler& gpuProfiler = Render::GpuProfiler::Get();
+        if (gpuProfiler.isSupported()) {
+            // Passes aninhados (terreno e vegetação dentro do pass principal) também aparecem sozinhos
+            std::string passes;
+            for (const Render::GpuPassTime& pass : gpuProfiler.getPassTimes()) {
+                passes += std::format("{}{} {:.3f} ms", passes.empty() ? "" : ", ", pass.name, pass.ms);
+            }
+            Engine::Log::Info(std::format("Renderer: GPU por pass: {} (frame {:.3f} ms, {} leitura(s) descartada(s)).",
+                                          passes.empty() ? "nenhum" : passes, gpuProfiler.getFrameMs(), gpuProfiler.getDroppedFrames()));
+        }
+        Engine::Log::Info(std::format("Renderer: {} draw calls, {} triângulos (sem LOD: {}, em cross-fade: {}, meshes fora do frustum: {}).",
+                                      stats.drawCalls, stats.triangles, stats.trianglesFullDetail, stats.crossFadingMeshes, stats.culledMeshes));
+        if (stats.meshletsTested > 0) {
+            Engine::Log::Info(std::format("Renderer: meshlets: {} testados, {} fora do frustum, {} de costas.",
+                                          stats.meshletsTested, stats.meshletsCulledFrustum, stats.meshletsCulledCone));
+        }
+        if (stats.terrainChunks + stats.terrainQuadrants > 0) {
+            Engine::Log::Info(std::format("Renderer: terreno: {} pedaços + {} quadrantes, {} triângulos, {} nós visitados, seleção {:.3f} ms.",
+                                          stats.terrainChunks, stats.terrainQuadrants, stats.terrainTriangles, stats.terrainNodesVisited,
+                                          stats.terrainSelectMs));
+        }
+        if (stats.vegetationPatches > 0) {
+            // Instâncias desenhadas ao lado do tempo de frame acima (VEGETATION_BENCHMARK varia a contagem)
+            Engine::Log::Info(std::format("Renderer: vegetação: {} instâncias em {} blocos, {} multi-draws indiretos, seleção {:.3f} ms.",
+                                          stats.vegetationInstances, stats.vegetationPatches, stats.vegetationMultiDraws, stats.vegetationSelectMs));
+        }
+        Engine::Log::Info(std::format("Renderer: gravação em {} job(s) levou {:.3f} ms.", stats.recordJobs, stats.recordMs));
+        Engine::Log::Info(std::format("Renderer: {} luzes pontuais, {} índices de froxel, binning {:.3f} ms.",
+                                      stats.pointLights, stats.lightIndices, stats.lightBinningMs));
+        for (int i = 0; i < Engine::SHADOW_CASCADE_COUNT; ++i) {
+            Engine::Log::Info(std::format("Renderer: cascata de sombra {}: {}", i,
+                                          stats.shadowCascadeCached[i] ? std::string("em cache")
+                                                                       : std::format("{} projetores, {:.3f} ms", stats.shadowCasters[i], stats.shadowCascadeMs[i])));
+        }
+        Engine::Log::Info(std::format("Renderer: {} comandos gravados, reprodução GL {:.2f} ms, espera da thread principal {:.2f} ms.",
+                                      commands.size(), m_renderThread->getLastReplayMs(), m_renderThread->getLastWaitMs()));
+    }
 }
 
 void Renderer::setClearColor(float r, float g, float b, float a) {
-    glClearColor(r, g, b, a);
-    Engine::Log::Debug(std::format("Renderer: Cor de limpeza definida para ({},{},{},{}).", r,g,b,a));
+    m_clearColor = glm::vec4(r, g, b, a);
+    ENGINE_LOG_DEBUG("Renderer: Cor de limpeza definida para ({},{},{},{}).", r,g,b,a);
+}
+
+void Renderer::setRenderPath(Render::RenderPath path) {
+    if (path == m_frameSettings.path) {
+        return;
+    }
+    m_frameSettings.path = path;
+    // Zera a média de tempo de frame para comparar os modos sem misturar amostras
+    m_lastStatsLogTime = m_window.getTime();
+    m_framesSinceStatsLog = 0;
+    Engine::Log::Info(std::format("Renderer: caminho de renderização alterado para {}.", Render::toString(path)));
+}
+
+void Renderer::setDepthPrepass(bool enabled) {
+    if (enabled == m_frameSettings.depthPrepass) {
+        return;
+    }
+    m_frameSettings.depthPrepass = enabled;
+    m_lastStatsLogTime = m_window.getTime();
+    m_framesSinceStatsLog = 0;
+    Engine::Log::Info(std::format("Renderer: pré-pass de profundidade {}.", enabled ? "ligado" : "desligado"));
 }
 
 void Renderer::setProjectionMatrix(float fov, float nearPlane, float farPlane) {
     // Usa as dimensões ATUAIS da janela para o aspect ratio
     float aspectRatio = m_window.getAspectRatio(); 
+    m_nearPlane = nearPlane;
+    m_farPlane = farPlane;
     m_projectionMatrix = glm::perspective(glm::radians(fov), aspectRatio, nearPlane, farPlane);
-    Engine::Log::Debug(std::format("Renderer: Matriz de projeção configurada. FOV: {}, Aspect: {}, Near: {}, Far: {}.", fov, aspectRatio, nearPlane, farPlane));
+    ENGINE_LOG_DEBUG("Renderer: Matriz de projeção configurada. FOV: {}, Aspect: {}, Near: {}, Far: {}.", fov, aspectRatio, nearPlane, farPlane);
 }
 
-void Renderer::configureViewport() {
+void Renderer::configureViewport(Render::CommandList& commands) {
     // Usa as dimensões ATUAIS da janela para o viewport
-    glViewport(0, 0, m_window.getWidth(), m_window.getHeight());
-    Engine::Log::Debug(std::format("Renderer: Viewport configurado para {}x{}.", m_window.getWidth(), m_window.getHeight()));
+    commands.setViewport(0, 0, m_window.getWidth(), m_window.getHeight());
+    ENGINE_LOG_DEBUG("Renderer: Viewport configurado para {}x{}.", m_window.getWidth(), m_window.getHeight());
 }
 
-void Renderer::clearScreen() {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+void Renderer::clearScreen(Render::CommandList& commands) {
+    commands.clear(m_clearColor, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
 } // namespace Engine
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 // Inclua a interface ICamera aqui, pois ela será usada como tipo de referência.
 #include "./camera/icamera.h" 
+#include "render_thread.h"
+#include "render_path.h"
 
 // Forward declarations para as classes que o Renderer vai interagir
 namespace Engine {
@@ -22,28 +24,51 @@ namespace Engine {
 class Renderer {
 public:
     // **** MUDANÇA AQUI: O construtor agora recebe uma const Engine::Camera::ICamera& ****
-    Renderer(const Window& window, const Camera::ICamera& camera); 
+    Renderer(Window& window, const Camera::ICamera& camera); 
     ~Renderer();
 
-    // Método principal de renderização do frame
+    // Método principal de renderização do frame: grava os comandos e os submete à thread de renderização
     void render(const Scene& scene);
 
+    // A partir de start, o contexto GL pertence à thread de renderização (carregamentos GL devem vir antes
+    // ou ser gravados como upload em uma CommandList). stop devolve o contexto à thread principal.
+    void startRenderThread();
+    void stopRenderThread();
+
     // Métodos para configuração de renderização (SRP do Renderer)
     void setClearColor(float r, float g, float b, float a);
     void setProjectionMatrix(float fov, float nearPlane, float farPlane);
+
+    // Forward ou deferred; pode ser trocado a qualquer momento (vale a partir do próximo frame)
+    void setRenderPath(Render::RenderPath path);
+    Render::RenderPath getRenderPath() const { return m_frameSettings.path; }
+    // Pré-pass de profundidade antes do pass principal (que passa a testar com GL_EQUAL)
+    void setDepthPrepass(bool enabled);
+    bool getDepthPrepass() const { return m_frameSettings.depthPrepass; }
     // Outros métodos de configuração global de renderização aqui
 
 private:
-    const Window& m_window; 
+    Window& m_window; 
     // **** MUDANÇA AQUI: O membro da câmera agora é uma referência const para a interface ICamera ****
     const Camera::ICamera& m_camera; 
 
-    // Matriz de projeção, gerenciada pelo Renderer
+    // Matriz de projeção, gerenciada pelo Renderer (refeita a cada frame com o FOV da câmera)
     glm::mat4 m_projectionMatrix;
+    float m_nearPlane;
+    float m_farPlane;
+
+    glm::vec4 m_clearColor = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+    std::unique_ptr<Render::RenderThread> m_renderThread;
+
+    Render::FrameSettings m_frameSettings;
+
+    double m_lastStatsLogTime = 0.0; // Último log periódico das estatísticas de renderização
+    uint64_t m_framesSinceStatsLog = 0;
 
-    // Métodos auxiliares
-    void configureViewport();
-    void clearScreen();
+    // Métodos auxiliares (gravam na lista do frame, não chamam OpenGL diretamente)
+    void configureViewport(Render::CommandList& commands);
+    void clearScreen(Render::CommandList& commands);
 };
 
 } // namespace Engine
\ No newline at end of file
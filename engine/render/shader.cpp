@@ -24,7 +24,7 @@ Shader::Shader(const std::string &vertexPath, const std::string &fragmentPath)
 
     GLint numUniforms = 0;
     glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &numUniforms);
-    Engine::Log::Debug(std::format("Active uniforms in shader program (ID: {}):\n", ID));
+    ENGINE_LOG_DEBUG("Active uniforms in shader program (ID: {}):\n", ID);
     for (GLint i = 0; i < numUniforms; ++i)
     {
         char name[256];
@@ -32,7 +32,7 @@ Shader::Shader(const std::string &vertexPath, const std::string &fragmentPath)
         GLint size;
         GLenum type;
         glGetActiveUniform(ID, i, sizeof(name), &length, &size, &type, name);
-        Engine::Log::Debug(std::format(" - {}", name));
+        ENGINE_LOG_DEBUG(" - {}", name);
     }
 
     int success;
@@ -64,9 +64,40 @@ GLuint Shader::getID() const
     return ID;
 }
 
-std::string Shader::loadShaderSource(const std::string &path)
+std::string Shader::loadShaderSource(const std::string &path, int depth)
 {
-    return Engine::loadFileFromEngineAssets(path);
+    if (depth > 8)
+    {
+        throw std::runtime_error(std::format("Shader: #include aninhado demais em '{}'.", path));
+    }
+
+    // Expande '#include "arquivo"' (caminho relativo ao arquivo atual): trechos GLSL compartilhados
+    // entre o forward, o G-buffer e o resolve do deferred
+    const std::string source = Engine::loadFileFromEngineAssets(path);
+    const std::string directory = path.substr(0, path.find_last_of('/') + 1);
+
+    std::istringstream input(source);
+    std::ostringstream output;
+    std::string line;
+    while (std::getline(input, line))
+    {
+        size_t first = line.find_first_not_of(" \t");
+        if (first != std::string::npos && line.compare(first, 8, "#include") == 0)
+        {
+            size_t open = line.find('"', first);
+            size_t close = open == std::string::npos ? std::string::npos : line.find('"', open + 1);
+            if (close == std::string::npos)
+            {
+                throw std::runtime_error(std::format("Shader: #include inválido em '{}': {}", path, line));
+            }
+            output << loadShaderSource(directory + line.substr(open + 1, close - open - 1), depth + 1) << '\n';
+        }
+        else
+        {
+            output << line << '\n';
+        }
+    }
+    return output.str();
 }
 
 GLuint Shader::compileShader(GLenum type, const std::string &source)
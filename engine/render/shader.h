@@ -25,7 +25,7 @@ public:
 
 private:
     GLuint ID;
-    std::string loadShaderSource(const std::string& path);
+    std::string loadShaderSource(const std::string& path, int depth = 0); // Expande #include "..."
     GLuint compileShader(GLenum type, const std::string& source);
     GLint getUniformLocation(const std::string& name) const;
 };
@@ -0,0 +1,104 @@
+// engine/render/shadow_cascades.cpp
+#include "shadow_cascades.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Engine {
+namespace Render {
+
+void ShadowCascades::update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& sunDirection,
+                            uint64_t staticGeometryVersion) {
+    const int count = getCount();
+
+    // Near e tangentes do frustum da câmera (perspectiva padrão)
+    const float near = projection[3][2] / (projection[2][2] - 1.0f);
+    const float far = std::min(projection[3][2] / (projection[2][2] + 1.0f), Engine::SHADOW_DISTANCE);
+    const float tanHalfX = 1.0f / projection[0][0];
+    const float tanHalfY = 1.0f / projection[1][1];
+
+    const glm::mat4 cameraToWorld = glm::inverse(view);
+    const glm::vec3 cameraPosition = glm::vec3(cameraToWorld[3]);
+    const glm::vec3 forward = -glm::normalize(glm::vec3(cameraToWorld[2]));
+
+    if (staticGeometryVersion != m_cachedVersion) {
+        m_hasCache.fill(false);
+        m_cachedVersion = staticGeometryVersion;
+    }
+
+    float splitNear = near;
+    for (int i = 0; i < count; ++i) {
+        ShadowCascade& cascade = m_cascades[i];
+
+        // Divisão "prática": mistura da divisão logarítmica com a uniforme
+        float t = static_cast<float>(i + 1) / count;
+        float logSplit = near * std::pow(far / near, t);
+        float uniformSplit = near + (far - near) * t;
+        float splitFar = glm::mix(uniformSplit, logSplit, Engine::SHADOW_CASCADE_SPLIT_LAMBDA);
+
+        // Esfera da fatia [splitNear, splitFar]: centro no eixo de visão, equidistante dos cantos
+        // próximos e distantes (só depende de profundidades e FOV, não da orientação da câmera)
+        float k2 = tanHalfX * tanHalfX + tanHalfY * tanHalfY;
+        float centerDepth = std::min(0.5f * (splitNear + splitFar) * (1.0f + k2), splitFar);
+        float radius = std::sqrt((splitFar - centerDepth) * (splitFar - centerDepth) + splitFar * splitFar * k2);
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+        glm::vec3 center = cameraPosition + forward * centerDepth;
+
+        cascade.splitFar = splitFar;
+        cascade.cached = i >= Engine::SHADOW_CACHED_CASCADE_START;
+
+        if (!cascade.cached) {
+            fitCascade(cascade, center, radius, sunDirection);
+            cascade.needsRender = true;
+        } else {
+            // A cascata em cache é ajustada com margem: enquanto a câmera não sair dela, a mesma
+            // camada continua cobrindo a fatia e não precisa ser renderizada de novo
+            float cachedRadius = radius * (1.0f + Engine::SHADOW_CACHE_MOVE_THRESHOLD);
+            bool moved = glm::length(center - cascade.center) > radius * Engine::SHADOW_CACHE_MOVE_THRESHOLD;
+            bool sunChanged = glm::dot(sunDirection, m_cachedSunDirection[i]) < 0.99999f;
+            if (!m_hasCache[i] || moved || sunChanged) {
+                fitCascade(cascade, center, cachedRadius, sunDirection);
+                m_cachedSunDirection[i] = sunDirection;
+                cascade.needsRender = true;
+            } else {
+                cascade.needsRender = false;
+            }
+        }
+
+        splitNear = splitFar;
+    }
+}
+
+void ShadowCascades::markRendered(int index) {
+    m_hasCache[index] = true;
+    m_cascades[index].needsRender = false;
+}
+
+void ShadowCascades::fitCascade(ShadowCascade& cascade, const glm::vec3& center, float radius, const glm::vec3& sunDirection) const {
+    // Base fixa do espaço de luz (só depende da direção do sol)
+    glm::vec3 up = std::abs(sunDirection.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+    glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), -sunDirection, up);
+
+    // Alinha o centro à grade de texels: deslocamentos da câmera viram múltiplos inteiros de texel
+    const float texelSize = (2.0f * radius) / static_cast<float>(Engine::SHADOW_MAP_SIZE);
+    glm::vec3 centerLightSpace = glm::vec3(lightRotation * glm::vec4(center, 1.0f));
+    centerLightSpace.x = std::floor(centerLightSpace.x / texelSize) * texelSize;
+    centerLightSpace.y = std::floor(centerLightSpace.y / texelSize) * texelSize;
+
+    // Em Z a caixa vai do fundo da esfera até bem antes dela, na direção do sol, para incluir
+    // projetores de sombra fora da fatia
+    float zNear = -(centerLightSpace.z + radius + Engine::SHADOW_CASTER_EXTENT);
+    float zFar = -(centerLightSpace.z - radius);
+    glm::mat4 lightProjection = glm::ortho(centerLightSpace.x - radius, centerLightSpace.x + radius,
+                                           centerLightSpace.y - radius, centerLightSpace.y + radius,
+                                           zNear, zFar);
+
+    cascade.viewProjection = lightProjection * lightRotation;
+    cascade.casterFrustum = Frustum(cascade.viewProjection);
+    cascade.center = center;
+    cascade.radius = radius;
+}
+
+} // namespace Render
+} // namespace Engine
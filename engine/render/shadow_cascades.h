@@ -0,0 +1,56 @@
+// engine/render/shadow_cascades.h
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+#include "frustum.h"
+#include "./../core/config.h"
+
+namespace Engine {
+namespace Render {
+
+constexpr int kMaxShadowCascades = 4;
+static_assert(Engine::SHADOW_CASCADE_COUNT >= 1 && Engine::SHADOW_CASCADE_COUNT <= kMaxShadowCascades,
+              "SHADOW_CASCADE_COUNT deve estar entre 1 e 4");
+
+struct ShadowCascade {
+    glm::mat4 viewProjection = glm::mat4(1.0f); // Matriz usada para renderizar e amostrar a camada
+    Frustum casterFrustum;                      // Volume da cascata estendido na direção do sol
+    glm::vec3 center = glm::vec3(0.0f);         // Centro da esfera envolvente (mundo)
+    float radius = 0.0f;
+    float splitFar = 0.0f;                      // Profundidade de visão onde a cascata termina
+    bool cached = false;                        // Cascata distante: só objetos estáticos, re-renderizada sob demanda
+    bool needsRender = true;                    // A camada precisa ser renderizada neste frame
+};
+
+// Cascatas de sombra do sol ajustadas ao frustum da câmera.
+// Cada cascata envolve sua fatia do frustum com uma esfera (raio invariante à rotação da câmera) e
+// a projeção ortográfica é alinhada aos texels do shadow map, então as bordas da sombra não
+// "nadam" quando a câmera se move ou gira.
+class ShadowCascades {
+public:
+    ShadowCascades() = default;
+
+    // 'staticGeometryVersion' muda quando a geometria estática da cena muda (invalida as cascatas em cache)
+    void update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& sunDirection,
+                uint64_t staticGeometryVersion);
+
+    // Chamado depois que a cascata foi de fato gravada no frame
+    void markRendered(int index);
+
+    const ShadowCascade& getCascade(int index) const { return m_cascades[index]; }
+    int getCount() const { return Engine::SHADOW_CASCADE_COUNT; }
+
+private:
+    void fitCascade(ShadowCascade& cascade, const glm::vec3& center, float radius, const glm::vec3& sunDirection) const;
+
+    std::array<ShadowCascade, kMaxShadowCascades> m_cascades{};
+    std::array<bool, kMaxShadowCascades> m_hasCache{};
+    std::array<glm::vec3, kMaxShadowCascades> m_cachedSunDirection{};
+    uint64_t m_cachedVersion = 0;
+};
+
+} // namespace Render
+} // namespace Engine
@@ -0,0 +1,85 @@
+// engine/render/shadow_map.cpp
+#include "shadow_map.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+#include "./../memory/memory_tracker.h"
+
+#include <format>
+
+namespace Engine {
+namespace Render {
+
+ShadowMap::ShadowMap(int size, int layers)
+    : m_size(size), m_layers(layers) {
+}
+
+ShadowMap::~ShadowMap() {
+    if (m_framebuffer) {
+        glDeleteFramebuffers(1, &m_framebuffer);
+    }
+    if (m_texture) {
+        glDeleteTextures(1, &m_texture);
+        Memory::MemoryTracker::untrack(Memory::MemoryTag::Render, Memory::MemoryDomain::Gpu, getGpuBytes());
+    }
+}
+
+void ShadowMap::create() {
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_texture);
+    glTextureStorage3D(m_texture, 1, GL_DEPTH_COMPONENT32F, m_size, m_size, m_layers);
+    Memory::MemoryTracker::track(Memory::MemoryTag::Render, Memory::MemoryDomain::Gpu, getGpuBytes());
+    glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+    glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+    const float borderColor[] = {1.0f, 1.0f, 1.0f, 1.0f}; // Fora do mapa: sem sombra
+    glTextureParameterfv(m_texture, GL_TEXTURE_BORDER_COLOR, borderColor);
+    glTextureParameteri(m_texture, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTextureParameteri(m_texture, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+    glCreateFramebuffers(1, &m_framebuffer);
+    glNamedFramebufferDrawBuffer(m_framebuffer, GL_NONE);
+    glNamedFramebufferReadBuffer(m_framebuffer, GL_NONE);
+
+    Engine::Log::Info(std::format("ShadowMap: array de profundidade {}x{} com {} camada(s) criado.", m_size, m_size, m_layers));
+}
+
+void ShadowMap::beginLayer(int layer) {
+    if (!m_texture) {
+        create();
+    }
+
+    if (!m_inPass) {
+        glGetIntegerv(GL_VIEWPORT, m_savedViewport);
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_savedFramebuffer);
+        m_inPass = true;
+
+        // Bias por inclinação: reduz "acne" sem descolar a sombra do objeto
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(Engine::SHADOW_SLOPE_BIAS, Engine::SHADOW_CONSTANT_BIAS);
+    }
+
+    glNamedFramebufferTextureLayer(m_framebuffer, GL_DEPTH_ATTACHMENT, m_texture, 0, layer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+    glViewport(0, 0, m_size, m_size);
+    glClear(GL_DEPTH_BUFFER_BIT);
+}
+
+void ShadowMap::endPass() {
+    if (!m_inPass) {
+        return;
+    }
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_savedFramebuffer));
+    glViewport(m_savedViewport[0], m_savedViewport[1], m_savedViewport[2], m_savedViewport[3]);
+    m_inPass = false;
+}
+
+void ShadowMap::bind(GLuint unit) {
+    if (!m_texture) {
+        create();
+    }
+    glBindTextureUnit(unit, m_texture);
+}
+
+} // namespace Render
+} // namespace Engine
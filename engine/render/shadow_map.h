@@ -0,0 +1,47 @@
+// engine/render/shadow_map.h
+#pragma once
+
+#include <glad/gl.h>
+#include <cstddef>
+
+namespace Engine {
+namespace Render {
+
+// Array de texturas de profundidade (uma camada por cascata) e o framebuffer usado para preenchê-lo.
+// Todos os métodos só podem ser chamados na thread que possui o contexto GL; os recursos são
+// criados na primeira utilização.
+class ShadowMap {
+public:
+    ShadowMap(int size, int layers);
+    ~ShadowMap();
+
+    ShadowMap(const ShadowMap&) = delete;
+    ShadowMap& operator=(const ShadowMap&) = delete;
+
+    // Salva viewport/framebuffer atuais, direciona o desenho para a camada e limpa a profundidade
+    void beginLayer(int layer);
+    // Restaura o estado salvo no primeiro beginLayer
+    void endPass();
+
+    // Liga o array com comparação de profundidade (sampler2DArrayShadow) na unidade indicada
+    void bind(GLuint unit);
+
+    int getSize() const { return m_size; }
+    // Profundidade de 32 bits por texel, todas as camadas (registrado no MemoryTracker na criação)
+    size_t getGpuBytes() const { return static_cast<size_t>(m_size) * static_cast<size_t>(m_size) * static_cast<size_t>(m_layers) * 4; }
+
+private:
+    void create();
+
+    int m_size;
+    int m_layers;
+    GLuint m_texture = 0;
+    GLuint m_framebuffer = 0;
+
+    bool m_inPass = false;
+    GLint m_savedViewport[4] = {0, 0, 0, 0};
+    GLint m_savedFramebuffer = 0;
+};
+
+} // namespace Render
+} // namespace Engine
@@ -1,7 +1,9 @@
 // engine/render/texture.cpp
 #include "texture.h"
 #include "./../core/log.h"
+#include "./../core/profiler.h"
 #include "./../core/path_utils.h" // For Engine::loadFileFromEngineAssets
+#include "./../memory/memory_tracker.h"
 
 #include <stb_image.h> 
 
@@ -10,7 +12,7 @@ namespace Engine {
 namespace Render {
 
 Texture::Texture() : m_id(0) {
-    Engine::Log::Trace("Texture: Default constructor called (empty texture).");
+    ENGINE_LOG_TRACE("Texture: Default constructor called (empty texture).");
 }
 
 Texture::Texture(const std::string& filePath) : m_id(0), m_filePath(filePath) {
@@ -28,23 +30,26 @@ Texture::Texture(int width, int height, int numChannels, const unsigned char* da
 
 Texture::~Texture() {
     cleanup();
-    Engine::Log::Trace(std::format("Texture: Destrutor chamado. Recurso OpenGL da textura '{}' liberado.", m_filePath));
+    ENGINE_LOG_TRACE("Texture: Destrutor chamado. Recurso OpenGL da textura '{}' liberado.", m_filePath);
 }
 
 Texture::Texture(Texture&& other) noexcept
-    : m_id(other.m_id), m_filePath(std::move(other.m_filePath)) {
+    : m_id(other.m_id), m_gpuBytes(other.m_gpuBytes), m_filePath(std::move(other.m_filePath)) {
     other.m_id = 0; 
-    Engine::Log::Trace("Texture: Move-constructor chamado.");
+    other.m_gpuBytes = 0;
+    ENGINE_LOG_TRACE("Texture: Move-constructor chamado.");
 }
 
 Texture& Texture::operator=(Texture&& other) noexcept {
     if (this != &other) {
         cleanup(); 
         m_id = other.m_id;
+        m_gpuBytes = other.m_gpuBytes;
         m_filePath = std::move(other.m_filePath);
 
         other.m_id = 0; 
-        Engine::Log::Trace("Texture: Move-assignment chamado.");
+        other.m_gpuBytes = 0;
+        ENGINE_LOG_TRACE("Texture: Move-assignment chamado.");
     }
     return *this;
 }
@@ -64,6 +69,8 @@ void Texture::unbind() const {
 
 // Já existe loadTexture(filePath)
 bool Texture::loadTexture(const std::string& filePath) {
+    ENGINE_PROFILE_SCOPE("Texture::load");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::Asset);
     int width, height, numChannels;
     unsigned char* data = stbi_load(Engine::resolveEnginePath(filePath).string().c_str(), &width, &height, &numChannels, 0);
 
@@ -72,8 +79,12 @@ bool Texture::loadTexture(const std::string& filePath) {
         return false;
     }
 
+    // A imagem decodificada só vive até o upload, mas entra no pico de memória dos assets
+    const size_t imageBytes = static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(numChannels);
+    Memory::MemoryTracker::track(Memory::MemoryTag::Asset, Memory::MemoryDomain::Cpu, imageBytes);
     bool success = createTextureFromData(width, height, numChannels, data);
     stbi_image_free(data); 
+    Memory::MemoryTracker::untrack(Memory::MemoryTag::Asset, Memory::MemoryDomain::Cpu, imageBytes);
     return success;
 }
 
@@ -84,6 +95,7 @@ bool Texture::createTextureFromData(int width, int height, int numChannels, cons
         return false;
     }
     
+    ENGINE_PROFILE_SCOPE("Texture::upload");
     GLenum format = GL_RGB; 
     if (numChannels == 4) { format = GL_RGBA; }
     else if (numChannels == 1) { format = GL_RED; }
@@ -99,6 +111,12 @@ bool Texture::createTextureFromData(int width, int height, int numChannels, cons
     glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
     glGenerateMipmap(GL_TEXTURE_2D); 
 
+    // Drivers guardam RGB com 4 bytes por texel; a cadeia de mips soma mais um terço
+    const size_t texelBytes = numChannels == 3 ? 4 : static_cast<size_t>(numChannels);
+    const size_t levelBytes = static_cast<size_t>(width) * static_cast<size_t>(height) * texelBytes;
+    m_gpuBytes = levelBytes + levelBytes / 3;
+    Memory::MemoryTracker::track(Memory::MemoryTag::Render, Memory::MemoryDomain::Gpu, m_gpuBytes);
+
     Engine::Log::Info(std::format("Texture: Textura criada de dados brutos ({}x{}, {} canais). ID: {}.", width, height, numChannels, m_id));
     return true;
 }
@@ -108,6 +126,8 @@ void Texture::cleanup() {
     if (m_id != 0) {
         glDeleteTextures(1, &m_id);
         m_id = 0;
+        Memory::MemoryTracker::untrack(Memory::MemoryTag::Render, Memory::MemoryDomain::Gpu, m_gpuBytes);
+        m_gpuBytes = 0;
     }
 }
 
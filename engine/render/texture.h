@@ -6,10 +6,13 @@
 #include <memory>    // For unique_ptr
 #include <vector>    // For raw pixel data if needed (optional for texture class)
 
+#include "./../memory/pool_allocator.h"
+
 namespace Engine {
 namespace Render {
 
-class Texture {
+// Objetos Texture vêm do pool do tipo (Memory::Pooled); os texels ficam na GPU
+class Texture : public Memory::Pooled<Texture, Memory::MemoryTag::Render> {
 public:
     Texture(); // Default constructor (creates empty texture)
     Texture(const std::string& filePath); // Constructor for loading from file path
@@ -32,6 +35,7 @@ public:
 
 private:
     GLuint m_id; // OpenGL texture ID
+    size_t m_gpuBytes = 0; // Estimativa registrada no MemoryTracker (com mips)
     std::string m_filePath; // Optional, only for file-loaded textures
 
     void cleanup();
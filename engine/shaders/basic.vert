@@ -1,9 +1,9 @@
 #version 450 core
 
-layout(location = 0) in vec3 aPos;
+layout(location = 0) in vec4 aPos;      // Ver common/vertex_decode.glsl para os dois formatos
 layout(location = 1) in vec3 aNormal;
 layout(location = 2) in vec2 aTexCoords;
-layout(location = 3) in vec3 aTangent; // NOVO: Atributo para tangente
+layout(location = 3) in vec4 aTangent; // NOVO: Atributo para tangente (w = sinal da bitangente)
 
 out vec3 FragPos;      
 out vec3 Normal;       
@@ -15,15 +15,21 @@ uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProjection;
 
+#include "common/vertex_decode.glsl"
+
+// Profundidade idêntica à do pré-pass (depth_prepass.vert), testada com GL_EQUAL
+invariant gl_Position;
+
 void main() {
-    FragPos = vec3(uModel * vec4(aPos, 1.0));    
-    Normal = mat3(transpose(inverse(uModel))) * aNormal; // Normal transformada para espaço do mundo
+    vec3 position = decodePosition(aPos);
+    FragPos = vec3(uModel * vec4(position, 1.0));    
+    Normal = mat3(transpose(inverse(uModel))) * decodeDirection(aNormal); // Normal transformada para espaço do mundo
     TexCoords = aTexCoords; 
 
     // NOVO: Calcular Bitangente e transformar TBN para o fragment shader
-    Tangent = mat3(transpose(inverse(uModel))) * aTangent; // Tangente transformada para espaço do mundo
-    Bitangent = normalize(cross(Normal, Tangent)); // Calcula Bitangente no espaço do mundo
+    Tangent = mat3(transpose(inverse(uModel))) * decodeDirection(aTangent.xyz); // Tangente transformada para espaço do mundo
+    Bitangent = normalize(cross(Normal, Tangent)) * decodeBitangentSign(aPos, aTangent); // Calcula Bitangente no espaço do mundo
     Tangent = normalize(Tangent); // Normaliza tangente para evitar problemas de escala
 
-    gl_Position = uProjection * uView * uModel * vec4(aPos, 1.0);
-}
\ No newline at end of file
+    gl_Position = uProjection * uView * uModel * vec4(position, 1.0);
+}
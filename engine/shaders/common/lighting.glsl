@@ -0,0 +1,136 @@
+// engine/shaders/common/lighting.glsl
+// Iluminação da cena: sol com sombra em cascatas + luzes pontuais clusterizadas.
+// Requer: common/surface.glsl
+uniform vec3 uLightPos;            
+uniform vec3 uViewPos;             
+uniform mat4 uView;       // Mesmas matrizes do vertex shader (profundidade de visão para o cluster)
+uniform mat4 uProjection;
+
+// --- Luzes pontuais em forward clusterizado (ver Render::ClusteredLighting) ---
+struct PointLight {
+    vec4 positionRadius; // xyz = posição no mundo, w = raio
+    vec4 colorIntensity; // rgb = cor, a = intensidade
+};
+layout(std430, binding = 0) readonly buffer PointLightBuffer { PointLight pointLights[]; };
+layout(std430, binding = 1) readonly buffer ClusterBuffer { uvec2 clusters[]; }; // (offset, count)
+layout(std430, binding = 2) readonly buffer LightIndexBuffer { uint lightIndices[]; };
+
+// --- Sombra do sol em cascatas (ver Render::ShadowCascades) ---
+uniform sampler2DArrayShadow uShadowMap;
+uniform mat4 uCascadeViewProjection[4];
+uniform vec4 uCascadeSplits;  // Profundidade de visão onde cada cascata termina
+uniform int uCascadeCount;     // 0 = sombras desligadas
+uniform float uShadowTexelSize; // 1 / resolução do shadow map
+
+uniform vec4 uClusterGrid;  // xyz = froxels por eixo, w = fatias por unidade de log(profundidade)
+uniform float uClusterNear;
+
+// Cook-Torrance (GGX + Schlick), sem o termo de radiância
+vec3 evaluateBRDF(vec3 N, vec3 V, vec3 L, vec3 baseColor, float metallic, float roughness) {
+    vec3 H = normalize(L + V); 
+
+    float NdotH = max(dot(N, H), 0.0);
+    float alpha = roughness * roughness;
+    float alphaSq = alpha * alpha;
+    float NdotH_sq = NdotH * NdotH;
+    float denomD = (NdotH_sq * (alphaSq - 1.0) + 1.0);
+    float D = alphaSq / (3.14159265359 * denomD * denomD);
+
+    float NdotL = max(dot(N, L), 0.0);
+    float NdotV = max(dot(N, V), 0.0);
+    float k_schlick = alphaSq / 2.0; 
+    float G_schlick_L = NdotL / (NdotL * (1.0 - k_schlick) + k_schlick);
+    float G_schlick_V = NdotV / (NdotV * (1.0 - k_schlick) + k_schlick);
+    float G = G_schlick_L * G_schlick_V;
+
+    vec3 F0 = vec3(0.04); 
+    F0 = mix(F0, baseColor, metallic); 
+    vec3 F = F0 + (vec3(1.0) - F0) * pow(clamp(1.0 - NdotV, 0.0, 1.0), 5.0);
+
+    vec3 specularPBR = (D * G * F) / max(4.0 * NdotL * NdotV, 0.001); 
+
+    vec3 diffusePBR = (vec3(1.0) - F) * (1.0 - metallic) * baseColor / 3.14159265359;
+
+    return (diffusePBR + specularPBR) * NdotL;
+}
+
+// Visibilidade do sol (0 = sombra, 1 = iluminado) com PCF 3x3 sobre a comparação em hardware
+float evaluateSunShadow(vec3 worldPos, float viewDepth) {
+    int cascade = 0;
+    while (cascade < uCascadeCount - 1 && viewDepth > uCascadeSplits[cascade]) {
+        ++cascade;
+    }
+    if (uCascadeCount == 0 || viewDepth > uCascadeSplits[uCascadeCount - 1]) {
+        return 1.0;
+    }
+
+    vec4 lightClip = uCascadeViewProjection[cascade] * vec4(worldPos, 1.0);
+    vec3 coords = lightClip.xyz / lightClip.w * 0.5 + 0.5;
+    if (coords.z > 1.0) {
+        return 1.0;
+    }
+
+    float visibility = 0.0;
+    for (int y = -1; y <= 1; ++y) {
+        for (int x = -1; x <= 1; ++x) {
+            vec2 offset = vec2(x, y) * uShadowTexelSize;
+            visibility += texture(uShadowMap, vec4(coords.xy + offset, float(cascade), coords.z));
+        }
+    }
+    return visibility / 9.0;
+}
+
+// Soma das luzes pontuais do froxel que contém o fragmento
+vec3 evaluatePointLights(vec3 worldPos, vec3 N, vec3 V, vec3 baseColor, float metallic, float roughness) {
+    vec4 clip = uProjection * uView * vec4(worldPos, 1.0);
+    vec2 ndc = clip.xy / clip.w;
+    float viewDepth = -(uView * vec4(worldPos, 1.0)).z;
+
+    uvec3 grid = uvec3(uClusterGrid.xyz);
+    uvec2 tile = uvec2(clamp((ndc * 0.5 + 0.5) * uClusterGrid.xy, vec2(0.0), uClusterGrid.xy - 1.0));
+    uint slice = uint(clamp(floor(log(max(viewDepth, uClusterNear) / uClusterNear) * uClusterGrid.w), 0.0, uClusterGrid.z - 1.0));
+    uvec2 cluster = clusters[(slice * grid.y + tile.y) * grid.x + tile.x];
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0u; i < cluster.y; ++i) {
+        PointLight light = pointLights[lightIndices[cluster.x + i]];
+        vec3 toLight = light.positionRadius.xyz - worldPos;
+        float distSq = dot(toLight, toLight);
+        float radius = light.positionRadius.w;
+
+        // Inverso do quadrado com janela suave que zera a contribuição no raio
+        float ratio = distSq / (radius * radius);
+        float window = clamp(1.0 - ratio * ratio, 0.0, 1.0);
+        float attenuation = window * window / (distSq + 1.0);
+
+        vec3 L = toLight * inversesqrt(max(distSq, 1e-8));
+        vec3 radiance = light.colorIntensity.rgb * light.colorIntensity.a * attenuation;
+        result += radiance * evaluateBRDF(N, V, L, baseColor, metallic, roughness);
+    }
+    return result;
+}
+
+// Cor final de uma superfície no ponto 'worldPos'
+vec3 shadeSurface(Surface s, vec3 worldPos) {
+    // --- PBR Lighting Model (Cook-Torrance) ---
+    vec3 lightColor = vec3(1.0); 
+    float lightIntensity = 30.0; 
+
+    vec3 N = s.normal; 
+    vec3 L = normalize(uLightPos); 
+    vec3 V = normalize(uViewPos - worldPos); 
+
+    // **** MUDANÇA: Aumentar AINDA MAIS a luz ambiente para 0.5 (ou mais) ****
+    vec3 ambient_light_color = vec3(0.7); // Era 0.15, aumentar para 0.5
+    vec3 ambient_contribution = ambient_light_color * s.baseColor; 
+
+    float viewDepth = -(uView * vec4(worldPos, 1.0)).z;
+    float sunVisibility = evaluateSunShadow(worldPos, viewDepth);
+
+    vec3 direct_light_contribution = lightColor * lightIntensity * sunVisibility * evaluateBRDF(N, V, L, s.baseColor, s.metallic, s.roughness);
+    direct_light_contribution += evaluatePointLights(worldPos, N, V, s.baseColor, s.metallic, s.roughness);
+
+    vec3 finalColor = ambient_contribution + direct_light_contribution + s.emissive; 
+    finalColor *= s.occlusion; 
+    return finalColor;
+}
@@ -0,0 +1,23 @@
+// engine/shaders/common/lod_dither.glsl
+// Cross-fade de LOD por dither: 1.0 = sem transição; [0,1) = LOD entrando (progresso);
+// [-1,0) = LOD saindo (progresso - 1). Os padrões das duas LODs são complementares.
+uniform float uLodFade;
+
+// Limiar de Bayer 4x4 em (0,1) para a posição do pixel
+float ditherThreshold(vec2 fragCoord) {
+    const float bayer[16] = float[16](0.0, 8.0, 2.0, 10.0, 12.0, 4.0, 14.0, 6.0,
+                                      3.0, 11.0, 1.0, 9.0, 15.0, 7.0, 13.0, 5.0);
+    ivec2 p = ivec2(mod(fragCoord, 4.0));
+    return (bayer[p.y * 4 + p.x] + 0.5) / 16.0;
+}
+
+// Descarta o fragmento fora do padrão de dither da LOD atual (só durante o cross-fade)
+void applyLodDither() {
+    if (uLodFade < 1.0) {
+        float threshold = ditherThreshold(gl_FragCoord.xy);
+        bool visible = uLodFade >= 0.0 ? (threshold < uLodFade) : (threshold >= uLodFade + 1.0);
+        if (!visible) {
+            discard;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+// engine/shaders/common/material.glsl
+// Requer: common/surface.glsl
+// Material PBR (uniforms)
+struct Material {
+    sampler2D baseColorMap;
+    sampler2D normalMap;
+    sampler2D roughnessMap;
+    sampler2D metallicMap;
+    sampler2D occlusionMap;
+    sampler2D emissiveMap;
+
+    vec4 baseColorFactor;
+    float metallicFactor;
+    float roughnessFactor; 
+    vec3 emissiveFactor;
+    float normalScale;
+    float occlusionStrength;
+
+    int hasBaseColorMap;
+    int hasNormalMap;
+    int hasRoughnessMap;
+    int hasMetallicMap;
+    int hasOcclusionMap;
+    int hasEmissiveMap;
+};
+uniform Material uMaterial; 
+
+
+// Amostra o material PBR (glTF metallic/roughness) no ponto do fragmento
+Surface sampleMaterial(vec2 uv, vec3 vertexNormal, vec3 tangent, vec3 bitangent) {
+    Surface s;
+
+    // 1. Texturas e Fatores Base
+    s.baseColor = uMaterial.baseColorFactor.rgb;
+    if (uMaterial.hasBaseColorMap == 1) {
+        s.baseColor *= texture(uMaterial.baseColorMap, uv).rgb;
+    }
+
+    // 2. Normal Map
+    s.normal = normalize(vertexNormal);
+    if (uMaterial.hasNormalMap == 1) {
+        vec3 normalMapTangentSpace = texture(uMaterial.normalMap, uv).rgb;
+        normalMapTangentSpace = normalize(normalMapTangentSpace * 2.0 - 1.0); 
+
+        mat3 tbn = mat3(normalize(tangent), normalize(bitangent), normalize(vertexNormal)); 
+        s.normal = normalize(tbn * normalMapTangentSpace);
+        s.normal *= uMaterial.normalScale; 
+    }
+    
+    // 3. Roughness e Metallic (GLTF PBR Metallic/Roughness Workflow)
+    s.metallic = uMaterial.metallicFactor; 
+    s.roughness = uMaterial.roughnessFactor; 
+
+    if (uMaterial.hasRoughnessMap == 1) { 
+        vec4 metallicRoughnessMap = texture(uMaterial.roughnessMap, uv);
+        s.roughness *= metallicRoughnessMap.g; 
+        s.metallic *= metallicRoughnessMap.b; 
+    }
+    if (uMaterial.hasMetallicMap == 1) { 
+        s.metallic *= texture(uMaterial.metallicMap, uv).r; 
+    }
+    
+    s.occlusion = 1.0;
+    if (uMaterial.hasOcclusionMap == 1) {
+        s.occlusion = texture(uMaterial.occlusionMap, uv).r; 
+        s.occlusion = mix(1.0, s.occlusion, uMaterial.occlusionStrength); 
+    }
+
+    s.emissive = uMaterial.emissiveFactor;
+    if (uMaterial.hasEmissiveMap == 1) {
+        s.emissive += texture(uMaterial.emissiveMap, uv).rgb;
+    }
+    return s;
+}
@@ -0,0 +1,10 @@
+// engine/shaders/common/surface.glsl
+// Propriedades de superfície já amostradas do material (comuns ao forward e ao deferred)
+struct Surface {
+    vec3 baseColor;
+    vec3 normal;     // Mundo, normalizada
+    float metallic;
+    float roughness;
+    float occlusion;
+    vec3 emissive;
+};
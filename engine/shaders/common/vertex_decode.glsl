@@ -0,0 +1,23 @@
+// engine/shaders/common/vertex_decode.glsl
+// Decodificação dos dois formatos de vértice da Mesh (Asset::VertexFormat):
+//   float:      aPos = vec3 (w = 1), aNormal = vec3, aTangent = vec4 (w = sinal da bitangente)
+//   quantizado: aPos = unorm16 x 4 relativo à AABB (w = sinal da bitangente),
+//               aNormal/aTangent = octaédrico snorm16 x 2, UV em half float
+#include "octahedral.glsl"
+
+uniform vec3 uPositionOffset; // Mínimo da AABB (0 no formato float)
+uniform vec3 uPositionScale;  // Tamanho da AABB (1 no formato float)
+uniform int uQuantizedVertex;
+
+// Mesma expressão nos dois formatos: a profundidade do pré-pass precisa bater com a do pass principal
+vec3 decodePosition(vec4 position) {
+    return uPositionOffset + uPositionScale * position.xyz;
+}
+
+vec3 decodeDirection(vec3 direction) {
+    return uQuantizedVertex != 0 ? decodeOctahedral(direction.xy) : direction;
+}
+
+float decodeBitangentSign(vec4 position, vec4 tangent) {
+    return uQuantizedVertex != 0 ? position.w * 2.0 - 1.0 : (tangent.w < 0.0 ? -1.0 : 1.0);
+}
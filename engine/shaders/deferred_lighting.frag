@@ -0,0 +1,41 @@
+#version 450 core
+
+// Resolve do deferred: lê o G-buffer e aplica a mesma iluminação do forward (common/lighting.glsl)
+out vec4 FragColor;
+
+in vec2 ScreenUV;
+
+uniform sampler2D uGBufferAlbedo;
+uniform sampler2D uGBufferNormal;
+uniform sampler2D uGBufferMaterial;
+uniform sampler2D uGBufferEmissive;
+uniform sampler2D uGBufferDepth;
+uniform mat4 uInverseViewProjection;
+
+#include "common/surface.glsl"
+#include "common/lighting.glsl"
+#include "common/octahedral.glsl"
+
+void main() {
+    float depth = texture(uGBufferDepth, ScreenUV).r;
+    if (depth >= 1.0) {
+        discard; // Fundo: mantém a cor de limpeza
+    }
+
+    // Posição no mundo reconstruída da profundidade
+    vec4 clip = vec4(ScreenUV * 2.0 - 1.0, depth * 2.0 - 1.0, 1.0);
+    vec4 world = uInverseViewProjection * clip;
+    vec3 worldPos = world.xyz / world.w;
+
+    vec4 material = texture(uGBufferMaterial, ScreenUV);
+
+    Surface surface;
+    surface.baseColor = texture(uGBufferAlbedo, ScreenUV).rgb;
+    surface.normal = decodeOctahedral(texture(uGBufferNormal, ScreenUV).rg);
+    surface.metallic = material.r;
+    surface.roughness = material.g;
+    surface.occlusion = material.b;
+    surface.emissive = texture(uGBufferEmissive, ScreenUV).rgb;
+
+    FragColor = vec4(shadeSurface(surface, worldPos), 1.0);
+}
@@ -0,0 +1,8 @@
+#version 450 core
+
+#include "common/lod_dither.glsl"
+
+// Só profundidade; o dither de LOD precisa ser o mesmo do pass principal
+void main() {
+    applyLodDither();
+}
@@ -0,0 +1,18 @@
+#version 450 core
+
+// Pré-pass de profundidade: lê só o stream de posições (vec3 ou unorm16 x 4)
+layout(location = 0) in vec4 aPos;
+
+uniform mat4 uModel;
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+#include "common/vertex_decode.glsl"
+
+// Mesma expressão de basic.vert: o pass principal usa GL_EQUAL e precisa da mesma profundidade
+invariant gl_Position;
+
+void main() {
+    vec3 position = decodePosition(aPos);
+    gl_Position = uProjection * uView * uModel * vec4(position, 1.0);
+}
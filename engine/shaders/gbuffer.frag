@@ -0,0 +1,28 @@
+#version 450 core
+
+// G-buffer do modo deferred (ver Render::GBuffer). Mesmo vertex shader e mesmo Material do forward.
+layout(location = 0) out vec4 gAlbedo;   // RGBA8: cor base, a livre
+layout(location = 1) out vec2 gNormal;   // RG16_SNORM: normal em octaedro
+layout(location = 2) out vec4 gMaterial; // RGBA8: metallic, roughness, oclusão, a livre
+layout(location = 3) out vec3 gEmissive; // R11G11B10F
+
+in vec3 FragPos;   
+in vec3 Normal;    
+in vec2 TexCoords; 
+in vec3 Tangent;    
+in vec3 Bitangent;  
+
+#include "common/surface.glsl"
+#include "common/material.glsl"
+#include "common/lod_dither.glsl"
+#include "common/octahedral.glsl"
+
+void main() {
+    applyLodDither();
+
+    Surface surface = sampleMaterial(TexCoords, Normal, Tangent, Bitangent);
+    gAlbedo = vec4(surface.baseColor, 1.0);
+    gNormal = encodeOctahedral(normalize(surface.normal));
+    gMaterial = vec4(surface.metallic, surface.roughness, surface.occlusion, 0.0);
+    gEmissive = surface.emissive;
+}
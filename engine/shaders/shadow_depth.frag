@@ -0,0 +1,10 @@
+#version 450 core
+
+#include "common/lod_dither.glsl"
+
+// Só profundidade: o framebuffer da sombra não tem anexos de cor.
+// Os projetores são gravados com uLodFade = 1.0 (sem dither); o uniform existe porque
+// todo DrawMesh o define.
+void main() {
+    applyLodDither();
+}
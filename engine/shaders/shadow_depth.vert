@@ -0,0 +1,12 @@
+#version 450 core
+
+layout(location = 0) in vec4 aPos; // Stream de posições (vec3 ou unorm16 x 4)
+
+uniform mat4 uModel;
+uniform mat4 uLightViewProjection; // Cascata sendo renderizada
+
+#include "common/vertex_decode.glsl"
+
+void main() {
+    gl_Position = uLightViewProjection * uModel * vec4(decodePosition(aPos), 1.0);
+}
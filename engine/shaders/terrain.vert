@@ -0,0 +1,71 @@
+#version 450 core
+
+// Terreno CDLOD (ver Terrain::TerrainSystem): grade compartilhada instanciada, altura do array de heightmaps.
+// Usa os mesmos fragment shaders das meshes (basic.frag no forward, gbuffer.frag no deferred).
+layout(location = 0) in vec2 aGridPos;    // [0, 1] dentro do pedaço
+layout(location = 1) in vec3 iChunk;      // Por instância: origem (x, z) e lado em metros
+layout(location = 2) in uvec2 iLodLayer;  // Por instância: LOD e camada do heightmap
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoords;
+out vec3 Tangent;
+out vec3 Bitangent;
+
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+uniform sampler2DArray uTerrainHeightmaps;
+uniform vec4 uTerrainParams; // x = lado do tile, y = amostras por lado, z = lado da folha, w = quads da grade inteira
+uniform vec4 uTerrainLod;    // x = alcance da LOD 0, y = início do morph (fração), z = UV por metro
+uniform vec3 uTerrainCamera;
+
+float sampleHeight(vec2 world, vec2 tileOrigin, float layer) {
+    // Primeira e última amostra exatamente nas bordas do tile (centros dos texels das bordas)
+    float resolution = uTerrainParams.y;
+    vec2 uv = (world - tileOrigin) / uTerrainParams.x;
+    uv = (uv * (resolution - 1.0) + 0.5) / resolution;
+    return textureLod(uTerrainHeightmaps, vec3(uv, layer), 0.0).r;
+}
+
+// Mesma fórmula de Terrain::CdlodRanges::morphRange
+vec2 morphRange(float lod) {
+    float end = uTerrainLod.x * exp2(lod);
+    float previous = lod > 0.0 ? uTerrainLod.x * exp2(lod - 1.0) : 0.0;
+    float start = previous + (end - previous) * uTerrainLod.y;
+    return vec2(start, mix(start, end, 0.95));
+}
+
+void main() {
+    float lod = float(iLodLayer.x);
+    float layer = float(iLodLayer.y);
+    // O centro do pedaço está sempre dentro do tile (a origem pode cair exatamente na borda)
+    vec2 tileOrigin = floor((iChunk.xy + 0.5 * iChunk.z) / uTerrainParams.x) * uTerrainParams.x;
+
+    vec2 world = iChunk.xy + aGridPos * iChunk.z;
+    float height = sampleHeight(world, tileOrigin, layer);
+
+    // Morph: vértices ímpares deslizam até o vizinho par, virando a grade da LOD seguinte na borda do alcance.
+    // Depende só da distância, então pedaços vizinhos (de LODs diferentes) concordam na borda.
+    float spacing = uTerrainParams.z * exp2(lod) / uTerrainParams.w;
+    vec2 range = morphRange(lod);
+    float morph = clamp((distance(uTerrainCamera, vec3(world.x, height, world.y)) - range.x) / (range.y - range.x), 0.0, 1.0);
+    vec2 odd = mod(round((world - tileOrigin) / spacing), 2.0);
+    world -= odd * spacing * morph;
+    height = sampleHeight(world, tileOrigin, layer);
+
+    // Normal por diferenças centrais, um texel de heightmap para cada lado
+    float texel = uTerrainParams.x / (uTerrainParams.y - 1.0);
+    float left = sampleHeight(world - vec2(texel, 0.0), tileOrigin, layer);
+    float right = sampleHeight(world + vec2(texel, 0.0), tileOrigin, layer);
+    float down = sampleHeight(world - vec2(0.0, texel), tileOrigin, layer);
+    float up = sampleHeight(world + vec2(0.0, texel), tileOrigin, layer);
+
+    FragPos = vec3(world.x, height, world.y);
+    Normal = normalize(vec3(left - right, 2.0 * texel, down - up));
+    Tangent = normalize(vec3(2.0 * texel, right - left, 0.0));
+    Bitangent = normalize(cross(Tangent, Normal)); // +z, acompanhando TexCoords.y
+    TexCoords = world * uTerrainLod.z;
+
+    gl_Position = uProjection * uView * vec4(FragPos, 1.0);
+}
@@ -0,0 +1,42 @@
+#version 450 core
+
+// Vegetação instanciada (ver Vegetation::VegetationSystem): malha do tipo + instância compacta (16 bytes).
+// Usa os mesmos fragment shaders das meshes (basic.frag no forward, gbuffer.frag no deferred).
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec3 aNormal;
+layout(location = 2) in vec3 iPosition;  // Por instância: base no chão, em coordenadas de mundo
+layout(location = 3) in uint iYawScale;  // Por instância: yaw (16 bits baixos) e escala (16 bits altos), unorm
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoords;
+out vec3 Tangent;
+out vec3 Bitangent;
+
+uniform mat4 uView;
+uniform mat4 uProjection;
+uniform vec4 uVegetationWind; // x = tempo (s), y = balanço por metro de altura (0 = rígido)
+
+const float kTwoPi = 6.28318530718;
+const float kMaxScale = 4.0; // Vegetation::kVegetationMaxScale
+
+void main() {
+    float yaw = float(iYawScale & 0xFFFFu) / 65535.0 * kTwoPi;
+    float scale = float(iYawScale >> 16u) / 65535.0 * kMaxScale;
+    float s = sin(yaw);
+    float c = cos(yaw);
+    mat3 rotation = mat3(c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c);
+
+    vec3 local = rotation * (aPos * scale);
+    // Vento: a base fica presa e o topo balança, com fase pela posição (tufos vizinhos fora de sincronia)
+    float phase = uVegetationWind.x * 1.7 + dot(iPosition.xz, vec2(0.31, 0.23));
+    local.xz += vec2(sin(phase), cos(phase * 0.8)) * uVegetationWind.y * max(local.y, 0.0);
+
+    FragPos = iPosition + local;
+    Normal = normalize(rotation * aNormal);
+    Tangent = normalize(abs(Normal.y) < 0.99 ? cross(vec3(0.0, 1.0, 0.0), Normal) : vec3(1.0, 0.0, 0.0));
+    Bitangent = cross(Normal, Tangent);
+    TexCoords = FragPos.xz; // Material sem texturas: só mantém a interface de basic.frag / gbuffer.frag
+
+    gl_Position = uProjection * uView * vec4(FragPos, 1.0);
+}
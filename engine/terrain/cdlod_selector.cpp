@@ -0,0 +1,85 @@
+// engine/terrain/cdlod_selector.cpp
+#include "cdlod_selector.h"
+#include "terrain_tile.h"
+#include "./../render/frustum.h"
+
+#include <algorithm>
+
+namespace Engine {
+namespace Terrain {
+
+glm::vec2 CdlodRanges::morphRange(int lod) const {
+    const float previous = lod > 0 ? range(lod - 1) : 0.0f;
+    const float end = range(lod);
+    const float start = previous + (end - previous) * morphStartRatio;
+    return glm::vec2(start, glm::mix(start, end, 0.95f));
+}
+
+namespace {
+
+    enum class NodeResult {
+        OutOfFrustum,
+        OutOfRange,
+        Selected
+    };
+
+    bool sphereIntersectsBox(const glm::vec3& center, float radius, const glm::vec3& min, const glm::vec3& max) {
+        const glm::vec3 closest = glm::clamp(center, min, max);
+        const glm::vec3 delta = closest - center;
+        return glm::dot(delta, delta) <= radius * radius;
+    }
+
+    struct SelectContext {
+        const TerrainTile& tile;
+        const Render::Frustum& frustum;
+        glm::vec3 cameraPosition;
+        const CdlodRanges& ranges;
+        float leafSize;
+        CdlodSelection& selection;
+    };
+
+    NodeResult selectNode(SelectContext& context, int lod, int nx, int nz) {
+        context.selection.nodesVisited++;
+
+        const float nodeSize = context.leafSize * static_cast<float>(1u << lod);
+        const glm::vec2 origin = context.tile.getOrigin() + glm::vec2(static_cast<float>(nx), static_cast<float>(nz)) * nodeSize;
+        const glm::vec2 heights = context.tile.getNodeMinMax(lod, nx, nz);
+        const glm::vec3 boxMin(origin.x, heights.x, origin.y);
+        const glm::vec3 boxMax(origin.x + nodeSize, heights.y, origin.y + nodeSize);
+
+        if (!context.frustum.intersectsBox(boxMin, boxMax)) {
+            return NodeResult::OutOfFrustum;
+        }
+        if (!sphereIntersectsBox(context.cameraPosition, context.ranges.range(lod), boxMin, boxMax)) {
+            return NodeResult::OutOfRange; // O pai cobre esta área com a própria LOD
+        }
+
+        const uint16_t layer = static_cast<uint16_t>(std::max(context.tile.getLayer(), 0));
+        if (lod == 0 || !sphereIntersectsBox(context.cameraPosition, context.ranges.range(lod - 1), boxMin, boxMax)) {
+            context.selection.fullChunks.push_back({origin, nodeSize, static_cast<uint16_t>(lod), layer});
+            return NodeResult::Selected;
+        }
+
+        // Parte do nó precisa de mais detalhe: filhos fora do alcance da LOD mais fina viram quadrantes nesta LOD
+        for (int child = 0; child < 4; ++child) {
+            const int cx = nx * 2 + (child & 1);
+            const int cz = nz * 2 + (child >> 1);
+            if (selectNode(context, lod - 1, cx, cz) == NodeResult::OutOfRange) {
+                const float childSize = nodeSize * 0.5f;
+                const glm::vec2 childOrigin = origin + glm::vec2(static_cast<float>(child & 1), static_cast<float>(child >> 1)) * childSize;
+                context.selection.quadrantChunks.push_back({childOrigin, childSize, static_cast<uint16_t>(lod), layer});
+            }
+        }
+        return NodeResult::Selected;
+    }
+
+} // namespace
+
+void CdlodSelector::select(const TerrainTile& tile, const Render::Frustum& frustum, const glm::vec3& cameraPosition,
+                           const CdlodRanges& ranges, float leafSize, CdlodSelection& selection) {
+    SelectContext context{tile, frustum, cameraPosition, ranges, leafSize, selection};
+    selectNode(context, ranges.lodCount - 1, 0, 0);
+}
+
+} // namespace Terrain
+} // namespace Engine
@@ -0,0 +1,65 @@
+// engine/terrain/cdlod_selector.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Render {
+    class Frustum;
+}
+namespace Terrain {
+
+class TerrainTile;
+
+// Instância de desenho de um pedaço do terreno (lida como atributo por instância em terrain.vert).
+// Nós inteiros usam a grade completa; quadrantes de um nó (filho fora do alcance da LOD mais fina)
+// usam a meia grade, com 'origin'/'size' do quadrante e a LOD do pai.
+struct TerrainChunkInstance {
+    glm::vec2 origin; // Canto mínimo (x, z) em metros
+    float size;       // Lado em metros
+    uint16_t lod;
+    uint16_t layer;   // Camada do heightmap no array de texturas
+};
+static_assert(sizeof(TerrainChunkInstance) == 16, "TerrainChunkInstance deve ter 16 bytes");
+
+// Alcances das LODs: LOD i cobre até leafRange * 2^i; o morph da LOD i acontece entre morphStart e morphEnd
+struct CdlodRanges {
+    float leafRange = 0.0f;
+    float morphStartRatio = 0.0f;
+    int lodCount = 0;
+
+    float range(int lod) const { return leafRange * static_cast<float>(1u << lod); }
+    // (início, fim) do morph em distância da câmera; termina um pouco antes do alcance para chegar a 1
+    glm::vec2 morphRange(int lod) const;
+};
+
+struct CdlodSelection {
+    std::vector<TerrainChunkInstance> fullChunks;
+    std::vector<TerrainChunkInstance> quadrantChunks;
+    uint64_t nodesVisited = 0;
+
+    void clear() {
+        fullChunks.clear();
+        quadrantChunks.clear();
+        nodesVisited = 0;
+    }
+};
+
+// Seleção de nós do CDLOD (Strugar, "Continuous Distance-Dependent Level of Detail"):
+// desce a quadtree de min/max de cada tile testando frustum e esferas de alcance por LOD.
+// O custo depende só do que está dentro do alcance máximo, não do tamanho do mundo.
+class CdlodSelector {
+public:
+    // Acrescenta em 'selection' os nós visíveis de 'tile'
+    static void select(const TerrainTile& tile, const Render::Frustum& frustum, const glm::vec3& cameraPosition,
+                       const CdlodRanges& ranges, float leafSize, CdlodSelection& selection);
+
+private:
+    CdlodSelector() = delete;
+};
+
+} // namespace Terrain
+} // namespace Engine
@@ -0,0 +1,125 @@
+// engine/terrain/height_source.cpp
+#include "height_source.h"
+#include "./../core/log.h"
+#include "./../core/path_utils.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+namespace Engine {
+namespace Terrain {
+
+ProceduralHeightSource::ProceduralHeightSource(uint32_t seed, float heightScale)
+    : m_seed(seed), m_heightScale(heightScale) {
+}
+
+float ProceduralHeightSource::hash(int32_t x, int32_t z) const {
+    // Hash inteiro (mistura do tipo PCG) -> [0, 1)
+    uint32_t h = static_cast<uint32_t>(x) * 0x8da6b343u ^ static_cast<uint32_t>(z) * 0xd8163841u ^ m_seed * 0xcb1ab31fu;
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    h *= 0x846ca68bu;
+    h ^= h >> 16;
+    return static_cast<float>(h >> 8) * (1.0f / 16777216.0f);
+}
+
+float ProceduralHeightSource::valueNoise(float x, float z) const {
+    const float fx = std::floor(x);
+    const float fz = std::floor(z);
+    const int32_t ix = static_cast<int32_t>(fx);
+    const int32_t iz = static_cast<int32_t>(fz);
+    float tx = x - fx;
+    float tz = z - fz;
+    tx = tx * tx * (3.0f - 2.0f * tx); // Interpolação suave (sem degraus na derivada)
+    tz = tz * tz * (3.0f - 2.0f * tz);
+
+    const float a = hash(ix, iz);
+    const float b = hash(ix + 1, iz);
+    const float c = hash(ix, iz + 1);
+    const float d = hash(ix + 1, iz + 1);
+    return glm::mix(glm::mix(a, b, tx), glm::mix(c, d, tx), tz);
+}
+
+uint64_t ProceduralHeightSource::getCacheKey() const {
+    uint32_t scaleBits = 0;
+    std::memcpy(&scaleBits, &m_heightScale, sizeof(scaleBits));
+    return (static_cast<uint64_t>(m_seed) << 32) | scaleBits;
+}
+
+float ProceduralHeightSource::sample(float x, float z) const {
+    // 6 oitavas a partir de ~400 m de comprimento de onda; a soma fica em [0, 1]
+    float frequency = 1.0f / 400.0f;
+    float amplitude = 0.5f;
+    float sum = 0.0f;
+    float total = 0.0f;
+    for (int octave = 0; octave < 6; ++octave) {
+        sum += valueNoise(x * frequency, z * frequency) * amplitude;
+        total += amplitude;
+        frequency *= 2.0f;
+        amplitude *= 0.5f;
+    }
+    float normalized = sum / total;
+    // Curva para vales mais planos e picos mais marcados
+    return normalized * normalized * m_heightScale;
+}
+
+ImageHeightSource::ImageHeightSource(const std::string& filePath, const glm::vec2& worldMin, const glm::vec2& worldMax, float heightScale)
+    : m_worldMin(worldMin), m_worldSize(worldMax - worldMin), m_heightScale(heightScale) {
+    int channels = 0;
+    stbi_us* data = stbi_load_16(Engine::resolveEnginePath(filePath).string().c_str(), &m_width, &m_height, &channels, 1);
+    if (!data) {
+        throw std::runtime_error(std::format("ImageHeightSource: falha ao carregar '{}': {}", filePath, stbi_failure_reason()));
+    }
+    m_pixels.assign(data, data + static_cast<size_t>(m_width) * static_cast<size_t>(m_height));
+    stbi_image_free(data);
+
+    // FNV-1a sobre os pixels e a escala: outra imagem ou outro mapeamento invalidam os pacotes cozidos
+    uint64_t hash = 1469598103934665603ull;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+    for (uint16_t pixel : m_pixels) {
+        mix(pixel);
+    }
+    uint32_t scaleBits = 0;
+    std::memcpy(&scaleBits, &m_heightScale, sizeof(scaleBits));
+    mix(scaleBits);
+    mix(static_cast<uint64_t>(m_width) << 32 | static_cast<uint32_t>(m_height));
+    m_cacheKey = hash;
+    Engine::Log::Info(std::format("ImageHeightSource: '{}' carregado ({}x{}).", filePath, m_width, m_height));
+}
+
+uint64_t ImageHeightSource::getCacheKey() const {
+    return m_cacheKey;
+}
+
+float ImageHeightSource::texel(int x, int y) const {
+    x = std::clamp(x, 0, m_width - 1);
+    y = std::clamp(y, 0, m_height - 1);
+    return static_cast<float>(m_pixels[static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x)]) * (1.0f / 65535.0f);
+}
+
+float ImageHeightSource::sample(float x, float z) const {
+    // Bilinear, com o primeiro e o último pixel exatamente nas bordas do mundo
+    const float u = (x - m_worldMin.x) / m_worldSize.x * static_cast<float>(m_width - 1);
+    const float v = (z - m_worldMin.y) / m_worldSize.y * static_cast<float>(m_height - 1);
+    const float fu = std::floor(u);
+    const float fv = std::floor(v);
+    const int ix = static_cast<int>(fu);
+    const int iy = static_cast<int>(fv);
+    const float tx = u - fu;
+    const float ty = v - fv;
+    const float top = glm::mix(texel(ix, iy), texel(ix + 1, iy), tx);
+    const float bottom = glm::mix(texel(ix, iy + 1), texel(ix + 1, iy + 1), tx);
+    return glm::mix(top, bottom, ty) * m_heightScale;
+}
+
+} // namespace Terrain
+} // namespace Engine
@@ -0,0 +1,63 @@
+// engine/terrain/height_source.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Terrain {
+
+// Origem das alturas do terreno, consultada em coordenadas de mundo (x, z).
+// Os tiles amostram a mesma função nas bordas, então vizinhos gerados em separado casam sem costura.
+// sample() pode ser chamado de várias threads ao mesmo tempo.
+class HeightSource {
+public:
+    virtual ~HeightSource() = default;
+
+    virtual float sample(float x, float z) const = 0;
+    // Identifica a origem e os parâmetros (pacotes cozidos com outra chave são descartados)
+    virtual uint64_t getCacheKey() const = 0;
+};
+
+// Relevo procedural: fBm de value noise com semente fixa (determinístico entre execuções)
+class ProceduralHeightSource : public HeightSource {
+public:
+    ProceduralHeightSource(uint32_t seed, float heightScale);
+
+    float sample(float x, float z) const override;
+    uint64_t getCacheKey() const override;
+
+private:
+    float valueNoise(float x, float z) const;
+    float hash(int32_t x, int32_t z) const;
+
+    uint32_t m_seed;
+    float m_heightScale;
+};
+
+// Heightmap em imagem (PNG de 16 bits em tons de cinza) esticado sobre [worldMin, worldMax]
+class ImageHeightSource : public HeightSource {
+public:
+    // Lança std::runtime_error se a imagem não puder ser carregada
+    ImageHeightSource(const std::string& filePath, const glm::vec2& worldMin, const glm::vec2& worldMax, float heightScale);
+
+    float sample(float x, float z) const override;
+    uint64_t getCacheKey() const override;
+
+private:
+    float texel(int x, int y) const;
+
+    std::vector<uint16_t> m_pixels;
+    uint64_t m_cacheKey = 0;
+    int m_width = 0;
+    int m_height = 0;
+    glm::vec2 m_worldMin;
+    glm::vec2 m_worldSize;
+    float m_heightScale;
+};
+
+} // namespace Terrain
+} // namespace Engine
@@ -0,0 +1,344 @@
+// engine/terrain/terrain_system.cpp
+#include "terrain_system.h"
+#include "height_source.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+#include "./../core/profiler.h"
+#include "./../memory/memory_tracker.h"
+#include "./../render/command_list.h"
+#include "./../render/frustum.h"
+#include "./../render/material.h"
+#include "./../render/shader.h"
+
+#include <glad/gl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cmath>
+#include <format>
+
+namespace Engine {
+namespace Terrain {
+
+// Recursos GL do terreno; só tocados na thread dona do contexto
+struct TerrainGpuResources {
+    GLuint vao = 0;
+    GLuint gridBuffer = 0;
+    GLuint indexBuffer = 0;
+    GLuint instanceBuffer = 0;
+    GLuint heightTexture = 0;
+    GLsizei fullIndexCount = 0;
+    GLsizei halfIndexCount = 0;
+    GLint halfBaseVertex = 0;
+    size_t gpuBytes = 0; // Grade, índices e array de alturas (o buffer de instâncias é por frame)
+
+    ~TerrainGpuResources() {
+        Memory::MemoryTracker::untrack(Memory::MemoryTag::World, Memory::MemoryDomain::Gpu, gpuBytes);
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &gridBuffer);
+        glDeleteBuffers(1, &indexBuffer);
+        glDeleteBuffers(1, &instanceBuffer);
+        glDeleteTextures(1, &heightTexture);
+    }
+
+    void draw(const std::vector<TerrainChunkInstance>& instances, size_t fullCount) {
+        if (instances.empty()) {
+            return;
+        }
+        glNamedBufferData(instanceBuffer, static_cast<GLsizeiptr>(instances.size() * sizeof(TerrainChunkInstance)),
+                          instances.data(), GL_STREAM_DRAW);
+        glBindVertexArray(vao);
+        if (fullCount > 0) {
+            glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, fullIndexCount, GL_UNSIGNED_SHORT, nullptr,
+                                                          static_cast<GLsizei>(fullCount), 0, 0);
+        }
+        const size_t quadrantCount = instances.size() - fullCount;
+        if (quadrantCount > 0) {
+            const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(fullIndexCount) * sizeof(GLushort));
+            glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, halfIndexCount, GL_UNSIGNED_SHORT, offset,
+                                                          static_cast<GLsizei>(quadrantCount), halfBaseVertex,
+                                                          static_cast<GLuint>(fullCount));
+        }
+        glBindVertexArray(0);
+    }
+};
+
+namespace {
+
+    // Grade quads x quads em [0, 1]^2; acrescenta vértices e índices (relativos ao início desta grade)
+    void appendGrid(int quads, std::vector<glm::vec2>& vertices, std::vector<GLushort>& indices) {
+        const int side = quads + 1;
+        for (int z = 0; z < side; ++z) {
+            for (int x = 0; x < side; ++x) {
+                vertices.emplace_back(static_cast<float>(x) / static_cast<float>(quads), static_cast<float>(z) / static_cast<float>(quads));
+            }
+        }
+        for (int z = 0; z < quads; ++z) {
+            for (int x = 0; x < quads; ++x) {
+                const GLushort a = static_cast<GLushort>(z * side + x);
+                const GLushort b = static_cast<GLushort>(a + 1);
+                const GLushort c = static_cast<GLushort>(a + side);
+                const GLushort d = static_cast<GLushort>(c + 1);
+                indices.insert(indices.end(), {a, c, b, b, c, d});
+            }
+        }
+    }
+
+} // namespace
+
+TerrainSystem::TerrainSystem() = default;
+TerrainSystem::~TerrainSystem() = default;
+
+void TerrainSystem::initialize(size_t layerCapacity) {
+    const float tileSize = Engine::TERRAIN_TILE_SIZE;
+    const float leafSize = Engine::TERRAIN_LEAF_CHUNK_SIZE;
+    const int leavesPerSide = static_cast<int>(std::lround(tileSize / leafSize));
+    if (leavesPerSide <= 0 || (leavesPerSide & (leavesPerSide - 1)) != 0 || Engine::TERRAIN_CHUNK_GRID % 2 != 0) {
+        Engine::Log::Error(std::format("TerrainSystem: tile de {} m não é potência de 2 vezes a folha de {} m (ou grade ímpar). Terreno desativado.",
+                                       tileSize, leafSize));
+        return;
+    }
+
+    m_ranges.leafRange = Engine::TERRAIN_LEAF_LOD_RANGE;
+    m_ranges.morphStartRatio = Engine::TERRAIN_MORPH_START_RATIO;
+    m_ranges.lodCount = static_cast<int>(std::lround(std::log2(static_cast<float>(leavesPerSide)))) + 1;
+    if (m_ranges.leafRange < 2.0f * leafSize * 1.4142f) {
+        // O morph de uma LOD precisa terminar antes que o nó vizinho mais grosso comece o seu
+        Engine::Log::Warn(std::format("TerrainSystem: TERRAIN_LEAF_LOD_RANGE ({} m) menor que 2x a diagonal da folha; podem surgir rachaduras.",
+                                      m_ranges.leafRange));
+    }
+
+    m_tilesX = Engine::TERRAIN_TILES_X;
+    m_tilesZ = Engine::TERRAIN_TILES_Z;
+    m_firstTile = {-m_tilesX / 2, -m_tilesZ / 2};
+    const glm::vec2 worldMin(static_cast<float>(m_firstTile.x) * tileSize, static_cast<float>(m_firstTile.z) * tileSize);
+    const glm::vec2 worldMax = worldMin + glm::vec2(static_cast<float>(m_tilesX), static_cast<float>(m_tilesZ)) * tileSize;
+    m_worldMin = glm::vec3(worldMin.x, 0.0f, worldMin.y);
+    m_worldMax = glm::vec3(worldMax.x, Engine::TERRAIN_HEIGHT_SCALE, worldMax.y);
+
+    const std::string heightmapPath = Engine::TERRAIN_HEIGHTMAP_PATH;
+    if (!heightmapPath.empty()) {
+        try {
+            m_source = std::make_unique<ImageHeightSource>(heightmapPath, worldMin, worldMax, Engine::TERRAIN_HEIGHT_SCALE);
+        } catch (const std::exception& e) {
+            Engine::Log::Error(std::format("TerrainSystem: {} Usando relevo procedural.", e.what()));
+        }
+    }
+    if (!m_source) {
+        m_source = std::make_unique<ProceduralHeightSource>(Engine::TERRAIN_SEED, Engine::TERRAIN_HEIGHT_SCALE);
+    }
+
+    // Malhas compartilhadas: grade inteira (nós) e meia grade (quadrantes), no mesmo buffer
+    std::vector<glm::vec2> gridVertices;
+    std::vector<GLushort> gridIndices;
+    appendGrid(Engine::TERRAIN_CHUNK_GRID, gridVertices, gridIndices);
+    const GLsizei fullIndexCount = static_cast<GLsizei>(gridIndices.size());
+    const GLint halfBaseVertex = static_cast<GLint>(gridVertices.size());
+    appendGrid(Engine::TERRAIN_CHUNK_GRID / 2, gridVertices, gridIndices);
+
+    auto gpu = std::make_shared<TerrainGpuResources>();
+    gpu->fullIndexCount = fullIndexCount;
+    gpu->halfIndexCount = static_cast<GLsizei>(gridIndices.size()) - fullIndexCount;
+    gpu->halfBaseVertex = halfBaseVertex;
+
+    glCreateBuffers(1, &gpu->gridBuffer);
+    glNamedBufferStorage(gpu->gridBuffer, static_cast<GLsizeiptr>(gridVertices.size() * sizeof(glm::vec2)), gridVertices.data(), 0);
+    glCreateBuffers(1, &gpu->indexBuffer);
+    glNamedBufferStorage(gpu->indexBuffer, static_cast<GLsizeiptr>(gridIndices.size() * sizeof(GLushort)), gridIndices.data(), 0);
+    glCreateBuffers(1, &gpu->instanceBuffer);
+
+    // Atributos: 0 = posição na grade; 1 = origem e lado do pedaço; 2 = LOD e camada (inteiros), por instância
+    glCreateVertexArrays(1, &gpu->vao);
+    glVertexArrayVertexBuffer(gpu->vao, 0, gpu->gridBuffer, 0, sizeof(glm::vec2));
+    glVertexArrayVertexBuffer(gpu->vao, 1, gpu->instanceBuffer, 0, sizeof(TerrainChunkInstance));
+    glVertexArrayBindingDivisor(gpu->vao, 1, 1);
+    glVertexArrayElementBuffer(gpu->vao, gpu->indexBuffer);
+
+    glEnableVertexArrayAttrib(gpu->vao, 0);
+    glVertexArrayAttribFormat(gpu->vao, 0, 2, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(gpu->vao, 0, 0);
+    glEnableVertexArrayAttrib(gpu->vao, 1);
+    glVertexArrayAttribFormat(gpu->vao, 1, 3, GL_FLOAT, GL_FALSE, offsetof(TerrainChunkInstance, origin));
+    glVertexArrayAttribBinding(gpu->vao, 1, 1);
+    glEnableVertexArrayAttrib(gpu->vao, 2);
+    glVertexArrayAttribIFormat(gpu->vao, 2, 2, GL_UNSIGNED_SHORT, offsetof(TerrainChunkInstance, lod));
+    glVertexArrayAttribBinding(gpu->vao, 2, 1);
+
+    // Alturas em metros (R32F): camadas fixas reaproveitadas pelos tiles que entram e saem
+    GLint maxLayers = 0;
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+    m_layerCapacity = std::min(std::max<size_t>(layerCapacity, 1), static_cast<size_t>(std::max(maxLayers, 1)));
+    const GLsizei resolution = static_cast<GLsizei>(Engine::TERRAIN_TILE_RESOLUTION);
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &gpu->heightTexture);
+    glTextureStorage3D(gpu->heightTexture, 1, GL_R32F, resolution, resolution, static_cast<GLsizei>(m_layerCapacity));
+    glTextureParameteri(gpu->heightTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(gpu->heightTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(gpu->heightTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(gpu->heightTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    gpu->gpuBytes = gridVertices.size() * sizeof(glm::vec2) + gridIndices.size() * sizeof(GLushort) +
+                    static_cast<size_t>(resolution) * static_cast<size_t>(resolution) * m_layerCapacity * sizeof(float);
+    Memory::MemoryTracker::track(Memory::MemoryTag::World, Memory::MemoryDomain::Gpu, gpu->gpuBytes);
+    m_gpu = gpu;
+
+    // Camadas livres em ordem decrescente: pop_back entrega a menor primeiro
+    m_freeLayers.clear();
+    for (size_t layer = m_layerCapacity; layer > 0; --layer) {
+        m_freeLayers.push_back(static_cast<int>(layer - 1));
+    }
+
+    m_material = std::make_shared<Render::Material>();
+    m_material->baseColorFactor = glm::vec4(0.32f, 0.40f, 0.22f, 1.0f);
+    m_material->roughnessFactor = 0.95f;
+
+    Engine::Log::Info(std::format("TerrainSystem: mundo de {}x{} tiles de {} m ({} LODs, alcance máximo {:.0f} m), {} camadas de heightmap ({:.1f} MB na GPU).",
+                                  m_tilesX, m_tilesZ, tileSize, m_ranges.lodCount, m_ranges.range(m_ranges.lodCount - 1), m_layerCapacity,
+                                  static_cast<double>(m_layerCapacity) * resolution * resolution * 4.0 / (1024.0 * 1024.0)));
+}
+
+void TerrainSystem::loadAllTiles() {
+    if (!isReady()) {
+        return;
+    }
+    auto generateStart = std::chrono::steady_clock::now();
+    for (int z = 0; z < m_tilesZ; ++z) {
+        for (int x = 0; x < m_tilesX; ++x) {
+            if (!addTile(createTile(TileCoord{m_firstTile.x + x, m_firstTile.z + z}, true))) {
+                Engine::Log::Error(std::format("TerrainSystem: sem camadas de heightmap para todos os tiles ({} de {}).",
+                                               m_tiles.size(), m_tilesX * m_tilesZ));
+                return;
+            }
+        }
+    }
+    const double generateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - generateStart).count();
+    Engine::Log::Info(std::format("TerrainSystem: {} tiles gerados em {:.1f} ms.", m_tiles.size(), generateMs));
+}
+
+std::shared_ptr<TerrainTile> TerrainSystem::createTile(TileCoord coord, bool parallel) const {
+    return createTile(coord, TerrainTile::sampleHeights(*m_source, coord, Engine::TERRAIN_TILE_SIZE, Engine::TERRAIN_TILE_RESOLUTION, parallel));
+}
+
+std::shared_ptr<TerrainTile> TerrainSystem::createTile(TileCoord coord, std::vector<float>&& heights) const {
+    return std::make_shared<TerrainTile>(coord, Engine::TERRAIN_TILE_SIZE, Engine::TERRAIN_TILE_RESOLUTION,
+                                         Engine::TERRAIN_LEAF_CHUNK_SIZE, m_ranges.lodCount, std::move(heights));
+}
+
+bool TerrainSystem::addTile(std::shared_ptr<TerrainTile> tile) {
+    if (!tile || !isReady() || m_freeLayers.empty() || hasTile(tile->getCoord())) {
+        return false;
+    }
+    tile->setLayer(m_freeLayers.back());
+    m_freeLayers.pop_back();
+    m_pendingUploads.push_back(tile);
+    m_tiles.emplace(tileKey(tile->getCoord()), std::move(tile));
+    return true;
+}
+
+void TerrainSystem::removeTile(TileCoord coord) {
+    auto it = m_tiles.find(tileKey(coord));
+    if (it == m_tiles.end()) {
+        return;
+    }
+    // A camada só é reescrita por um upload gravado depois deste frame, quando nenhum desenho a referencia mais
+    m_freeLayers.push_back(it->second->getLayer());
+    m_pendingUploads.erase(std::remove(m_pendingUploads.begin(), m_pendingUploads.end(), it->second), m_pendingUploads.end());
+    m_tiles.erase(it);
+}
+
+std::shared_ptr<const TerrainTile> TerrainSystem::getTile(TileCoord coord) const {
+    auto it = m_tiles.find(tileKey(coord));
+    return it != m_tiles.end() ? it->second : nullptr;
+}
+
+bool TerrainSystem::isInsideWorld(TileCoord coord) const {
+    return coord.x >= m_firstTile.x && coord.z >= m_firstTile.z && coord.x < m_firstTile.x + m_tilesX && coord.z < m_firstTile.z + m_tilesZ;
+}
+
+TileCoord TerrainSystem::tileAt(float x, float z) const {
+    return TileCoord{static_cast<int32_t>(std::floor(x / Engine::TERRAIN_TILE_SIZE)),
+                     static_cast<int32_t>(std::floor(z / Engine::TERRAIN_TILE_SIZE))};
+}
+
+size_t TerrainSystem::getTileBytes() {
+    const size_t samples = static_cast<size_t>(Engine::TERRAIN_TILE_RESOLUTION) * static_cast<size_t>(Engine::TERRAIN_TILE_RESOLUTION);
+    const size_t leaves = static_cast<size_t>(std::lround(Engine::TERRAIN_TILE_SIZE / Engine::TERRAIN_LEAF_CHUNK_SIZE));
+    const size_t minMaxNodes = leaves * leaves * 4 / 3 + 1; // Soma dos níveis da quadtree
+    return samples * sizeof(float) * 2 + minMaxNodes * sizeof(glm::vec2);
+}
+
+const TerrainTile* TerrainSystem::findTile(float x, float z) const {
+    auto it = m_tiles.find(tileKey(tileAt(x, z)));
+    return it != m_tiles.end() ? it->second.get() : nullptr;
+}
+
+bool TerrainSystem::tryGetHeight(float x, float z, float& height) const {
+    const TerrainTile* tile = findTile(x, z);
+    if (!tile) {
+        return false;
+    }
+    height = tile->getHeight(x, z);
+    return true;
+}
+
+float TerrainSystem::getHeight(float x, float z) const {
+    float height = 0.0f;
+    tryGetHeight(x, z, height);
+    return height;
+}
+
+void TerrainSystem::select(const Render::Frustum& frustum, const glm::vec3& cameraPosition) {
+    auto selectStart = std::chrono::steady_clock::now();
+    m_selection.clear();
+    if (isReady()) {
+        for (const auto& [key, tile] : m_tiles) {
+            CdlodSelector::select(*tile, frustum, cameraPosition, m_ranges, Engine::TERRAIN_LEAF_CHUNK_SIZE, m_selection);
+        }
+    }
+    m_instances.assign(m_selection.fullChunks.begin(), m_selection.fullChunks.end());
+    m_instances.insert(m_instances.end(), m_selection.quadrantChunks.begin(), m_selection.quadrantChunks.end());
+    m_lastSelectMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - selectStart).count();
+}
+
+void TerrainSystem::record(Render::CommandList& commands, const Render::Shader* shader, const glm::vec3& cameraPosition) {
+    if (!isReady() || !shader) {
+        return;
+    }
+
+    if (!m_pendingUploads.empty()) {
+        // Uma camada por tile novo (o tile vive até o upload, mesmo se sair antes da reprodução)
+        commands.upload([gpu = m_gpu, tiles = std::move(m_pendingUploads)]() {
+            ENGINE_PROFILE_SCOPE("TerrainSystem::uploadTiles");
+            for (const auto& tile : tiles) {
+                const GLsizei resolution = static_cast<GLsizei>(tile->getResolution());
+                glTextureSubImage3D(gpu->heightTexture, 0, 0, 0, tile->getLayer(), resolution, resolution, 1, GL_RED, GL_FLOAT,
+                                    tile->getHeights().data());
+            }
+        });
+        m_pendingUploads.clear();
+    }
+    if (m_instances.empty()) {
+        return;
+    }
+
+    commands.setUniform("uTerrainHeightmaps", Engine::TERRAIN_HEIGHTMAP_TEXTURE_UNIT);
+    commands.setUniform("uTerrainParams", glm::vec4(Engine::TERRAIN_TILE_SIZE, static_cast<float>(Engine::TERRAIN_TILE_RESOLUTION),
+                                                    Engine::TERRAIN_LEAF_CHUNK_SIZE, static_cast<float>(Engine::TERRAIN_CHUNK_GRID)));
+    commands.setUniform("uTerrainLod", glm::vec4(m_ranges.leafRange, m_ranges.morphStartRatio, Engine::TERRAIN_TEXCOORD_SCALE, 0.0f));
+    commands.setUniform("uTerrainCamera", cameraPosition);
+    commands.setUniform("uLodFade", 1.0f);
+
+    // A lista pode ser reproduzida enquanto o próximo frame seleciona: o desenho leva uma cópia das instâncias
+    commands.upload([gpu = m_gpu, material = m_material, shader, instances = m_instances, fullCount = m_selection.fullChunks.size()]() {
+        material->activate(*shader);
+        glBindTextureUnit(static_cast<GLuint>(Engine::TERRAIN_HEIGHTMAP_TEXTURE_UNIT), gpu->heightTexture);
+        gpu->draw(instances, fullCount);
+    });
+}
+
+uint64_t TerrainSystem::getSelectedTriangles() const {
+    const uint64_t fullTriangles = 2ull * static_cast<uint64_t>(Engine::TERRAIN_CHUNK_GRID) * static_cast<uint64_t>(Engine::TERRAIN_CHUNK_GRID);
+    return m_selection.fullChunks.size() * fullTriangles + m_selection.quadrantChunks.size() * (fullTriangles / 4);
+}
+
+} // namespace Terrain
+} // namespace Engine
@@ -0,0 +1,109 @@
+// engine/terrain/terrain_system.h
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "cdlod_selector.h"
+#include "terrain_tile.h"
+
+namespace Engine {
+namespace Render {
+    class CommandList;
+    class Frustum;
+    class Material;
+    class Shader;
+}
+namespace Terrain {
+
+class HeightSource;
+struct TerrainGpuResources;
+
+// Terreno em tiles de heightmap com LOD contínuo (CDLOD).
+// Todos os pedaços desenham a mesma malha de grade (inteira ou meia, para quadrantes), instanciada;
+// a altura vem de um array de texturas (uma camada por tile residente) amostrado em terrain.vert,
+// que também faz o morph entre LODs pela distância da câmera. Por frame: seleção na quadtree (CPU,
+// sem GL) e no máximo dois draw calls instanciados, independentemente do tamanho do mundo.
+// Os tiles entram e saem em tempo de execução (World::WorldStreamer) ou todos de uma vez (loadAllTiles).
+class TerrainSystem {
+public:
+    TerrainSystem();
+    ~TerrainSystem();
+
+    // Cria a origem das alturas e os recursos GL, com 'layerCapacity' camadas de heightmap
+    // (máximo de tiles residentes). Chamar com o contexto GL atual. Não carrega tiles.
+    void initialize(size_t layerCapacity);
+    bool isReady() const { return m_gpu != nullptr; }
+
+    // Carrega todos os tiles do mundo de forma síncrona (sem streaming; a capacidade deve bastar)
+    void loadAllTiles();
+
+    // Gera um tile a partir da origem das alturas. Seguro fora da thread principal com parallel = false.
+    std::shared_ptr<TerrainTile> createTile(TileCoord coord, bool parallel) const;
+    std::shared_ptr<TerrainTile> createTile(TileCoord coord, std::vector<float>&& heights) const;
+    // Torna o tile residente: reserva uma camada e agenda o upload para o próximo record(). false sem camada livre.
+    bool addTile(std::shared_ptr<TerrainTile> tile);
+    void removeTile(TileCoord coord);
+    bool hasTile(TileCoord coord) const { return m_tiles.count(tileKey(coord)) > 0; }
+    // Tile residente em 'coord' (nulo se não houver); as alturas podem ser lidas de outras threads
+    std::shared_ptr<const TerrainTile> getTile(TileCoord coord) const;
+    size_t getTileCount() const { return m_tiles.size(); }
+    size_t getLayerCapacity() const { return m_layerCapacity; }
+
+    // Grade de tiles do mundo (config.h: TERRAIN_TILES_*, centrada na origem)
+    bool isInsideWorld(TileCoord coord) const;
+    TileCoord tileAt(float x, float z) const;
+    const HeightSource& getHeightSource() const { return *m_source; }
+    // Bytes de um tile residente: alturas em CPU + árvore de min/max + camada na GPU
+    static size_t getTileBytes();
+
+    // Altura do chão em (x, z); false se o tile não estiver residente
+    bool tryGetHeight(float x, float z, float& height) const;
+    float getHeight(float x, float z) const;
+    // Caixa envolvente do mundo (altura: faixa possível da origem das alturas)
+    glm::vec3 getWorldMin() const { return m_worldMin; }
+    glm::vec3 getWorldMax() const { return m_worldMax; }
+
+    // Seleção dos pedaços do frame (thread principal, sem OpenGL)
+    void select(const Render::Frustum& frustum, const glm::vec3& cameraPosition);
+    // Grava os uploads de tiles novos, o upload das instâncias e os desenhos;
+    // 'shader' (terrain.vert + basic/gbuffer.frag) já deve estar ligado
+    void record(Render::CommandList& commands, const Render::Shader* shader, const glm::vec3& cameraPosition);
+
+    const CdlodSelection& getSelection() const { return m_selection; }
+    uint64_t getSelectedTriangles() const;
+    double getLastSelectMs() const { return m_lastSelectMs; }
+
+private:
+    static uint64_t tileKey(TileCoord coord) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(coord.z)) << 32) | static_cast<uint32_t>(coord.x);
+    }
+    const TerrainTile* findTile(float x, float z) const;
+
+    std::unique_ptr<HeightSource> m_source;
+    std::map<uint64_t, std::shared_ptr<TerrainTile>> m_tiles; // Ordem estável (linha a linha) para a seleção
+    TileCoord m_firstTile;
+    int m_tilesX = 0;
+    int m_tilesZ = 0;
+    CdlodRanges m_ranges;
+    glm::vec3 m_worldMin{0.0f};
+    glm::vec3 m_worldMax{0.0f};
+
+    size_t m_layerCapacity = 0;
+    std::vector<int> m_freeLayers;
+    std::vector<std::shared_ptr<TerrainTile>> m_pendingUploads; // Tiles novos sem camada preenchida na GPU
+
+    std::shared_ptr<TerrainGpuResources> m_gpu;    // Compartilhado com os comandos gravados
+    std::shared_ptr<Render::Material> m_material;
+
+    CdlodSelection m_selection;
+    std::vector<TerrainChunkInstance> m_instances; // Inteiros seguidos dos quadrantes
+    double m_lastSelectMs = 0.0;
+};
+
+} // namespace Terrain
+} // namespace Engine
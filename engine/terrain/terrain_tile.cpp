@@ -0,0 +1,112 @@
+// engine/terrain/terrain_tile.cpp
+#include "terrain_tile.h"
+#include "height_source.h"
+#include "./../core/worker_pool.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+namespace Terrain {
+
+std::vector<float> TerrainTile::sampleHeights(const HeightSource& source, TileCoord coord, float size, int resolution, bool parallel) {
+    const size_t side = static_cast<size_t>(resolution);
+    std::vector<float> heights(side * side);
+
+    const glm::vec2 origin(static_cast<float>(coord.x) * size, static_cast<float>(coord.z) * size);
+    const float step = size / static_cast<float>(resolution - 1);
+    auto sampleRows = [&](size_t, size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            const float z = origin.y + static_cast<float>(row) * step;
+            for (size_t column = 0; column < side; ++column) {
+                heights[row * side + column] = source.sample(origin.x + static_cast<float>(column) * step, z);
+            }
+        }
+    };
+    if (parallel) {
+        Engine::WorkerPool::Get().parallelFor(side, 16, sampleRows);
+    } else {
+        sampleRows(0, 0, side);
+    }
+    return heights;
+}
+
+TerrainTile::TerrainTile(TileCoord coord, float size, int resolution, float leafSize, int lodCount, std::vector<float>&& heights)
+    : m_coord(coord),
+      m_origin(static_cast<float>(coord.x) * size, static_cast<float>(coord.z) * size),
+      m_size(size),
+      m_resolution(resolution),
+      m_leafSize(leafSize),
+      m_nodesPerSide(static_cast<int>(std::lround(size / leafSize))),
+      m_heights(std::move(heights)) {
+    buildMinMaxTree(lodCount);
+}
+
+void TerrainTile::buildMinMaxTree(int lodCount) {
+    m_minMax.resize(static_cast<size_t>(lodCount));
+
+    // Folhas: todas as amostras cobertas pelo nó, bordas incluídas (a malha interpola entre elas)
+    const int leaves = m_nodesPerSide;
+    const float samplesPerLeaf = static_cast<float>(m_resolution - 1) / static_cast<float>(leaves);
+    std::vector<glm::vec2>& leafLevel = m_minMax[0];
+    leafLevel.assign(static_cast<size_t>(leaves) * static_cast<size_t>(leaves), glm::vec2(0.0f));
+    for (int nz = 0; nz < leaves; ++nz) {
+        const int z0 = static_cast<int>(std::floor(static_cast<float>(nz) * samplesPerLeaf));
+        const int z1 = std::min(m_resolution - 1, static_cast<int>(std::ceil(static_cast<float>(nz + 1) * samplesPerLeaf)));
+        for (int nx = 0; nx < leaves; ++nx) {
+            const int x0 = static_cast<int>(std::floor(static_cast<float>(nx) * samplesPerLeaf));
+            const int x1 = std::min(m_resolution - 1, static_cast<int>(std::ceil(static_cast<float>(nx + 1) * samplesPerLeaf)));
+            glm::vec2 range(m_heights[static_cast<size_t>(z0 * m_resolution + x0)]);
+            for (int z = z0; z <= z1; ++z) {
+                for (int x = x0; x <= x1; ++x) {
+                    const float h = m_heights[static_cast<size_t>(z * m_resolution + x)];
+                    range.x = std::min(range.x, h);
+                    range.y = std::max(range.y, h);
+                }
+            }
+            leafLevel[static_cast<size_t>(nz * leaves + nx)] = range;
+        }
+    }
+
+    // Níveis acima: união dos 4 filhos
+    for (int lod = 1; lod < lodCount; ++lod) {
+        const int parentSide = getNodesPerSide(lod);
+        const int childSide = getNodesPerSide(lod - 1);
+        const std::vector<glm::vec2>& children = m_minMax[static_cast<size_t>(lod - 1)];
+        std::vector<glm::vec2>& level = m_minMax[static_cast<size_t>(lod)];
+        level.resize(static_cast<size_t>(parentSide) * static_cast<size_t>(parentSide));
+        for (int nz = 0; nz < parentSide; ++nz) {
+            for (int nx = 0; nx < parentSide; ++nx) {
+                glm::vec2 range = children[static_cast<size_t>((nz * 2) * childSide + nx * 2)];
+                for (int child = 1; child < 4; ++child) {
+                    const glm::vec2& c = children[static_cast<size_t>((nz * 2 + child / 2) * childSide + nx * 2 + child % 2)];
+                    range.x = std::min(range.x, c.x);
+                    range.y = std::max(range.y, c.y);
+                }
+                level[static_cast<size_t>(nz * parentSide + nx)] = range;
+            }
+        }
+    }
+}
+
+glm::vec2 TerrainTile::getNodeMinMax(int lod, int nx, int nz) const {
+    const std::vector<glm::vec2>& level = m_minMax[static_cast<size_t>(lod)];
+    return level[static_cast<size_t>(nz * getNodesPerSide(lod) + nx)];
+}
+
+float TerrainTile::getHeight(float x, float z) const {
+    const float scale = static_cast<float>(m_resolution - 1) / m_size;
+    const float u = std::clamp((x - m_origin.x) * scale, 0.0f, static_cast<float>(m_resolution - 1));
+    const float v = std::clamp((z - m_origin.y) * scale, 0.0f, static_cast<float>(m_resolution - 1));
+    const int x0 = std::min(static_cast<int>(u), m_resolution - 2);
+    const int z0 = std::min(static_cast<int>(v), m_resolution - 2);
+    const float tx = u - static_cast<float>(x0);
+    const float tz = v - static_cast<float>(z0);
+    auto at = [&](int px, int pz) { return m_heights[static_cast<size_t>(pz * m_resolution + px)]; };
+    const float top = glm::mix(at(x0, z0), at(x0 + 1, z0), tx);
+    const float bottom = glm::mix(at(x0, z0 + 1), at(x0 + 1, z0 + 1), tx);
+    return glm::mix(top, bottom, tz);
+}
+
+} // namespace Terrain
+} // namespace Engine
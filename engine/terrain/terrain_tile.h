@@ -0,0 +1,67 @@
+// engine/terrain/terrain_tile.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Terrain {
+
+class HeightSource;
+
+// Coordenada inteira de um tile na grade do mundo (tile (0,0) começa na origem)
+struct TileCoord {
+    int32_t x = 0;
+    int32_t z = 0;
+
+    bool operator==(const TileCoord& other) const { return x == other.x && z == other.z; }
+};
+
+// Um tile quadrado de heightmap com a sua quadtree de alturas mínima/máxima.
+// As alturas ficam em CPU (consultas de chão, seleção de LOD); a cópia na GPU é uma camada
+// do array de texturas do TerrainSystem ('layer').
+class TerrainTile {
+public:
+    // Amostra 'source' nos resolution x resolution pontos do tile (as bordas coincidem com as dos vizinhos).
+    // 'parallel' divide as linhas no WorkerPool; threads de streaming amostram em série para não
+    // disputar o pool com o frame.
+    static std::vector<float> sampleHeights(const HeightSource& source, TileCoord coord, float size, int resolution, bool parallel);
+
+    // Tile com alturas já amostradas (ou lidas de um pacote cozido); monta a árvore de min/max com 'lodCount' níveis
+    TerrainTile(TileCoord coord, float size, int resolution, float leafSize, int lodCount, std::vector<float>&& heights);
+
+    TileCoord getCoord() const { return m_coord; }
+    const glm::vec2& getOrigin() const { return m_origin; } // Canto mínimo (x, z) em metros
+    float getSize() const { return m_size; }
+    int getResolution() const { return m_resolution; }
+    const std::vector<float>& getHeights() const { return m_heights; }
+
+    // Altura bilinear em coordenadas de mundo (pontos fora do tile são presos à borda)
+    float getHeight(float x, float z) const;
+
+    // Faixa de alturas do nó (lod, nx, nz): lod 0 = folha; nx, nz contam a partir do canto mínimo
+    glm::vec2 getNodeMinMax(int lod, int nx, int nz) const;
+    int getNodesPerSide(int lod) const { return m_nodesPerSide >> lod; }
+    glm::vec2 getMinMax() const { return getNodeMinMax(static_cast<int>(m_minMax.size()) - 1, 0, 0); }
+
+    int getLayer() const { return m_layer; }
+    void setLayer(int layer) { m_layer = layer; }
+
+private:
+    void buildMinMaxTree(int lodCount);
+
+    TileCoord m_coord;
+    glm::vec2 m_origin;
+    float m_size;
+    int m_resolution;
+    float m_leafSize;
+    int m_nodesPerSide; // Folhas por lado
+    std::vector<float> m_heights;
+    std::vector<std::vector<glm::vec2>> m_minMax; // Por LOD: (min, max) de cada nó, linha a linha
+    int m_layer = -1;
+};
+
+} // namespace Terrain
+} // namespace Engine
@@ -0,0 +1,96 @@
+// engine/vegetation/density_map.cpp
+#include "density_map.h"
+#include "./../core/log.h"
+#include "./../core/path_utils.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+namespace Engine {
+namespace Vegetation {
+
+ProceduralDensityMap::ProceduralDensityMap(uint32_t seed) : m_seed(seed) {
+}
+
+float ProceduralDensityMap::hash(int32_t x, int32_t z, uint32_t salt) const {
+    // Mesmo hash inteiro de Terrain::ProceduralHeightSource, com um sal por tipo
+    uint32_t h = static_cast<uint32_t>(x) * 0x8da6b343u ^ static_cast<uint32_t>(z) * 0xd8163841u ^ (m_seed + salt) * 0xcb1ab31fu;
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    h *= 0x846ca68bu;
+    h ^= h >> 16;
+    return static_cast<float>(h >> 8) * (1.0f / 16777216.0f);
+}
+
+float ProceduralDensityMap::valueNoise(float x, float z, uint32_t salt) const {
+    const float fx = std::floor(x);
+    const float fz = std::floor(z);
+    const int32_t ix = static_cast<int32_t>(fx);
+    const int32_t iz = static_cast<int32_t>(fz);
+    float tx = x - fx;
+    float tz = z - fz;
+    tx = tx * tx * (3.0f - 2.0f * tx);
+    tz = tz * tz * (3.0f - 2.0f * tz);
+
+    const float a = hash(ix, iz, salt);
+    const float b = hash(ix + 1, iz, salt);
+    const float c = hash(ix, iz + 1, salt);
+    const float d = hash(ix + 1, iz + 1, salt);
+    return glm::mix(glm::mix(a, b, tx), glm::mix(c, d, tx), tz);
+}
+
+float ProceduralDensityMap::sample(VegetationKind kind, float x, float z) const {
+    // Comprimento de onda das manchas e quanto do chão fica vazio (limiar do ruído)
+    static constexpr float kWavelength[kVegetationKindCount] = {60.0f, 35.0f, 90.0f};
+    static constexpr float kThreshold[kVegetationKindCount] = {0.15f, 0.45f, 0.4f};
+
+    const size_t index = static_cast<size_t>(kind);
+    const float frequency = 1.0f / kWavelength[index];
+    const uint32_t salt = static_cast<uint32_t>(index + 1) * 0x9e3779b9u;
+    // Duas oitavas: bordas das manchas menos regulares
+    const float noise = valueNoise(x * frequency, z * frequency, salt) * 0.7f + valueNoise(x * frequency * 4.0f, z * frequency * 4.0f, salt) * 0.3f;
+    return std::clamp((noise - kThreshold[index]) / (1.0f - kThreshold[index]), 0.0f, 1.0f);
+}
+
+ImageDensityMap::ImageDensityMap(const std::string& filePath, const glm::vec2& worldMin, const glm::vec2& worldMax)
+    : m_worldMin(worldMin), m_worldSize(worldMax - worldMin) {
+    int channels = 0;
+    stbi_uc* data = stbi_load(Engine::resolveEnginePath(filePath).string().c_str(), &m_width, &m_height, &channels, 3);
+    if (!data) {
+        throw std::runtime_error(std::format("ImageDensityMap: falha ao carregar '{}': {}", filePath, stbi_failure_reason()));
+    }
+    m_pixels.assign(data, data + static_cast<size_t>(m_width) * static_cast<size_t>(m_height) * 3);
+    stbi_image_free(data);
+    Engine::Log::Info(std::format("ImageDensityMap: '{}' carregado ({}x{}).", filePath, m_width, m_height));
+}
+
+float ImageDensityMap::texel(int x, int y, int channel) const {
+    x = std::clamp(x, 0, m_width - 1);
+    y = std::clamp(y, 0, m_height - 1);
+    const size_t index = (static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x)) * 3 + static_cast<size_t>(channel);
+    return static_cast<float>(m_pixels[index]) * (1.0f / 255.0f);
+}
+
+float ImageDensityMap::sample(VegetationKind kind, float x, float z) const {
+    // Bilinear, como Terrain::ImageHeightSource
+    const int channel = static_cast<int>(kind);
+    const float u = (x - m_worldMin.x) / m_worldSize.x * static_cast<float>(m_width - 1);
+    const float v = (z - m_worldMin.y) / m_worldSize.y * static_cast<float>(m_height - 1);
+    const float fu = std::floor(u);
+    const float fv = std::floor(v);
+    const int ix = static_cast<int>(fu);
+    const int iy = static_cast<int>(fv);
+    const float tx = u - fu;
+    const float ty = v - fv;
+    const float top = glm::mix(texel(ix, iy, channel), texel(ix + 1, iy, channel), tx);
+    const float bottom = glm::mix(texel(ix, iy + 1, channel), texel(ix + 1, iy + 1, channel), tx);
+    return glm::mix(top, bottom, ty);
+}
+
+} // namespace Vegetation
+} // namespace Engine
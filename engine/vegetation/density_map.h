@@ -0,0 +1,63 @@
+// engine/vegetation/density_map.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Engine {
+namespace Vegetation {
+
+// Tipos de vegetação espalhados sobre o terreno (um canal do mapa de densidade e uma malha cada)
+enum class VegetationKind : uint8_t {
+    Grass = 0,
+    Bush,
+    Rock,
+};
+constexpr size_t kVegetationKindCount = 3;
+
+// Densidade relativa (0..1) de cada tipo em coordenadas de mundo (x, z), antes dos filtros de
+// inclinação e altura do terreno. sample() pode ser chamado de várias threads ao mesmo tempo.
+class DensityMap {
+public:
+    virtual ~DensityMap() = default;
+
+    virtual float sample(VegetationKind kind, float x, float z) const = 0;
+};
+
+// Manchas de value noise com semente fixa, uma frequência por tipo (gramados largos, moitas e pedras esparsas)
+class ProceduralDensityMap : public DensityMap {
+public:
+    explicit ProceduralDensityMap(uint32_t seed);
+
+    float sample(VegetationKind kind, float x, float z) const override;
+
+private:
+    float valueNoise(float x, float z, uint32_t salt) const;
+    float hash(int32_t x, int32_t z, uint32_t salt) const;
+
+    uint32_t m_seed;
+};
+
+// Imagem RGB esticada sobre [worldMin, worldMax]: R = grama, G = arbustos, B = pedras
+class ImageDensityMap : public DensityMap {
+public:
+    // Lança std::runtime_error se a imagem não puder ser carregada
+    ImageDensityMap(const std::string& filePath, const glm::vec2& worldMin, const glm::vec2& worldMax);
+
+    float sample(VegetationKind kind, float x, float z) const override;
+
+private:
+    float texel(int x, int y, int channel) const;
+
+    std::vector<uint8_t> m_pixels; // RGB
+    int m_width = 0;
+    int m_height = 0;
+    glm::vec2 m_worldMin;
+    glm::vec2 m_worldSize;
+};
+
+} // namespace Vegetation
+} // namespace Engine
@@ -0,0 +1,166 @@
+// engine/vegetation/scatter.cpp
+#include "scatter.h"
+#include "./../core/config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Engine {
+namespace Vegetation {
+
+namespace {
+
+    constexpr float kTwoPi = 6.28318530718f;
+
+    uint32_t mixHash(uint32_t h) {
+        h ^= h >> 16;
+        h *= 0x7feb352du;
+        h ^= h >> 15;
+        h *= 0x846ca68bu;
+        h ^= h >> 16;
+        return h;
+    }
+
+    // Semente de um candidato: combina tudo o que o identifica no mundo
+    uint32_t candidateSeed(uint32_t seed, Terrain::TileCoord coord, uint32_t kind, uint32_t i, uint32_t j) {
+        uint32_t h = mixHash(seed ^ 0x9e3779b9u);
+        h = mixHash(h ^ static_cast<uint32_t>(coord.x) * 0x8da6b343u);
+        h = mixHash(h ^ static_cast<uint32_t>(coord.z) * 0xd8163841u);
+        h = mixHash(h ^ kind * 0xcb1ab31fu);
+        h = mixHash(h ^ i * 0x165667b1u);
+        return mixHash(h ^ j * 0x27d4eb2fu);
+    }
+
+    // xorshift32: poucos números por candidato, sem estado compartilhado entre threads
+    struct Random {
+        uint32_t state;
+
+        explicit Random(uint32_t seed) : state(seed != 0 ? seed : 0x6d2b79f5u) {}
+
+        uint32_t next() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+        float nextFloat() { return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f); }
+    };
+
+    float smoothStep(float edge0, float edge1, float x) {
+        const float t = std::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+        return t * t * (3.0f - 2.0f * t);
+    }
+
+} // namespace
+
+uint32_t packYawScale(float yaw, float scale) {
+    const float wrapped = yaw - kTwoPi * std::floor(yaw / kTwoPi);
+    const uint32_t yawBits = static_cast<uint32_t>(std::lround(wrapped / kTwoPi * 65535.0f)) & 0xFFFFu;
+    const uint32_t scaleBits = static_cast<uint32_t>(std::lround(std::clamp(scale / kVegetationMaxScale, 0.0f, 1.0f) * 65535.0f));
+    return yawBits | (scaleBits << 16);
+}
+
+const ScatterLayer& ScatterGenerator::getLayer(VegetationKind kind) {
+    static const ScatterLayer kLayers[kVegetationKindCount] = {
+        // density, minScale, maxScale, minNormalY, maxHeightRatio, meshRadius, meshHeight
+        {Engine::VEGETATION_GRASS_DENSITY, 0.7f, 1.3f, 0.85f, 0.7f, 0.35f, 0.6f},
+        {Engine::VEGETATION_BUSH_DENSITY, 0.7f, 1.5f, 0.8f, 0.6f, 0.8f, 1.2f},
+        {Engine::VEGETATION_ROCK_DENSITY, 0.4f, 2.0f, 0.5f, 1.0f, 0.6f, 0.5f},
+    };
+    return kLayers[static_cast<size_t>(kind)];
+}
+
+std::unique_ptr<ScatterCell> ScatterGenerator::generate(const Terrain::TerrainTile& tile, const DensityMap& densityMap, uint32_t seed,
+                                                         size_t maxInstances) {
+    auto generateStart = std::chrono::steady_clock::now();
+    auto cell = std::make_unique<ScatterCell>();
+    cell->coord = tile.getCoord();
+
+    const glm::vec2 origin = tile.getOrigin();
+    const float size = tile.getSize();
+    const int patchesPerSide = std::max(1, static_cast<int>(std::lround(size / Engine::VEGETATION_PATCH_SIZE)));
+    const float patchSize = size / static_cast<float>(patchesPerSide);
+    const size_t patchCount = static_cast<size_t>(patchesPerSide) * static_cast<size_t>(patchesPerSide);
+
+    // Um balde por (tipo, bloco)
+    std::vector<std::vector<VegetationInstance>> buckets(kVegetationKindCount * patchCount);
+    size_t total = 0;
+    for (size_t kindIndex = 0; kindIndex < kVegetationKindCount; ++kindIndex) {
+        const VegetationKind kind = static_cast<VegetationKind>(kindIndex);
+        const ScatterLayer& layer = getLayer(kind);
+        if (layer.density <= 0.0f) {
+            continue;
+        }
+        const int side = std::max(1, static_cast<int>(std::ceil(size * std::sqrt(layer.density))));
+        const float step = size / static_cast<float>(side);
+
+        for (int j = 0; j < side; ++j) {
+            for (int i = 0; i < side; ++i) {
+                Random random(candidateSeed(seed, cell->coord, static_cast<uint32_t>(kindIndex), static_cast<uint32_t>(i), static_cast<uint32_t>(j)));
+                const float x = origin.x + (static_cast<float>(i) + random.nextFloat()) * step;
+                const float z = origin.y + (static_cast<float>(j) + random.nextFloat()) * step;
+                const float accept = random.nextFloat();
+                const float yaw = random.nextFloat() * kTwoPi;
+                const float scale = glm::mix(layer.minScale, layer.maxScale, random.nextFloat());
+
+                // Mapa primeiro (barato); inclinação e altura só para quem passou
+                float density = densityMap.sample(kind, x, z);
+                if (accept >= density) {
+                    continue;
+                }
+                const float height = tile.getHeight(x, z);
+                const float dx = tile.getHeight(x - 1.0f, z) - tile.getHeight(x + 1.0f, z);
+                const float dz = tile.getHeight(x, z - 1.0f) - tile.getHeight(x, z + 1.0f);
+                const float normalY = 2.0f / std::sqrt(dx * dx + dz * dz + 4.0f);
+                const float heightRatio = height / std::max(Engine::TERRAIN_HEIGHT_SCALE, 1e-3f);
+                density *= smoothStep(layer.minNormalY, layer.minNormalY + 0.08f, normalY);
+                density *= 1.0f - smoothStep(layer.maxHeightRatio - 0.1f, layer.maxHeightRatio, heightRatio);
+                if (accept >= density) {
+                    continue;
+                }
+
+                const int px = std::min(static_cast<int>((x - origin.x) / patchSize), patchesPerSide - 1);
+                const int pz = std::min(static_cast<int>((z - origin.y) / patchSize), patchesPerSide - 1);
+                buckets[kindIndex * patchCount + static_cast<size_t>(pz * patchesPerSide + px)].push_back({glm::vec3(x, height, z), packYawScale(yaw, scale)});
+                total++;
+            }
+        }
+    }
+
+    // Embaralha cada bloco (prefixos viram amostras uniformes) e, acima do limite, corta todos na mesma proporção
+    const double keepRatio = total > maxInstances ? static_cast<double>(maxInstances) / static_cast<double>(total) : 1.0;
+    cell->instances.reserve(std::min(total, maxInstances));
+    for (size_t bucketIndex = 0; bucketIndex < buckets.size(); ++bucketIndex) {
+        std::vector<VegetationInstance>& bucket = buckets[bucketIndex];
+        Random random(candidateSeed(seed, cell->coord, 0xFFu, static_cast<uint32_t>(bucketIndex), 0u));
+        for (size_t i = bucket.size(); i > 1; --i) {
+            std::swap(bucket[i - 1], bucket[random.next() % i]);
+        }
+        bucket.resize(static_cast<size_t>(std::floor(static_cast<double>(bucket.size()) * keepRatio)));
+        if (bucket.empty()) {
+            continue;
+        }
+
+        const VegetationKind kind = static_cast<VegetationKind>(bucketIndex / patchCount);
+        const ScatterLayer& layer = getLayer(kind);
+        ScatterPatch patch{kind, static_cast<uint32_t>(cell->instances.size()), static_cast<uint32_t>(bucket.size()), bucket[0].position,
+                           bucket[0].position};
+        for (const VegetationInstance& instance : bucket) {
+            patch.boundsMin = glm::min(patch.boundsMin, instance.position);
+            patch.boundsMax = glm::max(patch.boundsMax, instance.position);
+        }
+        // Malha na maior escala, com folga para o balanço do vento e pedras enterradas
+        const float radius = layer.meshRadius * layer.maxScale + 0.5f;
+        patch.boundsMin -= glm::vec3(radius, 0.5f, radius);
+        patch.boundsMax += glm::vec3(radius, layer.meshHeight * layer.maxScale, radius);
+        cell->patches.push_back(patch);
+        cell->instances.insert(cell->instances.end(), bucket.begin(), bucket.end());
+    }
+
+    cell->generateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - generateStart).count();
+    return cell;
+}
+
+} // namespace Vegetation
+} // namespace Engine
@@ -0,0 +1,72 @@
+// engine/vegetation/scatter.h
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "density_map.h"
+#include "./../terrain/terrain_tile.h" // Terrain::TileCoord
+
+namespace Engine {
+namespace Vegetation {
+
+// Instância compacta (16 bytes), lida direto do buffer de instâncias por vegetation.vert
+struct VegetationInstance {
+    glm::vec3 position; // Base no chão, em coordenadas de mundo
+    uint32_t yawScale;  // 16 bits baixos: yaw em [0, 2pi); 16 bits altos: escala em [0, kVegetationMaxScale]
+};
+static_assert(sizeof(VegetationInstance) == 16, "VegetationInstance deve ocupar 16 bytes");
+
+constexpr float kVegetationMaxScale = 4.0f; // Mesmo valor de vegetation.vert
+uint32_t packYawScale(float yaw, float scale);
+
+// Parâmetros de um tipo: densidade (do config), variação de escala, filtros do terreno e tamanho da malha
+struct ScatterLayer {
+    float density;        // Candidatos por m² onde o mapa de densidade vale 1
+    float minScale;
+    float maxScale;
+    float minNormalY;     // Inclinação máxima (componente y da normal do chão)
+    float maxHeightRatio; // Altura máxima como fração de TERRAIN_HEIGHT_SCALE
+    float meshRadius;     // Raio horizontal e altura da malha na escala 1 (caixas dos blocos)
+    float meshHeight;
+};
+
+// Instâncias de um tipo numa região quadrada da célula (unidade de culling e de LOD)
+struct ScatterPatch {
+    VegetationKind kind;
+    uint32_t first; // Índice da primeira instância em ScatterCell::instances
+    uint32_t count;
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
+};
+
+// Vegetação de uma célula (tile do terreno), gerada fora da thread principal
+struct ScatterCell {
+    Terrain::TileCoord coord;
+    // Agrupadas por bloco; dentro de cada bloco em ordem embaralhada, então qualquer prefixo é uma
+    // amostra uniforme (a rarefação com a distância só encurta a contagem desenhada)
+    std::vector<VegetationInstance> instances;
+    std::vector<ScatterPatch> patches;
+    double generateMs = 0.0;
+};
+
+// Espalhamento determinístico: candidatos em grade com jitter, cada um com um gerador semeado pela
+// célula, pelo tipo e pela posição na grade, aceitos pela densidade do mapa, da inclinação e da altura.
+// O resultado não depende da ordem nem da thread em que as células são geradas.
+class ScatterGenerator {
+public:
+    static const ScatterLayer& getLayer(VegetationKind kind);
+
+    // No máximo 'maxInstances' instâncias (acima disso, todos os blocos são rarefeitos na mesma proporção)
+    static std::unique_ptr<ScatterCell> generate(const Terrain::TerrainTile& tile, const DensityMap& densityMap, uint32_t seed,
+                                                 size_t maxInstances);
+
+private:
+    ScatterGenerator() = delete;
+};
+
+} // namespace Vegetation
+} // namespace Engine
@@ -0,0 +1,558 @@
+// engine/vegetation/vegetation_system.cpp
+#include "vegetation_system.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+#include "./../core/profiler.h"
+#include "./../memory/memory_tracker.h"
+#include "./../render/command_list.h"
+#include "./../render/frustum.h"
+#include "./../render/material.h"
+#include "./../render/shader.h"
+#include "./../terrain/terrain_system.h"
+
+#include <glad/gl.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <string>
+
+namespace Engine {
+namespace Vegetation {
+
+// Instâncias além do plano distante seriam selecionadas e enviadas só para o clipping descartar
+static_assert(Engine::VEGETATION_GRASS_DISTANCE <= Engine::CAMERA_FAR_PLANE && Engine::VEGETATION_BUSH_DISTANCE <= Engine::CAMERA_FAR_PLANE &&
+                  Engine::VEGETATION_ROCK_DISTANCE <= Engine::CAMERA_FAR_PLANE,
+              "Distância de desenho da vegetação além de CAMERA_FAR_PLANE");
+
+namespace {
+
+    constexpr int kLodCount = 2;
+    constexpr size_t kMaxIntegrationsPerFrame = 2;
+    constexpr float kReleaseRadiusRatio = 1.25f; // Histerese: células com vegetação só saem além deste múltiplo do raio
+    constexpr float kBenchmarkFractions[] = {0.0f, 0.25f, 0.5f, 0.75f, 1.0f};
+    constexpr int kBenchmarkSteps = static_cast<int>(sizeof(kBenchmarkFractions) / sizeof(kBenchmarkFractions[0]));
+
+    struct VegetationVertex {
+        glm::vec3 position;
+        glm::vec3 normal;
+    };
+
+    struct MeshRange {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        int32_t baseVertex = 0;
+    };
+
+    // Distância (xz) do foco ao retângulo do tile
+    float cellDistance(Terrain::TileCoord coord, const glm::vec2& focus) {
+        const float size = Engine::TERRAIN_TILE_SIZE;
+        const glm::vec2 cellMin(static_cast<float>(coord.x) * size, static_cast<float>(coord.z) * size);
+        const glm::vec2 closest = glm::clamp(focus, cellMin, cellMin + glm::vec2(size));
+        return glm::length(closest - focus);
+    }
+
+    float drawDistance(VegetationKind kind) {
+        switch (kind) {
+        case VegetationKind::Grass:
+            return Engine::VEGETATION_GRASS_DISTANCE;
+        case VegetationKind::Bush:
+            return Engine::VEGETATION_BUSH_DISTANCE;
+        case VegetationKind::Rock:
+            return Engine::VEGETATION_ROCK_DISTANCE;
+        }
+        return 0.0f;
+    }
+
+    // Planos verticais cruzados em volta do eixo y: 'planes' planos, 'segments' trechos na altura,
+    // a largura afinando até 'tipWidth' (fração) no topo. Normal de 'normalAt' (grama: para cima).
+    template <typename NormalFn>
+    void appendCrossedPlanes(int planes, int segments, float radius, float height, float tipWidth, NormalFn normalAt,
+                             std::vector<VegetationVertex>& vertices, std::vector<GLushort>& indices) {
+        const float pi = 3.14159265f;
+        for (int plane = 0; plane < planes; ++plane) {
+            const float angle = pi * static_cast<float>(plane) / static_cast<float>(planes);
+            const glm::vec3 across(std::cos(angle), 0.0f, std::sin(angle));
+            const GLushort base = static_cast<GLushort>(vertices.size());
+            for (int row = 0; row <= segments; ++row) {
+                const float t = static_cast<float>(row) / static_cast<float>(segments);
+                const float halfWidth = radius * glm::mix(1.0f, tipWidth, t);
+                const glm::vec3 center(0.0f, height * t, 0.0f);
+                for (float side : {-1.0f, 1.0f}) {
+                    const glm::vec3 position = center + across * (halfWidth * side);
+                    vertices.push_back({position, normalAt(position)});
+                }
+            }
+            for (int row = 0; row < segments; ++row) {
+                const GLushort a = static_cast<GLushort>(base + row * 2);
+                indices.insert(indices.end(), {a, static_cast<GLushort>(a + 1), static_cast<GLushort>(a + 2), static_cast<GLushort>(a + 1),
+                                               static_cast<GLushort>(a + 3), static_cast<GLushort>(a + 2)});
+            }
+        }
+    }
+
+    // Pedra: octaedro (subdividido 'subdivisions' vezes) com raio irregular, achatado e um pouco enterrado.
+    // Sombreamento facetado: três vértices por triângulo com a normal da face.
+    void appendRock(int subdivisions, float radius, float height, std::vector<VegetationVertex>& vertices, std::vector<GLushort>& indices) {
+        std::vector<glm::vec3> triangles = {
+            {1, 0, 0}, {0, 1, 0}, {0, 0, 1},   {0, 0, 1}, {0, 1, 0}, {-1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, -1}, {0, 1, 0}, {1, 0, 0},
+            {1, 0, 0}, {0, 0, 1}, {0, -1, 0}, {0, 0, 1}, {-1, 0, 0}, {0, -1, 0}, {-1, 0, 0}, {0, 0, -1}, {0, -1, 0}, {0, 0, -1}, {1, 0, 0}, {0, -1, 0},
+        };
+        for (int level = 0; level < subdivisions; ++level) {
+            std::vector<glm::vec3> finer;
+            for (size_t i = 0; i < triangles.size(); i += 3) {
+                const glm::vec3 a = triangles[i], b = triangles[i + 1], c = triangles[i + 2];
+                const glm::vec3 ab = glm::normalize(a + b), bc = glm::normalize(b + c), ca = glm::normalize(c + a);
+                finer.insert(finer.end(), {a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca});
+            }
+            triangles = std::move(finer);
+        }
+        // Mesma deformação nas duas LODs (depende só da direção), então a silhueta não salta
+        auto deform = [radius, height](const glm::vec3& direction) {
+            const float bump = 1.0f + 0.18f * std::sin(direction.x * 5.1f + direction.z * 3.7f) * std::cos(direction.y * 4.3f + direction.x * 2.2f);
+            return glm::vec3(direction.x * radius, direction.y * height - 0.25f * height, direction.z * radius) * bump;
+        };
+        for (size_t i = 0; i < triangles.size(); i += 3) {
+            const glm::vec3 a = deform(triangles[i]), b = deform(triangles[i + 1]), c = deform(triangles[i + 2]);
+            glm::vec3 normal = glm::normalize(glm::cross(b - a, c - a));
+            if (glm::dot(normal, a + b + c) < 0.0f) {
+                normal = -normal;
+            }
+            const GLushort base = static_cast<GLushort>(vertices.size());
+            vertices.insert(vertices.end(), {{a, normal}, {b, normal}, {c, normal}});
+            indices.insert(indices.end(), {base, static_cast<GLushort>(base + 1), static_cast<GLushort>(base + 2)});
+        }
+    }
+
+    void appendMesh(VegetationKind kind, int lod, std::vector<VegetationVertex>& vertices, std::vector<GLushort>& indices) {
+        const ScatterLayer& layer = ScatterGenerator::getLayer(kind);
+        switch (kind) {
+        case VegetationKind::Grass: {
+            // Normal para cima: o tufo fica iluminado como o chão em que está
+            auto up = [](const glm::vec3&) { return glm::vec3(0.0f, 1.0f, 0.0f); };
+            appendCrossedPlanes(lod == 0 ? 3 : 2, lod == 0 ? 2 : 1, layer.meshRadius, layer.meshHeight, 0.15f, up, vertices, indices);
+            break;
+        }
+        case VegetationKind::Bush: {
+            // Normal radial a partir do meio da copa, puxada para cima: volume arredondado com poucos planos
+            auto radial = [&layer](const glm::vec3& position) {
+                return glm::normalize(position - glm::vec3(0.0f, layer.meshHeight * 0.4f, 0.0f) + glm::vec3(0.0f, 0.5f, 0.0f));
+            };
+            appendCrossedPlanes(lod == 0 ? 4 : 2, lod == 0 ? 2 : 1, layer.meshRadius, layer.meshHeight, 0.6f, radial, vertices, indices);
+            break;
+        }
+        case VegetationKind::Rock:
+            appendRock(lod == 0 ? 1 : 0, layer.meshRadius, layer.meshHeight, vertices, indices);
+            break;
+        }
+    }
+
+} // namespace
+
+struct VegetationGpuResources {
+    GLuint vao = 0;
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    GLuint instanceBuffer = 0;
+    GLuint indirectBuffer = 0;
+    MeshRange meshes[kVegetationKindCount][kLodCount];
+    size_t gpuBytes = 0; // Malhas e instâncias de todos os slots (o buffer indireto é por frame)
+
+    ~VegetationGpuResources() {
+        Memory::MemoryTracker::untrack(Memory::MemoryTag::World, Memory::MemoryDomain::Gpu, gpuBytes);
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &vertexBuffer);
+        glDeleteBuffers(1, &indexBuffer);
+        glDeleteBuffers(1, &instanceBuffer);
+        glDeleteBuffers(1, &indirectBuffer);
+    }
+};
+
+VegetationSystem::VegetationSystem() = default;
+
+VegetationSystem::~VegetationSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void VegetationSystem::initialize(const Terrain::TerrainSystem& terrain) {
+    std::string densityMapPath = Engine::VEGETATION_DENSITY_MAP_PATH;
+    if (!densityMapPath.empty()) {
+        try {
+            const glm::vec3 worldMin = terrain.getWorldMin();
+            const glm::vec3 worldMax = terrain.getWorldMax();
+            m_densityMap = std::make_unique<ImageDensityMap>(densityMapPath, glm::vec2(worldMin.x, worldMin.z), glm::vec2(worldMax.x, worldMax.z));
+        } catch (const std::exception& e) {
+            Engine::Log::Error(std::format("VegetationSystem: {} Usando manchas procedurais.", e.what()));
+        }
+    }
+    if (!m_densityMap) {
+        m_densityMap = std::make_unique<ProceduralDensityMap>(Engine::VEGETATION_SEED);
+        densityMapPath = "procedural";
+    }
+
+    // Todas as malhas (tipo x LOD) num único par de buffers; cada uma é uma faixa com o seu baseVertex
+    auto gpu = std::make_shared<VegetationGpuResources>();
+    std::vector<VegetationVertex> vertices;
+    std::vector<GLushort> indices;
+    for (size_t kind = 0; kind < kVegetationKindCount; ++kind) {
+        for (int lod = 0; lod < kLodCount; ++lod) {
+            std::vector<VegetationVertex> meshVertices;
+            std::vector<GLushort> meshIndices;
+            appendMesh(static_cast<VegetationKind>(kind), lod, meshVertices, meshIndices);
+            gpu->meshes[kind][lod] = {static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(meshIndices.size()),
+                                      static_cast<int32_t>(vertices.size())};
+            vertices.insert(vertices.end(), meshVertices.begin(), meshVertices.end());
+            indices.insert(indices.end(), meshIndices.begin(), meshIndices.end());
+        }
+    }
+
+    const size_t slotCount = static_cast<size_t>(std::max(1, Engine::VEGETATION_MAX_CELLS));
+    const size_t instanceCapacity = slotCount * static_cast<size_t>(Engine::VEGETATION_MAX_INSTANCES_PER_CELL);
+    glCreateBuffers(1, &gpu->vertexBuffer);
+    glNamedBufferStorage(gpu->vertexBuffer, static_cast<GLsizeiptr>(vertices.size() * sizeof(VegetationVertex)), vertices.data(), 0);
+    glCreateBuffers(1, &gpu->indexBuffer);
+    glNamedBufferStorage(gpu->indexBuffer, static_cast<GLsizeiptr>(indices.size() * sizeof(GLushort)), indices.data(), 0);
+    glCreateBuffers(1, &gpu->instanceBuffer);
+    glNamedBufferStorage(gpu->instanceBuffer, static_cast<GLsizeiptr>(instanceCapacity * sizeof(VegetationInstance)), nullptr,
+                         GL_DYNAMIC_STORAGE_BIT);
+    glCreateBuffers(1, &gpu->indirectBuffer);
+    gpu->gpuBytes = vertices.size() * sizeof(VegetationVertex) + indices.size() * sizeof(GLushort) + instanceCapacity * sizeof(VegetationInstance);
+    Memory::MemoryTracker::track(Memory::MemoryTag::World, Memory::MemoryDomain::Gpu, gpu->gpuBytes);
+
+    // Atributos: 0 = posição e 1 = normal da malha; 2 = base e 3 = yaw/escala (inteiro), por instância
+    glCreateVertexArrays(1, &gpu->vao);
+    glVertexArrayVertexBuffer(gpu->vao, 0, gpu->vertexBuffer, 0, sizeof(VegetationVertex));
+    glEnableVertexArrayAttrib(gpu->vao, 0);
+    glVertexArrayAttribFormat(gpu->vao, 0, 3, GL_FLOAT, GL_FALSE, offsetof(VegetationVertex, position));
+    glVertexArrayAttribBinding(gpu->vao, 0, 0);
+    glEnableVertexArrayAttrib(gpu->vao, 1);
+    glVertexArrayAttribFormat(gpu->vao, 1, 3, GL_FLOAT, GL_FALSE, offsetof(VegetationVertex, normal));
+    glVertexArrayAttribBinding(gpu->vao, 1, 0);
+
+    glVertexArrayVertexBuffer(gpu->vao, 1, gpu->instanceBuffer, 0, sizeof(VegetationInstance));
+    glVertexArrayBindingDivisor(gpu->vao, 1, 1);
+    glEnableVertexArrayAttrib(gpu->vao, 2);
+    glVertexArrayAttribFormat(gpu->vao, 2, 3, GL_FLOAT, GL_FALSE, offsetof(VegetationInstance, position));
+    glVertexArrayAttribBinding(gpu->vao, 2, 1);
+    glEnableVertexArrayAttrib(gpu->vao, 3);
+    glVertexArrayAttribIFormat(gpu->vao, 3, 1, GL_UNSIGNED_INT, offsetof(VegetationInstance, yawScale));
+    glVertexArrayAttribBinding(gpu->vao, 3, 1);
+    glVertexArrayElementBuffer(gpu->vao, gpu->indexBuffer);
+    m_gpu = gpu;
+
+    static const glm::vec4 kBaseColors[kVegetationKindCount] = {
+        {0.30f, 0.46f, 0.16f, 1.0f}, // Grama
+        {0.18f, 0.32f, 0.12f, 1.0f}, // Arbustos
+        {0.42f, 0.40f, 0.37f, 1.0f}, // Pedras
+    };
+    for (size_t kind = 0; kind < kVegetationKindCount; ++kind) {
+        m_materials[kind] = std::make_shared<Render::Material>();
+        m_materials[kind]->baseColorFactor = kBaseColors[kind];
+        m_materials[kind]->roughnessFactor = 0.9f;
+    }
+
+    m_freeSlots.clear();
+    for (size_t slot = slotCount; slot > 0; --slot) {
+        m_freeSlots.push_back(static_cast<uint32_t>(slot - 1));
+    }
+    const int threadCount = std::max(1, Engine::VEGETATION_THREADS);
+    for (int i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&VegetationSystem::generatorMain, this);
+    }
+    m_lastUpdate = std::chrono::steady_clock::now();
+    m_benchmarkStep = Engine::VEGETATION_BENCHMARK ? 0 : -1;
+
+    Engine::Log::Info(std::format("VegetationSystem: {} células de até {} instâncias ({:.1f} MB na GPU), mapa de densidade {}, {} thread(s) de geração.",
+                                  slotCount, Engine::VEGETATION_MAX_INSTANCES_PER_CELL,
+                                  static_cast<double>(instanceCapacity * sizeof(VegetationInstance)) / (1024.0 * 1024.0),
+                                  densityMapPath,
+                                  threadCount));
+}
+
+void VegetationSystem::generatorMain() {
+    Engine::Profiling::Profiler::setThreadName("Vegetação");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::World);
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_stop) {
+                return;
+            }
+            request = std::move(m_queue.back());
+            m_queue.pop_back();
+        }
+
+        ENGINE_PROFILE_SCOPE("ScatterGenerator::generate");
+        std::unique_ptr<ScatterCell> cell = ScatterGenerator::generate(*request.tile, *m_densityMap, Engine::VEGETATION_SEED,
+                                                                       static_cast<size_t>(Engine::VEGETATION_MAX_INSTANCES_PER_CELL));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completed.push_back(std::move(cell));
+    }
+}
+
+void VegetationSystem::integrate(std::unique_ptr<ScatterCell> cell) {
+    const uint64_t key = cellKey(cell->coord);
+    if (m_pending.erase(key) == 0) {
+        return; // Cancelada enquanto era gerada
+    }
+    m_totalGenerateMs += cell->generateMs;
+    m_generatedCells++;
+    if (m_freeSlots.empty()) {
+        return;
+    }
+
+    ResidentCell resident{cell->coord, m_freeSlots.back(), static_cast<uint32_t>(cell->instances.size()), cell->patches};
+    m_freeSlots.pop_back();
+    if (!cell->instances.empty()) {
+        m_pendingUploads.emplace_back(resident.slot, std::shared_ptr<const ScatterCell>(std::move(cell)));
+    }
+    m_resident.emplace(key, std::move(resident));
+}
+
+void VegetationSystem::update(const glm::vec3& focus, const Terrain::TerrainSystem& terrain) {
+    ENGINE_PROFILE_SCOPE("VegetationSystem::update");
+    if (!isReady()) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    updateBenchmark(std::chrono::duration<double, std::milli>(now - m_lastUpdate).count());
+    m_lastUpdate = now;
+    m_focus = glm::vec2(focus.x, focus.z);
+    const float radius = Engine::VEGETATION_CELL_RADIUS;
+    const float releaseRadius = radius * kReleaseRadiusRatio;
+
+    // 1. Células geradas (poucas por frame: cada uma agenda o upload das suas instâncias)
+    std::vector<std::unique_ptr<ScatterCell>> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const size_t count = std::min(m_completed.size(), kMaxIntegrationsPerFrame);
+        for (size_t i = 0; i < count; ++i) {
+            ready.push_back(std::move(m_completed[i]));
+        }
+        m_completed.erase(m_completed.begin(), m_completed.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+    for (std::unique_ptr<ScatterCell>& cell : ready) {
+        const bool wanted = terrain.hasTile(cell->coord) && cellDistance(cell->coord, m_focus) <= releaseRadius;
+        if (wanted) {
+            integrate(std::move(cell));
+        } else {
+            m_pending.erase(cellKey(cell->coord));
+        }
+    }
+
+    // 2. Libera as distantes e as que perderam o tile (streaming do terreno)
+    for (auto it = m_resident.begin(); it != m_resident.end();) {
+        if (cellDistance(it->second.coord, m_focus) > releaseRadius || !terrain.hasTile(it->second.coord)) {
+            const uint32_t slot = it->second.slot;
+            m_pendingUploads.erase(std::remove_if(m_pendingUploads.begin(), m_pendingUploads.end(),
+                                                  [slot](const auto& upload) { return upload.first == slot; }),
+                                   m_pendingUploads.end());
+            m_freeSlots.push_back(slot);
+            it = m_resident.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 3. Pede as células com tile residente dentro do raio, as mais próximas primeiro, até acabarem as faixas livres
+    std::vector<Request> requests;
+    const Terrain::TileCoord first = terrain.tileAt(focus.x - radius, focus.z - radius);
+    const Terrain::TileCoord last = terrain.tileAt(focus.x + radius, focus.z + radius);
+    for (int32_t z = first.z; z <= last.z; ++z) {
+        for (int32_t x = first.x; x <= last.x; ++x) {
+            const Terrain::TileCoord coord{x, z};
+            const uint64_t key = cellKey(coord);
+            if (m_resident.count(key) > 0 || m_pending.count(key) > 0 || cellDistance(coord, m_focus) > radius) {
+                continue;
+            }
+            if (std::shared_ptr<const Terrain::TerrainTile> tile = terrain.getTile(coord)) {
+                requests.push_back({coord, std::move(tile)});
+            }
+        }
+    }
+    std::sort(requests.begin(), requests.end(), [this](const Request& a, const Request& b) {
+        return cellDistance(a.coord, m_focus) < cellDistance(b.coord, m_focus);
+    });
+    const size_t available = m_freeSlots.size() > m_pending.size() ? m_freeSlots.size() - m_pending.size() : 0;
+    requests.resize(std::min(requests.size(), available));
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Pedidos ainda na fila que saíram do raio são cancelados
+        auto cancelled = std::partition(m_queue.begin(), m_queue.end(), [this, releaseRadius](const Request& request) {
+            return cellDistance(request.coord, m_focus) <= releaseRadius;
+        });
+        for (auto it = cancelled; it != m_queue.end(); ++it) {
+            m_pending.erase(cellKey(it->coord));
+        }
+        m_queue.erase(cancelled, m_queue.end());
+        for (Request& request : requests) {
+            m_pending.emplace(cellKey(request.coord), request.coord);
+            m_queue.push_back(std::move(request));
+        }
+        std::sort(m_queue.begin(), m_queue.end(), [this](const Request& a, const Request& b) {
+            return cellDistance(a.coord, m_focus) > cellDistance(b.coord, m_focus);
+        });
+    }
+    if (!requests.empty()) {
+        m_wake.notify_all();
+    }
+
+    m_stats.residentCells = m_resident.size();
+    m_stats.pendingCells = m_pending.size();
+    m_stats.residentInstances = 0;
+    for (const auto& [key, cell] : m_resident) {
+        m_stats.residentInstances += cell.instanceCount;
+    }
+    m_stats.averageGenerateMs = m_generatedCells > 0 ? m_totalGenerateMs / static_cast<double>(m_generatedCells) : 0.0;
+}
+
+void VegetationSystem::logReport() const {
+    Engine::Log::Info(std::format("VegetationSystem: {} células ({} instâncias residentes, {} pendentes, geração {:.2f} ms em média).",
+                                  m_stats.residentCells, m_stats.residentInstances, m_stats.pendingCells, m_stats.averageGenerateMs));
+}
+
+void VegetationSystem::select(const Render::Frustum& frustum, const glm::vec3& cameraPosition) {
+    auto selectStart = std::chrono::steady_clock::now();
+    std::array<std::vector<DrawElementsIndirectCommand>, kVegetationKindCount * kLodCount> groups;
+    m_stats.drawnInstances = 0;
+    m_stats.drawnPatches = 0;
+
+    for (const auto& [key, cell] : m_resident) {
+        const uint32_t slotBase = cell.slot * static_cast<uint32_t>(Engine::VEGETATION_MAX_INSTANCES_PER_CELL);
+        for (const ScatterPatch& patch : cell.patches) {
+            const float maxDistance = drawDistance(patch.kind);
+            const glm::vec3 closest = glm::clamp(cameraPosition, patch.boundsMin, patch.boundsMax);
+            const float distance = glm::length(closest - cameraPosition);
+            if (distance > maxDistance || !frustum.intersectsBox(patch.boundsMin, patch.boundsMax)) {
+                continue;
+            }
+            // Depois do início da LOD 1: malha simplificada e só um prefixo das instâncias (já embaralhadas)
+            const float lodStart = maxDistance * Engine::VEGETATION_LOD_DISTANCE_RATIO;
+            const int lod = distance > lodStart ? 1 : 0;
+            float fraction = m_drawFraction;
+            if (lod == 1) {
+                fraction *= glm::mix(1.0f, Engine::VEGETATION_FAR_DENSITY, (distance - lodStart) / std::max(maxDistance - lodStart, 1e-3f));
+            }
+            const uint32_t count = static_cast<uint32_t>(std::ceil(static_cast<float>(patch.count) * fraction));
+            if (count == 0) {
+                continue;
+            }
+            const MeshRange& mesh = m_gpu->meshes[static_cast<size_t>(patch.kind)][lod];
+            groups[static_cast<size_t>(patch.kind) * kLodCount + static_cast<size_t>(lod)].push_back(
+                {mesh.indexCount, count, mesh.firstIndex, mesh.baseVertex, slotBase + patch.first});
+            m_stats.drawnInstances += count;
+            m_stats.drawnPatches++;
+        }
+    }
+
+    m_commands.clear();
+    m_stats.multiDraws = 0;
+    for (size_t group = 0; group < groups.size(); ++group) {
+        m_groupOffsets[group] = m_commands.size();
+        m_commands.insert(m_commands.end(), groups[group].begin(), groups[group].end());
+        m_stats.multiDraws += groups[group].empty() ? 0 : 1;
+    }
+    m_groupOffsets[groups.size()] = m_commands.size();
+    m_stats.selectMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - selectStart).count();
+}
+
+void VegetationSystem::record(Render::CommandList& commands, const Render::Shader* shader, float time) {
+    if (!isReady() || !shader) {
+        return;
+    }
+
+    if (!m_pendingUploads.empty()) {
+        // Cada célula na sua faixa fixa; a cópia em CPU vive só até o upload
+        commands.upload([gpu = m_gpu, cells = std::move(m_pendingUploads)]() {
+            for (const auto& [slot, cell] : cells) {
+                const GLintptr offset = static_cast<GLintptr>(slot) * Engine::VEGETATION_MAX_INSTANCES_PER_CELL * sizeof(VegetationInstance);
+                glNamedBufferSubData(gpu->instanceBuffer, offset, static_cast<GLsizeiptr>(cell->instances.size() * sizeof(VegetationInstance)),
+                                     cell->instances.data());
+            }
+        });
+        m_pendingUploads.clear();
+    }
+    if (m_commands.empty()) {
+        return;
+    }
+
+    commands.setUniform("uLodFade", 1.0f);
+    // A lista pode ser reproduzida enquanto o próximo frame seleciona: o desenho leva uma cópia dos comandos
+    commands.upload([gpu = m_gpu, materials = m_materials, shader, draws = m_commands, offsets = m_groupOffsets, time]() {
+        static constexpr float kSway[kVegetationKindCount] = {0.15f, 0.05f, 0.0f}; // Balanço por metro de altura
+        glNamedBufferData(gpu->indirectBuffer, static_cast<GLsizeiptr>(draws.size() * sizeof(DrawElementsIndirectCommand)), draws.data(),
+                          GL_STREAM_DRAW);
+        glBindVertexArray(gpu->vao);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, gpu->indirectBuffer);
+        for (size_t kind = 0; kind < kVegetationKindCount; ++kind) {
+            if (offsets[kind * kLodCount] == offsets[(kind + 1) * kLodCount]) {
+                continue;
+            }
+            materials[kind]->activate(*shader);
+            shader->setVec4("uVegetationWind", glm::vec4(time, kSway[kind], 0.0f, 0.0f));
+            for (int lod = 0; lod < kLodCount; ++lod) {
+                const size_t begin = offsets[kind * kLodCount + static_cast<size_t>(lod)];
+                const size_t end = offsets[kind * kLodCount + static_cast<size_t>(lod) + 1];
+                if (begin == end) {
+                    continue;
+                }
+                const void* offset = reinterpret_cast<const void*>(begin * sizeof(DrawElementsIndirectCommand));
+                glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, offset, static_cast<GLsizei>(end - begin), 0);
+            }
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glBindVertexArray(0);
+    });
+}
+
+void VegetationSystem::updateBenchmark(double frameMs) {
+    // Só começa com a vegetação em volta já gerada (a geração não entra na medida)
+    if (m_benchmarkStep < 0 || m_resident.empty() || !m_pending.empty()) {
+        return;
+    }
+    m_drawFraction = kBenchmarkFractions[m_benchmarkStep];
+    m_benchmarkFrames++;
+    const int warmup = Engine::VEGETATION_BENCHMARK_FRAMES_PER_STEP / 10; // Frames ainda com a fração anterior na fila
+    if (m_benchmarkFrames <= warmup) {
+        return;
+    }
+    m_benchmarkFrameMs += frameMs;
+    m_benchmarkInstances += m_stats.drawnInstances;
+    if (m_benchmarkFrames < Engine::VEGETATION_BENCHMARK_FRAMES_PER_STEP) {
+        return;
+    }
+
+    const double frames = static_cast<double>(m_benchmarkFrames - warmup);
+    const double instances = static_cast<double>(m_benchmarkInstances) / frames;
+    const double averageMs = m_benchmarkFrameMs / frames;
+    m_benchmarkResults.emplace_back(instances, averageMs);
+    Engine::Log::Info(std::format("VegetationSystem (benchmark): {:.0f}% das instâncias: {:.0f} instâncias por frame, {:.2f} ms por frame.",
+                                  kBenchmarkFractions[m_benchmarkStep] * 100.0f, instances, averageMs));
+    m_benchmarkFrames = 0;
+    m_benchmarkFrameMs = 0.0;
+    m_benchmarkInstances = 0;
+
+    if (++m_benchmarkStep == kBenchmarkSteps) {
+        const auto& [noneInstances, noneMs] = m_benchmarkResults.front();
+        const auto& [allInstances, allMs] = m_benchmarkResults.back();
+        const double perHundredThousand = allInstances > noneInstances ? (allMs - noneMs) / (allInstances - noneInstances) * 100000.0 : 0.0;
+        Engine::Log::Info(std::format("VegetationSystem (benchmark): {:.0f} instâncias custam {:.2f} ms por frame ({:.3f} ms a cada 100 mil).",
+                                      allInstances - noneInstances, allMs - noneMs, perHundredThousand));
+        m_benchmarkStep = -1;
+        m_drawFraction = 1.0f;
+    }
+}
+
+} // namespace Vegetation
+} // namespace Engine
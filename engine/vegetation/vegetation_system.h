@@ -0,0 +1,139 @@
+// engine/vegetation/vegetation_system.h
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "scatter.h"
+
+namespace Engine {
+namespace Render {
+    class CommandList;
+    class Frustum;
+    class Material;
+    class Shader;
+}
+namespace Terrain {
+    class TerrainSystem;
+    class TerrainTile;
+}
+namespace Vegetation {
+
+struct VegetationGpuResources;
+
+// Um comando de glMultiDrawElementsIndirect (layout fixo do OpenGL)
+struct DrawElementsIndirectCommand {
+    uint32_t count;
+    uint32_t instanceCount;
+    uint32_t firstIndex;
+    int32_t baseVertex;
+    uint32_t baseInstance;
+};
+
+// Contadores do último frame (RenderStats e benchmark)
+struct VegetationStats {
+    uint64_t residentCells = 0;
+    uint64_t pendingCells = 0;
+    uint64_t residentInstances = 0;
+    uint64_t drawnInstances = 0;
+    uint64_t drawnPatches = 0;
+    uint64_t multiDraws = 0;      // Chamadas de glMultiDrawElementsIndirect (uma por tipo e LOD com algo visível)
+    double selectMs = 0.0;
+    double averageGenerateMs = 0.0;
+};
+
+// Grama, arbustos e pedras instanciados sobre o terreno, sem GameObjects.
+// As células (tiles) residentes perto do jogador são espalhadas em threads próprias (ScatterGenerator);
+// as instâncias vão para um buffer único na GPU, uma faixa fixa por célula, e a CPU guarda só os blocos
+// (caixa, tipo, faixa). Por frame: culling dos blocos por distância e frustum, LOD da malha e rarefação
+// pela distância, e um glMultiDrawElementsIndirect por tipo e LOD.
+class VegetationSystem {
+public:
+    VegetationSystem();
+    ~VegetationSystem();
+
+    VegetationSystem(const VegetationSystem&) = delete;
+    VegetationSystem& operator=(const VegetationSystem&) = delete;
+
+    // Mapa de densidade, malhas e buffers (contexto GL atual); inicia as threads de geração
+    void initialize(const Terrain::TerrainSystem& terrain);
+    bool isReady() const { return m_gpu != nullptr; }
+
+    // Por frame, na thread principal: integra células geradas, libera as distantes (ou sem tile) e pede as próximas
+    void update(const glm::vec3& focus, const Terrain::TerrainSystem& terrain);
+    // Seleção dos blocos do frame (sem OpenGL)
+    void select(const Render::Frustum& frustum, const glm::vec3& cameraPosition);
+    // Grava os uploads de células novas e os desenhos; 'shader' (vegetation.vert + basic/gbuffer.frag) já ligado
+    void record(Render::CommandList& commands, const Render::Shader* shader, float time);
+
+    const VegetationStats& getStats() const { return m_stats; }
+    // Células residentes e geração (o desenho entra nas RenderStats da cena)
+    void logReport() const;
+
+private:
+    struct ResidentCell {
+        Terrain::TileCoord coord;
+        uint32_t slot; // Faixa [slot * VEGETATION_MAX_INSTANCES_PER_CELL, ...) do buffer de instâncias
+        uint32_t instanceCount;
+        std::vector<ScatterPatch> patches;
+    };
+    struct Request {
+        Terrain::TileCoord coord;
+        std::shared_ptr<const Terrain::TerrainTile> tile; // Alturas lidas pela thread de geração
+    };
+
+    void generatorMain();
+    void integrate(std::unique_ptr<ScatterCell> cell);
+    // Benchmark: mantém cada fração das instâncias por alguns frames e registra o tempo médio de frame
+    void updateBenchmark(double frameMs);
+
+    static uint64_t cellKey(Terrain::TileCoord coord) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(coord.z)) << 32) | static_cast<uint32_t>(coord.x);
+    }
+
+    std::unique_ptr<DensityMap> m_densityMap;
+    std::shared_ptr<VegetationGpuResources> m_gpu;                             // Compartilhado com os comandos gravados
+    std::array<std::shared_ptr<Render::Material>, kVegetationKindCount> m_materials;
+
+    // Só a thread principal
+    std::map<uint64_t, ResidentCell> m_resident;
+    std::map<uint64_t, Terrain::TileCoord> m_pending;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<std::pair<uint32_t, std::shared_ptr<const ScatterCell>>> m_pendingUploads; // (faixa, célula) ainda não enviadas
+    glm::vec2 m_focus{0.0f};
+    std::vector<DrawElementsIndirectCommand> m_commands;           // Do frame, agrupados por (tipo, LOD)
+    std::array<size_t, kVegetationKindCount * 2 + 1> m_groupOffsets{}; // Início de cada grupo em m_commands
+    float m_drawFraction = 1.0f;
+    VegetationStats m_stats;
+    double m_totalGenerateMs = 0.0;
+    uint64_t m_generatedCells = 0;
+
+    // Benchmark (VEGETATION_BENCHMARK): tempo entre updates = tempo de frame da thread principal
+    int m_benchmarkStep = -1; // -1 = desligado ou terminado
+    int m_benchmarkFrames = 0;
+    double m_benchmarkFrameMs = 0.0;
+    uint64_t m_benchmarkInstances = 0;
+    std::vector<std::pair<double, double>> m_benchmarkResults; // (instâncias, ms) por etapa
+    std::chrono::steady_clock::time_point m_lastUpdate;
+
+    // Compartilhado com as threads de geração (m_mutex)
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::vector<Request> m_queue; // Mais distante primeiro (a mais próxima no fim)
+    std::vector<std::unique_ptr<ScatterCell>> m_completed;
+    bool m_stop = false;
+
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace Vegetation
+} // namespace Engine
@@ -103,10 +103,26 @@ bool Window::shouldClose() const {
 }
 
 void Window::swapBuffersAndPollEvents() {
+    swapBuffers();
+    pollEvents();
+}
+
+void Window::swapBuffers() {
     glfwSwapBuffers(m_window);
+}
+
+void Window::pollEvents() {
     glfwPollEvents();
 }
 
+void Window::makeContextCurrent() {
+    glfwMakeContextCurrent(m_window);
+}
+
+void Window::releaseContext() {
+    glfwMakeContextCurrent(nullptr);
+}
+
 double Window::getTime() const {
     return glfwGetTime();
 }
@@ -28,6 +28,13 @@ public:
     GLFWwindow* getGLFWWindow() const { return m_window; }
     bool shouldClose() const;
     void swapBuffersAndPollEvents();
+    // Separados para a thread de renderização: a troca de buffers acontece na thread que possui
+    // o contexto GL, enquanto o processamento de eventos continua na thread principal.
+    void swapBuffers();
+    void pollEvents();
+    // Transferência do contexto GL entre threads (o contexto só pode estar ativo em uma por vez)
+    void makeContextCurrent();
+    void releaseContext();
     int getWidth() const { return m_width; }
     int getHeight() const { return m_height; }
     float getAspectRatio() const { return static_cast<float>(m_width) / static_cast<float>(m_height); }
@@ -0,0 +1,127 @@
+// engine/world/cell_bundle.cpp
+#include "cell_bundle.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+#include "./../core/path_utils.h"
+#include "./../terrain/height_source.h"
+#include "./../terrain/terrain_system.h"
+
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace Engine {
+namespace World {
+
+namespace {
+
+    constexpr char kBundleMagic[4] = {'W', 'C', 'E', 'L'};
+    constexpr uint32_t kBundleVersion = 1;
+
+    struct CellBundleHeader {
+        char magic[4];
+        uint32_t version;
+        uint64_t sourceKey;  // HeightSource::getCacheKey
+        int32_t x;
+        int32_t z;
+        uint32_t resolution;
+        float tileSize;
+    };
+
+} // namespace
+
+std::filesystem::path CellBundleCooker::bundlePath(Terrain::TileCoord coord) {
+    // Raiz do projeto (resolveEnginePath exige um caminho existente)
+    static const std::filesystem::path cacheDir = Engine::resolveEnginePath(".") / Engine::WORLD_CELL_CACHE_DIR;
+    return cacheDir / std::format("cell_{}_{}.bin", coord.x, coord.z);
+}
+
+bool CellBundleCooker::read(const std::filesystem::path& path, uint64_t sourceKey, Terrain::TileCoord coord, std::vector<float>& heights) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    CellBundleHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return false;
+    }
+    const bool matches = std::memcmp(header.magic, kBundleMagic, sizeof(kBundleMagic)) == 0 && header.version == kBundleVersion &&
+                         header.sourceKey == sourceKey && header.x == coord.x && header.z == coord.z &&
+                         header.resolution == static_cast<uint32_t>(Engine::TERRAIN_TILE_RESOLUTION) && header.tileSize == Engine::TERRAIN_TILE_SIZE;
+    if (!matches) {
+        return false; // Pacote de outra configuração: será cozido de novo
+    }
+    heights.resize(static_cast<size_t>(header.resolution) * header.resolution);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(heights.data()), static_cast<std::streamsize>(heights.size() * sizeof(float))));
+}
+
+bool CellBundleCooker::write(const std::filesystem::path& path, uint64_t sourceKey, Terrain::TileCoord coord, const std::vector<float>& heights) {
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+    if (error) {
+        return false;
+    }
+    // Grava num temporário e renomeia: um pacote pela metade nunca é lido por outra execução
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        CellBundleHeader header{};
+        std::memcpy(header.magic, kBundleMagic, sizeof(kBundleMagic));
+        header.version = kBundleVersion;
+        header.sourceKey = sourceKey;
+        header.x = coord.x;
+        header.z = coord.z;
+        header.resolution = static_cast<uint32_t>(Engine::TERRAIN_TILE_RESOLUTION);
+        header.tileSize = Engine::TERRAIN_TILE_SIZE;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(heights.data()), static_cast<std::streamsize>(heights.size() * sizeof(float)));
+        if (!file) {
+            return false;
+        }
+    }
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
+
+std::unique_ptr<CellBundle> CellBundleCooker::load(const Terrain::TerrainSystem& terrain, Terrain::TileCoord coord) {
+    auto loadStart = std::chrono::steady_clock::now();
+    auto bundle = std::make_unique<CellBundle>();
+    bundle->coord = coord;
+
+    const bool useCache = Engine::WORLD_CELL_CACHE_DIR[0] != '\0';
+    const uint64_t sourceKey = terrain.getHeightSource().getCacheKey();
+    std::vector<float> heights;
+    std::filesystem::path path;
+    if (useCache) {
+        try {
+            path = bundlePath(coord);
+            bundle->fromCache = read(path, sourceKey, coord, heights);
+        } catch (const std::exception& e) {
+            Engine::Log::Warn(std::format("CellBundleCooker: cache indisponível ({}).", e.what()));
+            path.clear();
+        }
+    }
+    if (!bundle->fromCache) {
+        // Em série: esta thread não pode disputar o WorkerPool com a gravação do frame
+        heights = Terrain::TerrainTile::sampleHeights(terrain.getHeightSource(), coord, Engine::TERRAIN_TILE_SIZE,
+                                                      Engine::TERRAIN_TILE_RESOLUTION, false);
+        if (!path.empty() && !write(path, sourceKey, coord, heights)) {
+            Engine::Log::Warn(std::format("CellBundleCooker: falha ao gravar '{}'.", path.string()));
+        }
+    }
+
+    bundle->terrainTile = terrain.createTile(coord, std::move(heights));
+    bundle->bytes = Terrain::TerrainSystem::getTileBytes();
+    bundle->loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+    return bundle;
+}
+
+} // namespace World
+} // namespace Engine
@@ -0,0 +1,42 @@
+// engine/world/cell_bundle.h
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "./../terrain/terrain_tile.h" // Terrain::TileCoord
+
+namespace Engine {
+namespace Terrain {
+    class TerrainSystem;
+}
+namespace World {
+
+// Conteúdo de uma célula do mundo, pronto para entrar na cena (montado fora da thread principal)
+struct CellBundle {
+    Terrain::TileCoord coord;
+    std::shared_ptr<Terrain::TerrainTile> terrainTile;
+    size_t bytes = 0;        // Memória residente quando integrada (CPU + GPU)
+    bool fromCache = false;  // Lido do pacote cozido (senão foi gerado e, se possível, gravado)
+    double loadMs = 0.0;
+};
+
+// Pacotes cozidos das células em disco (config.h: WORLD_CELL_CACHE_DIR): cabeçalho + alturas do tile.
+// Na falta do pacote (ou com origem de alturas diferente), a célula é gerada e o pacote gravado.
+class CellBundleCooker {
+public:
+    // Monta o pacote da célula 'coord'. Pode ser chamado de qualquer thread (não usa o WorkerPool nem GL).
+    static std::unique_ptr<CellBundle> load(const Terrain::TerrainSystem& terrain, Terrain::TileCoord coord);
+
+private:
+    CellBundleCooker() = delete;
+
+    static std::filesystem::path bundlePath(Terrain::TileCoord coord);
+    static bool read(const std::filesystem::path& path, uint64_t sourceKey, Terrain::TileCoord coord, std::vector<float>& heights);
+    static bool write(const std::filesystem::path& path, uint64_t sourceKey, Terrain::TileCoord coord, const std::vector<float>& heights);
+};
+
+} // namespace World
+} // namespace Engine
@@ -0,0 +1,257 @@
+// engine/world/world_streamer.cpp
+#include "world_streamer.h"
+#include "./../core/config.h"
+#include "./../core/log.h"
+#include "./../core/profiler.h"
+#include "./../memory/allocation_counters.h"
+#include "./../terrain/terrain_system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+
+namespace Engine {
+namespace World {
+
+WorldStreamer::WorldStreamer(Terrain::TerrainSystem& terrain)
+    : m_terrain(terrain), m_capacity(std::min(getCellCapacity(), terrain.getLayerCapacity())) {
+    m_stats.budgetBytes = static_cast<uint64_t>(Engine::WORLD_STREAMING_BUDGET_MB) * 1024ull * 1024ull;
+
+    const int threadCount = std::max(1, Engine::WORLD_STREAMING_THREADS);
+    for (int i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&WorldStreamer::loaderMain, this);
+    }
+    Engine::Log::Info(std::format("WorldStreamer: {} thread(s) de carregamento, até {} células residentes ({} MB, {:.1f} KB por célula).",
+                                  threadCount, m_capacity, Engine::WORLD_STREAMING_BUDGET_MB,
+                                  static_cast<double>(Terrain::TerrainSystem::getTileBytes()) / 1024.0));
+}
+
+WorldStreamer::~WorldStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t WorldStreamer::getCellCapacity() {
+    const size_t budget = static_cast<size_t>(Engine::WORLD_STREAMING_BUDGET_MB) * 1024 * 1024;
+    return std::max<size_t>(1, budget / Terrain::TerrainSystem::getTileBytes());
+}
+
+void WorldStreamer::loaderMain() {
+    Engine::Profiling::Profiler::setThreadName("Streaming");
+    Memory::AllocationScope allocationScope(Memory::MemoryTag::World);
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_stop) {
+                return;
+            }
+            request = m_queue.back();
+            m_queue.pop_back();
+        }
+
+        ENGINE_PROFILE_SCOPE("WorldStreamer::loadCell");
+        std::unique_ptr<CellBundle> bundle;
+        try {
+            bundle = CellBundleCooker::load(m_terrain, request.coord);
+        } catch (const std::exception& e) {
+            Engine::Log::Error(std::format("WorldStreamer: falha ao carregar a célula ({}, {}): {}", request.coord.x, request.coord.z, e.what()));
+            bundle = std::make_unique<CellBundle>(); // Sem tile: a integração só libera o pedido
+            bundle->coord = request.coord;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completed.push_back(std::move(bundle));
+    }
+}
+
+float WorldStreamer::cellDistance(Terrain::TileCoord coord, const glm::vec2& focus) const {
+    const float size = Engine::TERRAIN_TILE_SIZE;
+    const glm::vec2 cellMin(static_cast<float>(coord.x) * size, static_cast<float>(coord.z) * size);
+    const glm::vec2 closest = glm::clamp(focus, cellMin, cellMin + glm::vec2(size));
+    return glm::length(closest - focus);
+}
+
+float WorldStreamer::cellPriority(Terrain::TileCoord coord, const glm::vec2& focus, const glm::vec2& viewDirection) const {
+    // Distância encurtada para células à frente da câmera (até WORLD_STREAMING_VIEW_WEIGHT)
+    const float size = Engine::TERRAIN_TILE_SIZE;
+    const glm::vec2 center = (glm::vec2(static_cast<float>(coord.x), static_cast<float>(coord.z)) + 0.5f) * size;
+    const glm::vec2 toCell = center - focus;
+    const float length = glm::length(toCell);
+    const float facing = length > 0.0f ? std::max(0.0f, glm::dot(toCell / length, viewDirection)) : 0.0f;
+    return cellDistance(coord, focus) * (1.0f - Engine::WORLD_STREAMING_VIEW_WEIGHT * facing);
+}
+
+void WorldStreamer::integrate(std::unique_ptr<CellBundle> bundle) {
+    ENGINE_PROFILE_SCOPE("WorldStreamer::integrate");
+    const uint64_t key = cellKey(bundle->coord);
+    m_pending.erase(key);
+    if (!bundle->terrainTile) {
+        return;
+    }
+    if (cellDistance(bundle->coord, m_focus) > Engine::WORLD_STREAMING_UNLOAD_RADIUS || !m_terrain.addTile(bundle->terrainTile)) {
+        m_stats.totalDiscarded++; // O jogador se afastou enquanto a célula carregava
+        return;
+    }
+    m_resident.emplace(key, bundle->coord);
+    m_stats.totalLoaded++;
+    m_stats.cacheHits += bundle->fromCache ? 1 : 0;
+    m_totalLoadMs += bundle->loadMs;
+    ENGINE_LOG_DEBUG("WorldStreamer: célula ({}, {}) integrada ({} em {:.2f} ms).", bundle->coord.x, bundle->coord.z,
+                     bundle->fromCache ? "pacote cozido" : "gerada", bundle->loadMs);
+}
+
+void WorldStreamer::unload(Terrain::TileCoord coord) {
+    m_terrain.removeTile(coord);
+    m_resident.erase(cellKey(coord));
+    m_stats.totalUnloaded++;
+    ENGINE_LOG_DEBUG("WorldStreamer: célula ({}, {}) descarregada.", coord.x, coord.z);
+}
+
+void WorldStreamer::preload(const glm::vec3& focus, float radius) {
+    auto preloadStart = std::chrono::steady_clock::now();
+    m_focus = glm::vec2(focus.x, focus.z);
+    const Terrain::TileCoord first = m_terrain.tileAt(focus.x - radius, focus.z - radius);
+    const Terrain::TileCoord last = m_terrain.tileAt(focus.x + radius, focus.z + radius);
+    size_t loaded = 0;
+    for (int32_t z = first.z; z <= last.z; ++z) {
+        for (int32_t x = first.x; x <= last.x; ++x) {
+            const Terrain::TileCoord coord{x, z};
+            if (m_resident.size() >= m_capacity || !m_terrain.isInsideWorld(coord) || m_resident.count(cellKey(coord)) > 0 ||
+                cellDistance(coord, m_focus) > radius) {
+                continue;
+            }
+            m_pending.emplace(cellKey(coord), coord);
+            integrate(CellBundleCooker::load(m_terrain, coord));
+            loaded++;
+        }
+    }
+    Engine::Log::Info(std::format("WorldStreamer: {} células pré-carregadas em {:.1f} ms.", loaded,
+                                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - preloadStart).count()));
+}
+
+void WorldStreamer::update(const glm::vec3& focus, const glm::vec3& viewDirection) {
+    ENGINE_PROFILE_SCOPE("WorldStreamer::update");
+    auto updateStart = std::chrono::steady_clock::now();
+    m_focus = glm::vec2(focus.x, focus.z);
+    glm::vec2 view(viewDirection.x, viewDirection.z);
+    const float viewLength = glm::length(view);
+    view = viewLength > 0.0f ? view / viewLength : glm::vec2(0.0f);
+
+    // 1. Integra poucas células prontas por frame (as demais ficam para os próximos)
+    std::vector<std::unique_ptr<CellBundle>> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const size_t count = std::min(m_completed.size(), static_cast<size_t>(std::max(1, Engine::WORLD_STREAMING_MAX_INTEGRATIONS_PER_FRAME)));
+        for (size_t i = 0; i < count; ++i) {
+            ready.push_back(std::move(m_completed[i]));
+        }
+        m_completed.erase(m_completed.begin(), m_completed.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+    for (std::unique_ptr<CellBundle>& bundle : ready) {
+        integrate(std::move(bundle));
+    }
+
+    // 2. Descarrega o que passou do raio de histerese
+    std::vector<Terrain::TileCoord> outside;
+    for (const auto& [key, coord] : m_resident) {
+        if (cellDistance(coord, m_focus) > Engine::WORLD_STREAMING_UNLOAD_RADIUS) {
+            outside.push_back(coord);
+        }
+    }
+    for (const Terrain::TileCoord& coord : outside) {
+        unload(coord);
+    }
+
+    // 3. Células do raio de carga ainda não residentes nem pedidas, por prioridade
+    const float loadRadius = Engine::WORLD_STREAMING_LOAD_RADIUS;
+    const Terrain::TileCoord first = m_terrain.tileAt(focus.x - loadRadius, focus.z - loadRadius);
+    const Terrain::TileCoord last = m_terrain.tileAt(focus.x + loadRadius, focus.z + loadRadius);
+    m_candidates.clear();
+    for (int32_t z = first.z; z <= last.z; ++z) {
+        for (int32_t x = first.x; x <= last.x; ++x) {
+            const Terrain::TileCoord coord{x, z};
+            const uint64_t key = cellKey(coord);
+            if (!m_terrain.isInsideWorld(coord) || m_resident.count(key) > 0 || m_pending.count(key) > 0 ||
+                cellDistance(coord, m_focus) > loadRadius) {
+                continue;
+            }
+            m_candidates.push_back({coord, cellPriority(coord, m_focus, view)});
+        }
+    }
+    std::sort(m_candidates.begin(), m_candidates.end(), [](const Request& a, const Request& b) { return a.priority < b.priority; });
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // 4. Pedidos ainda na fila que saíram do raio são cancelados; os demais ganham prioridade nova
+        auto cancelled = std::partition(m_queue.begin(), m_queue.end(), [this, loadRadius](const Request& request) {
+            return cellDistance(request.coord, m_focus) <= loadRadius;
+        });
+        for (auto it = cancelled; it != m_queue.end(); ++it) {
+            m_pending.erase(cellKey(it->coord));
+        }
+        m_queue.erase(cancelled, m_queue.end());
+        for (Request& request : m_queue) {
+            request.priority = cellPriority(request.coord, m_focus, view);
+        }
+
+        // 5. Orçamento: abre espaço tirando residentes da faixa de histerese (as mais distantes primeiro)
+        size_t used = m_resident.size() + m_pending.size();
+        if (used + m_candidates.size() > m_capacity) {
+            std::vector<std::pair<float, Terrain::TileCoord>> band;
+            for (const auto& [key, coord] : m_resident) {
+                const float distance = cellDistance(coord, m_focus);
+                if (distance > loadRadius) {
+                    band.emplace_back(distance, coord);
+                }
+            }
+            std::sort(band.begin(), band.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+            for (const auto& [distance, coord] : band) {
+                if (used + m_candidates.size() <= m_capacity) {
+                    break;
+                }
+                unload(coord);
+                used--;
+            }
+        }
+        const size_t freeSlots = m_capacity > used ? m_capacity - used : 0;
+        if (m_candidates.size() > freeSlots) {
+            m_candidates.resize(freeSlots); // As de menor prioridade esperam espaço
+        }
+
+        for (const Request& request : m_candidates) {
+            m_queue.push_back(request);
+            m_pending.emplace(cellKey(request.coord), request.coord);
+        }
+        std::sort(m_queue.begin(), m_queue.end(), [](const Request& a, const Request& b) { return a.priority > b.priority; });
+    }
+    if (!m_candidates.empty()) {
+        m_wake.notify_all();
+    }
+
+    m_stats.residentCells = m_resident.size();
+    m_stats.pendingCells = m_pending.size();
+    m_stats.residentBytes = m_resident.size() * Terrain::TerrainSystem::getTileBytes();
+    m_stats.averageLoadMs = m_stats.totalLoaded > 0 ? m_totalLoadMs / static_cast<double>(m_stats.totalLoaded) : 0.0;
+    m_stats.lastUpdateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+}
+
+void WorldStreamer::logReport() const {
+    Engine::Log::Info(std::format("WorldStreamer: {} células residentes ({:.1f} de {:.1f} MB), {} pendentes, {} carregadas "
+                                  "({} do cache, {:.2f} ms em média), {} descarregadas, {} descartadas, update {:.3f} ms.",
+                                  m_stats.residentCells, m_stats.residentBytes / (1024.0 * 1024.0), m_stats.budgetBytes / (1024.0 * 1024.0),
+                                  m_stats.pendingCells, m_stats.totalLoaded, m_stats.cacheHits, m_stats.averageLoadMs, m_stats.totalUnloaded,
+                                  m_stats.totalDiscarded, m_stats.lastUpdateMs));
+}
+
+} // namespace World
+} // namespace Engine
@@ -0,0 +1,100 @@
+// engine/world/world_streamer.h
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "cell_bundle.h"
+
+namespace Engine {
+namespace Terrain {
+    class TerrainSystem;
+}
+namespace World {
+
+// Estado do streaming no último update (para o log periódico)
+struct StreamingStats {
+    uint64_t residentCells = 0;
+    uint64_t pendingCells = 0;      // Na fila ou carregando
+    uint64_t residentBytes = 0;
+    uint64_t budgetBytes = 0;
+    uint64_t totalLoaded = 0;
+    uint64_t totalUnloaded = 0;
+    uint64_t totalDiscarded = 0;    // Prontas depois de saírem do raio (descartadas sem integrar)
+    uint64_t cacheHits = 0;         // Células lidas de pacotes cozidos
+    double averageLoadMs = 0.0;     // Nas threads de carregamento
+    double lastUpdateMs = 0.0;      // Custo de update() na thread principal
+};
+
+// Streaming do mundo em células (os tiles do terreno): threads dedicadas montam os pacotes das
+// células dentro de WORLD_STREAMING_LOAD_RADIUS em volta do foco (jogador), por ordem de distância
+// e direção da câmera; células além de WORLD_STREAMING_UNLOAD_RADIUS saem. A thread principal só
+// integra poucas células prontas por frame (o upload GL vai na CommandList), então atravessar uma
+// zona nunca trava o frame. O total residente nunca passa do orçamento WORLD_STREAMING_BUDGET_MB.
+class WorldStreamer {
+public:
+    explicit WorldStreamer(Terrain::TerrainSystem& terrain);
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    // Máximo de células residentes pelo orçamento (também a capacidade de camadas do terreno)
+    static size_t getCellCapacity();
+
+    // Carrega de forma síncrona as células até 'radius' do foco (antes do primeiro frame)
+    void preload(const glm::vec3& focus, float radius);
+    // Por frame, na thread principal: integra células prontas, descarta as distantes e atualiza a fila
+    void update(const glm::vec3& focus, const glm::vec3& viewDirection);
+
+    const StreamingStats& getStats() const { return m_stats; }
+    // Uma linha com o estado de getStats() (relatório periódico da aplicação)
+    void logReport() const;
+
+private:
+    struct Request {
+        Terrain::TileCoord coord;
+        float priority; // Menor = antes
+    };
+
+    void loaderMain();
+    // Distância (xz) do foco ao retângulo da célula: 0 dentro da célula do jogador
+    float cellDistance(Terrain::TileCoord coord, const glm::vec2& focus) const;
+    float cellPriority(Terrain::TileCoord coord, const glm::vec2& focus, const glm::vec2& viewDirection) const;
+    void integrate(std::unique_ptr<CellBundle> bundle);
+    void unload(Terrain::TileCoord coord);
+
+    static uint64_t cellKey(Terrain::TileCoord coord) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(coord.z)) << 32) | static_cast<uint32_t>(coord.x);
+    }
+
+    Terrain::TerrainSystem& m_terrain;
+    size_t m_capacity = 0;
+
+    // Só a thread principal
+    std::map<uint64_t, Terrain::TileCoord> m_resident;
+    std::map<uint64_t, Terrain::TileCoord> m_pending; // Pedidas e ainda não integradas (fila ou carregando)
+    std::vector<Request> m_candidates;                // Reaproveitado entre frames
+    glm::vec2 m_focus{0.0f};
+    StreamingStats m_stats;
+    double m_totalLoadMs = 0.0;
+
+    // Compartilhado com as threads de carregamento (m_mutex)
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::vector<Request> m_queue; // Ordenada por prioridade decrescente (a melhor no fim)
+    std::vector<std::unique_ptr<CellBundle>> m_completed;
+    bool m_stop = false;
+
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace World
+} // namespace Engine
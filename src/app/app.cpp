@@ -5,6 +5,12 @@
 #include "input.h"                       
 #include "scene.h"                       
 #include "./../../engine/core/log.h"     
+#include "./../../engine/core/config.h"
+#include "./../../engine/core/fixed_timestep.h"
+#include "./../../engine/core/profiler.h"
+#include "./../../engine/memory/allocation_counters.h"
+#include "./../../engine/memory/frame_arena.h"
+#include "./../../engine/memory/memory_tracker.h"
 
 // **** MUDANÇA AQUI: Incluir explicitamente o InputManager.h (agora no namespace correto) ****
 #include "./../../engine/input/input_manager.h" 
@@ -22,6 +28,7 @@ App::~App() = default;
 
 void App::run() {
     Engine::Log::Info("[App] Iniciando aplica├º├úo");
+    Engine::Profiling::Profiler::setThreadName("Principal");
 
     Engine::WindowConfig winConfig;
     winConfig.width = 1280; 
@@ -46,7 +53,7 @@ void App::run() {
 
     m_renderer = std::make_unique<Engine::Renderer>(*m_window, scene.getCamera()); 
     m_renderer->setClearColor(0.1f, 0.1f, 0.1f, 1.0f); 
-    m_renderer->setProjectionMatrix(45.0f, 0.1f, 500.0f); 
+    m_renderer->setProjectionMatrix(45.0f, Engine::CAMERA_NEAR_PLANE, Engine::CAMERA_FAR_PLANE); 
     Engine::Log::Info("[App] Renderer inicializado e configurado.");
 
     setup_application_input(glfwWindow, scene.getCamera(), scene, 0.0f); 
@@ -55,14 +62,30 @@ void App::run() {
     scene.initialize(); 
     Engine::Log::Info("[App] Cena inicializada com sucesso.");
 
-    float lastFrame = 0.0f;
-    float deltaTime = 0.0f;
+    // Carregamentos GL terminaram: a partir daqui o contexto pertence à thread de renderização
+    m_renderer->startRenderThread();
+
+    // A simulação anda em passos fixos; o desenho interpola entre os dois últimos estados
+    Engine::FixedTimestep timestep(1.0 / static_cast<double>(Engine::SIMULATION_TICK_RATE), Engine::SIMULATION_MAX_STEPS_PER_FRAME);
+    double lastFrame = m_window->getTime();
+    double lastReport = lastFrame;
+    uint64_t reportSteps = 0;
+    uint64_t reportDropped = 0;
+    uint64_t reportFrames = 0;
 
     while (!m_window->shouldClose()) { 
-        float currentFrame = m_window->getTime(); 
-        deltaTime = currentFrame - lastFrame;
+        double currentFrame = m_window->getTime(); 
+        double deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
 
+        // Marca o limite do frame para o profiler (e grava a captura pedida com F7) antes de abrir a zona dele
+        Engine::Profiling::Profiler::beginFrame();
+        ENGINE_PROFILE_SCOPE("Frame");
+
+        // Fecha os contadores de alocação do frame anterior e troca o slot da memória temporária do frame
+        Engine::Memory::AllocationCounters::beginFrame();
+        Engine::Memory::FrameArena::Get().beginFrame();
+
         if (Engine::Input::InputManager::Get().IsKeyPressed(GLFW_KEY_F11)) {
             if (m_window->isMaximized()) {
                 m_window->restore();
@@ -77,13 +100,64 @@ void App::run() {
             std::this_thread::sleep_for(std::chrono::milliseconds(200)); 
         }
 
-        // **** MUDANÇA AQUI: Chamar Scene::update com InputManager (agora no namespace correto) ****
-        scene.update(deltaTime, static_cast<const Engine::Input::InputManager&>(Engine::Input::InputManager::Get())); 
+        if (Engine::Input::InputManager::Get().IsKeyPressed(GLFW_KEY_F9)) {
+            // Alterna forward/deferred para comparar tempos de frame na mesma cena
+            m_renderer->setRenderPath(m_renderer->getRenderPath() == Engine::Render::RenderPath::Forward
+                                          ? Engine::Render::RenderPath::Deferred
+                                          : Engine::Render::RenderPath::Forward);
+            std::this_thread::sleep_for(std::chrono::milliseconds(200)); 
+        }
+
+        if (Engine::Input::InputManager::Get().IsKeyPressed(GLFW_KEY_F8)) {
+            // Liga/desliga o pré-pass de profundidade (o log compara os tempos de GPU dos passes)
+            m_renderer->setDepthPrepass(!m_renderer->getDepthPrepass());
+            std::this_thread::sleep_for(std::chrono::milliseconds(200)); 
+        }
+
+        if (Engine::Input::InputManager::Get().IsKeyPressed(GLFW_KEY_F7)) {
+            // Grava os últimos frames no formato do Chrome (PROFILER_TRACE_DIR)
+            Engine::Profiling::Profiler::requestCapture(Engine::PROFILER_CAPTURE_FRAMES);
+            std::this_thread::sleep_for(std::chrono::milliseconds(200)); 
+        }
+
+        const int steps = timestep.advance(deltaTime);
+        const float step = static_cast<float>(timestep.getStep());
+        for (int i = 0; i < steps; ++i) {
+            scene.update(step, static_cast<const Engine::Input::InputManager&>(Engine::Input::InputManager::Get())); 
+        }
+        scene.setInterpolation(Engine::SIMULATION_INTERPOLATION ? timestep.getAlpha() : 1.0f, step);
+        scene.updateWorld();
+
+        ++reportFrames;
+        if (currentFrame - lastReport >= 5.0) {
+            // Passos por frame e atraso descartado (frames lentos demais para o limite de passos)
+            const uint64_t dropped = timestep.getDroppedSteps() - reportDropped;
+            const uint64_t simulated = timestep.getTotalSteps() - reportSteps;
+            Engine::Log::Info(std::format("[App] Simulação: {} passos em {} frames ({:.2f} por frame), {} passo(s) descartado(s).",
+                                          simulated, reportFrames, static_cast<double>(simulated) / static_cast<double>(reportFrames), dropped));
+            // Cada subsistema imprime o próprio relatório; o Renderer mantém o dele (desenho e GPU) no render()
+            scene.logReport();
+            Engine::Memory::AllocationCounters::logFrameReport();
+            Engine::Memory::FrameArena::Get().logReport();
+            Engine::Memory::MemoryTracker::logReport();
+            reportSteps = timestep.getTotalSteps();
+            reportDropped = timestep.getDroppedSteps();
+            reportFrames = 0;
+            lastReport = currentFrame;
+        }
+
+        // Grava o frame N e o entrega à thread de renderização; o swap acontece lá,
+        // enquanto esta thread já segue para a simulação do frame N+1
         m_renderer->render(scene); 
 
-        m_window->swapBuffersAndPollEvents(); 
+        {
+            ENGINE_PROFILE_SCOPE("Window::pollEvents");
+            m_window->pollEvents(); 
+        }
     }
 
+    // Esvazia a fila e devolve o contexto GL antes de destruir recursos da cena
+    m_renderer->stopRenderThread();
     Engine::Log::Info("[App] Encerrando aplica├º├úo.");
     glfwTerminate(); 
 }
\ No newline at end of file
@@ -27,12 +27,12 @@ void setup_application_input(GLFWwindow *window, Engine::Camera::ICamera &camera
                                   [window, &camera](const Engine::Input::InputEventData &data) { // **** MUDANÇA AQUI ****
                                       glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
                                       camera.resetMouseState();
-                                      Engine::Log::Debug("src/app/input.cpp: Botão direito do mouse pressionado. Cursor desabilitado e estado da câmera resetado.");
+                                      ENGINE_LOG_DEBUG("src/app/input.cpp: Botão direito do mouse pressionado. Cursor desabilitado e estado da câmera resetado.");
                                   });
     inputManager.RegisterCallback(Engine::Input::InputEvent::MouseButtonReleased, GLFW_MOUSE_BUTTON_RIGHT,
                                   [window](const Engine::Input::InputEventData &data) { // **** MUDANÇA AQUI ****
                                       glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
-                                      Engine::Log::Debug("src/app/input.cpp: Botão direito do mouse solto. Cursor normal.");
+                                      ENGINE_LOG_DEBUG("src/app/input.cpp: Botão direito do mouse solto. Cursor normal.");
                                   });
 
     inputManager.RegisterCallback(Engine::Input::InputEvent::MouseMoved, 0,
@@ -49,7 +49,7 @@ void setup_application_input(GLFWwindow *window, Engine::Camera::ICamera &camera
     inputManager.RegisterCallback(Engine::Input::InputEvent::MouseScrolled, 0,
                                   [&camera](const Engine::Input::InputEventData &data) { // **** MUDANÇA AQUI ****
                                       camera.processScroll(data.yoffset);
-                                      Engine::Log::Debug(std::format("src/app/input.cpp: Scroll Y: {}", data.yoffset));
+                                      ENGINE_LOG_DEBUG("src/app/input.cpp: Scroll Y: {}", data.yoffset);
                                   });
 
     inputManager.RegisterCallback(Engine::Input::InputEvent::KeyPressed, GLFW_KEY_ESCAPE,
@@ -62,5 +62,5 @@ void setup_application_input(GLFWwindow *window, Engine::Camera::ICamera &camera
 // Adaptação da função process_continuous_input para usar o GameObject do personagem
 void process_continuous_input(Engine::Game::GameObject *playerCharacter, float deltaTime)
 {
-    Engine::Log::Trace("process_continuous_input: Chamado. Lógica de input do personagem movida para GameObject::update().");
+    ENGINE_LOG_TRACE("process_continuous_input: Chamado. Lógica de input do personagem movida para GameSystems::updatePlayerControl().");
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "./../../engine/render/shader.h"
 #include "./../../engine/core/log.h"
 #include "./../../engine/core/path_utils.h"
+#include "./../../engine/core/profiler.h"
+#include "./../../engine/memory/allocation_counters.h"
 
 #include "./../../engine/render/camera/free_camera.h"
 #include "./../../engine/render/camera/orbit_camera.h"
@@ -17,12 +19,27 @@
 #include "./../../engine/asset/gltf_loader.h"
 #include "./../../engine/game/game_object.h"
 #include "./../../engine/game/player_character.h"
+#include "./../../engine/game/game_systems.h"
 #include "./../../engine/input/input_manager.h"
+#include "./../../engine/asset/model.h"
+#include "./../../engine/render/lod_selector.h"
+#include "./../../engine/render/command_list.h"
+#include "./../../engine/core/worker_pool.h"
+#include "./../../engine/render/shadow_map.h"
+#include "./../../engine/render/gbuffer.h"
+#include "./../../engine/render/gpu_profiler.h"
+#include "./../../engine/render/meshlet_culling.h"
+#include "./../../engine/terrain/terrain_system.h"
+#include "./../../engine/world/world_streamer.h"
+#include "./../../engine/vegetation/vegetation_system.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/string_cast.hpp>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <random>
 #include <memory>
 
 #include "./../../engine/core/config.h"
@@ -42,6 +59,16 @@ namespace Engine
       m_camera = std::make_unique<Engine::Camera::OrbitCamera>();
     }
 
+    // Entrada do jogador antes do movimento; o jogador é uma entidade só e adiciona marcas direto no Registry
+    m_systems.addSystem("playerControl")
+        .exclusive()
+        .run([this](Engine::Ecs::SystemContext &context)
+             { Engine::Game::GameSystems::updatePlayerControl(context.registry, context.deltaTime, *m_stepInput, *m_camera); });
+    m_systems.addSystem("integrateVelocity")
+        .writes<Engine::Ecs::Transform, Engine::Ecs::TransformDirty>()
+        .runParallel<Engine::Ecs::Velocity>(&Engine::Game::GameSystems::integrateVelocity, 1024);
+    m_systems.setDeterministic(Engine::ECS_SCHEDULER_DETERMINISTIC);
+
     Engine::Log::Info(std::format("Engine::Scene::Scene() - Construtor chamado. Câmera inicial: {}",
                                   Engine::CAMERA_DEFAULT_IS_FREE ? "FreeCamera" : "OrbitCamera"));
   }
@@ -65,26 +92,106 @@ namespace Engine
       return;
     }
 
-    // 1. GameObject do Terreno
     try
     {
-      auto terrainModel = Engine::Asset::GLTFLoader::loadGLTF("assets/models/map_test.glb");
-      if (terrainModel)
+      m_shadowShader = std::make_unique<Engine::Render::Shader>("engine/shaders/shadow_depth.vert", "engine/shaders/shadow_depth.frag");
+    }
+    catch (const std::exception &e)
+    {
+      // Sem o shader de profundidade a cena continua, só sem sombras
+      Engine::Log::Error(std::format("Erro ao carregar shader de sombra: {}", e.what()));
+    }
+    m_shadowMap = std::make_shared<Engine::Render::ShadowMap>(Engine::SHADOW_MAP_SIZE, Engine::SHADOW_CASCADE_COUNT);
+
+    try
+    {
+      // Modo deferred: mesmo vertex shader e mesmos materiais, G-buffer + resolve em tela cheia
+      m_gbufferShader = std::make_unique<Engine::Render::Shader>("engine/shaders/basic.vert", "engine/shaders/gbuffer.frag");
+      m_deferredLightingShader = std::make_unique<Engine::Render::Shader>("engine/shaders/deferred_lighting.vert", "engine/shaders/deferred_lighting.frag");
+      m_gbuffer = std::make_shared<Engine::Render::GBuffer>();
+    }
+    catch (const std::exception &e)
+    {
+      Engine::Log::Error(std::format("Erro ao carregar shaders do deferred (modo forward continua disponível): {}", e.what()));
+      m_gbufferShader.reset();
+      m_deferredLightingShader.reset();
+    }
+
+    try
+    {
+      // Pré-pass de profundidade: só o stream de posições das meshes
+      m_depthPrepassShader = std::make_unique<Engine::Render::Shader>("engine/shaders/depth_prepass.vert", "engine/shaders/depth_prepass.frag");
+    }
+    catch (const std::exception &e)
+    {
+      Engine::Log::Error(std::format("Erro ao carregar shader do pré-pass de profundidade (pré-pass desativado): {}", e.what()));
+    }
+
+    // 1. Terreno: heightmap em tiles com CDLOD ou, desligado, o mapa estático em glTF
+    if (Engine::TERRAIN_ENABLED)
+    {
+      try
       {
-        auto terrainObject = std::make_unique<Engine::Game::GameObject>(std::move(terrainModel));
-        terrainObject->name = "Terrain";
-        terrainObject->setPosition(glm::vec3(0.0f, 0.0f, 0.0f));
-        m_gameObjects.push_back(std::move(terrainObject));
-        Engine::Log::Info("GameObject Terreno carregado e adicionado à cena!");
+        m_terrainShader = std::make_unique<Engine::Render::Shader>("engine/shaders/terrain.vert", "engine/shaders/basic.frag");
+        m_terrainGBufferShader = std::make_unique<Engine::Render::Shader>("engine/shaders/terrain.vert", "engine/shaders/gbuffer.frag");
+        m_terrain = std::make_unique<Engine::Terrain::TerrainSystem>();
+        if (Engine::WORLD_STREAMING_ENABLED)
+        {
+          // Só as células em volta do jogador ficam residentes; as do ponto de partida já no primeiro frame
+          m_terrain->initialize(Engine::World::WorldStreamer::getCellCapacity());
+          m_worldStreamer = std::make_unique<Engine::World::WorldStreamer>(*m_terrain);
+          m_worldStreamer->preload(glm::vec3(0.0f), Engine::WORLD_STREAMING_PRELOAD_RADIUS);
+        }
+        else
+        {
+          m_terrain->initialize(static_cast<size_t>(Engine::TERRAIN_TILES_X) * static_cast<size_t>(Engine::TERRAIN_TILES_Z));
+          m_terrain->loadAllTiles();
+        }
       }
-      else
+      catch (const std::exception &e)
       {
-        Engine::Log::Error("Falha ao criar GameObject do Terreno: Modelo nulo.");
+        Engine::Log::Error(std::format("Erro ao criar o terreno: {}", e.what()));
+        m_worldStreamer.reset();
+        m_terrain.reset();
+      }
+
+      if (m_terrain && m_terrain->isReady() && Engine::VEGETATION_ENABLED)
+      {
+        try
+        {
+          m_vegetationShader = std::make_unique<Engine::Render::Shader>("engine/shaders/vegetation.vert", "engine/shaders/basic.frag");
+          m_vegetationGBufferShader = std::make_unique<Engine::Render::Shader>("engine/shaders/vegetation.vert", "engine/shaders/gbuffer.frag");
+          m_vegetation = std::make_unique<Engine::Vegetation::VegetationSystem>();
+          m_vegetation->initialize(*m_terrain);
+        }
+        catch (const std::exception &e)
+        {
+          Engine::Log::Error(std::format("Erro ao criar a vegetação (desativada): {}", e.what()));
+          m_vegetation.reset();
+        }
       }
     }
-    catch (const std::exception &e)
+    else
     {
-      Engine::Log::Error(std::format("Erro ao carregar GameObject do Terreno: {}", e.what()));
+      try
+      {
+        auto terrainModel = Engine::Asset::GLTFLoader::loadGLTF("assets/models/map_test.glb");
+        if (terrainModel)
+        {
+          Engine::Game::GameObject terrainObject(m_registry, std::move(terrainModel));
+          terrainObject.setName("Terrain");
+          terrainObject.setPosition(glm::vec3(0.0f, 0.0f, 0.0f));
+          Engine::Log::Info("GameObject Terreno carregado e adicionado à cena!");
+        }
+        else
+        {
+          Engine::Log::Error("Falha ao criar GameObject do Terreno: Modelo nulo.");
+        }
+      }
+      catch (const std::exception &e)
+      {
+        Engine::Log::Error(std::format("Erro ao carregar GameObject do Terreno: {}", e.what()));
+      }
     }
 
     // 2. GameObject do Personagem (Cubo Simulado)
@@ -93,12 +200,8 @@ namespace Engine
       auto characterModel = Engine::Asset::GLTFLoader::loadGLTF("assets/models/character_placeholder.glb");
       if (characterModel)
       {
-        auto characterObject = std::make_unique<Engine::Game::PlayerCharacter>(std::move(characterModel));
-        characterObject->name = "PlayerCharacter";
-        characterObject->setPosition(glm::vec3(0.0f, 0.9f, 0.0f));
-
-        m_playerCharacter = characterObject.get();
-        m_gameObjects.push_back(std::move(characterObject));
+        m_playerCharacter = std::make_unique<Engine::Game::PlayerCharacter>(m_registry, std::move(characterModel));
+        m_playerCharacter->setPosition(glm::vec3(0.0f, groundHeight(0.0f, 0.0f) + kCharacterGroundOffset, 0.0f));
         Engine::Log::Info("GameObject Personagem (cubo) carregado e adicionado à cena!");
 
         if (!Engine::CAMERA_DEFAULT_IS_FREE && m_playerCharacter)
@@ -106,8 +209,8 @@ namespace Engine
           m_camera->setTarget(m_playerCharacter->getPosition());
           // NOVO: Sincronizar yaw da câmera com o yaw inicial do personagem
           m_camera->setYaw(m_playerCharacter->getRotationYaw());
-          Engine::Log::Debug(std::format("OrbitCamera target set to PlayerCharacter at {}. Initial Yaw: {}.",
-                                         glm::to_string(m_playerCharacter->getPosition()), m_playerCharacter->getRotationYaw()));
+          ENGINE_LOG_DEBUG("OrbitCamera target set to PlayerCharacter at {}. Initial Yaw: {}.",
+                           glm::to_string(m_playerCharacter->getPosition()), m_playerCharacter->getRotationYaw());
         }
       }
       else
@@ -125,7 +228,7 @@ namespace Engine
 
     if (Engine::CAMERA_DEFAULT_IS_FREE)
     {
-      m_camera->setPosition(glm::vec3(25.0f, 15.0f, 25.0f));
+      m_camera->setPosition(glm::vec3(25.0f, groundHeight(25.0f, 25.0f) + 15.0f, 25.0f));
     }
     else
     {
@@ -134,27 +237,91 @@ namespace Engine
     }
     Engine::Log::Info(std::format("Camera posicionada em {}", glm::to_string(m_camera->getPosition())));
 
+    if (Engine::LIGHT_STRESS_TEST_COUNT > 0)
+    {
+      spawnStressTestLights(static_cast<size_t>(Engine::LIGHT_STRESS_TEST_COUNT));
+    }
+
+    // Matrizes da cena inicial: o primeiro frame pode ser desenhado antes do primeiro passo
+    m_transforms.update(m_registry);
+
     Engine::Log::Info("Engine::Scene::initialize() - fim");
   }
 
   // src/app/scene.cpp (relevant Scene::update() method)
   void Scene::update(float deltaTime, const Input::InputManager &inputManager)
   {
+    ENGINE_PROFILE_SCOPE("Scene::update");
+    Engine::Memory::AllocationScope allocationScope(Engine::Memory::MemoryTag::Game);
+    m_time += deltaTime;
+
+    // Sistemas de jogo sobre os pools de componentes (entrada do jogador, depois movimento), em paralelo
+    // onde os componentes declarados não conflitam
+    m_stepInput = &inputManager;
+    {
+      ENGINE_PROFILE_SCOPE("SystemScheduler::run");
+      m_systems.run(m_registry, deltaTime);
+    }
+    m_stepInput = nullptr;
+
     if (m_playerCharacter)
     {
-      // **** MUDANÇA: Passar a câmera para o PlayerCharacter::update ****
-      m_playerCharacter->update(deltaTime, inputManager, *m_camera);
+      if (m_terrain && m_terrain->isReady())
+      {
+        // Sem física ainda: o personagem acompanha a altura do terreno (mantém a altura se a célula não carregou)
+        glm::vec3 position = m_playerCharacter->getPosition();
+        float height = 0.0f;
+        if (m_terrain->tryGetHeight(position.x, position.z, height) && position.y != height + kCharacterGroundOffset)
+        {
+          position.y = height + kCharacterGroundOffset;
+          m_playerCharacter->setPosition(position);
+        }
+      }
       // Se a câmera é OrbitCamera, ela deve seguir o personagem após o update dele.
       if (!Engine::CAMERA_DEFAULT_IS_FREE)
       {
         m_camera->setTarget(m_playerCharacter->getPosition());
-        // **** REMOVIDO: Sincronização de yaw aqui (feito em PlayerCharacter::update) ****
+        // **** REMOVIDO: Sincronização de yaw aqui (feito em GameSystems::updatePlayerControl) ****
         // m_camera->setYaw(m_playerCharacter->getRotationYaw());
       }
     }
+
+    // Matrizes de mundo de tudo o que se moveu neste passo (objetos parados não custam nada)
+    m_transforms.update(m_registry);
+  }
+
+  void Scene::updateWorld()
+  {
+    Engine::Memory::AllocationScope allocationScope(Engine::Memory::MemoryTag::World);
+    // Foco do streaming e da vegetação: o jogador (ou a câmera livre)
+    const glm::vec3 focus = m_playerCharacter && !Engine::CAMERA_DEFAULT_IS_FREE ? m_playerCharacter->getPosition() : m_camera->getPosition();
+    if (m_worldStreamer)
+    {
+      // A direção da câmera adianta as células à frente
+      m_worldStreamer->update(focus, m_camera->getForwardVector());
+    }
+    if (m_vegetation)
+    {
+      m_vegetation->update(focus, *m_terrain);
+    }
+  }
+
+  void Scene::setInterpolation(float alpha, float stepSeconds)
+  {
+    m_renderAlpha = std::clamp(alpha, 0.0f, 1.0f);
+    m_renderTime = m_time - (1.0f - m_renderAlpha) * stepSeconds;
+
+    // A câmera orbital segue a posição desenhada do personagem, não a do último passo (sem tremer
+    // quando a taxa de quadros não é múltipla da taxa de simulação)
+    if (m_playerCharacter && !Engine::CAMERA_DEFAULT_IS_FREE)
+    {
+      const glm::mat4 playerMatrix = m_transforms.getRenderMatrix(m_playerCharacter->getEntity(), m_renderAlpha);
+      m_camera->setTarget(glm::vec3(playerMatrix[3]));
+    }
   }
 
-  void Scene::render(const glm::mat4 &projection, const glm::mat4 &view) const
+  void Scene::render(Engine::Render::CommandList &commands, const glm::mat4 &projection, const glm::mat4 &view,
+                     const Engine::Render::FrameSettings &settings) const
   {
     if (!shader)
     {
@@ -162,30 +329,540 @@ namespace Engine
       return;
     }
 
-    shader->use();
+    // Nada aqui chama OpenGL: esta função roda na thread principal, sem o contexto GL
+    ENGINE_PROFILE_SCOPE("Scene::render");
+    m_renderStats.reset();
+
+    // Cascatas de sombra antes do pass principal (usam a LOD escolhida no frame anterior)
+    {
+      ENGINE_PROFILE_SCOPE("Scene::recordShadows");
+      recordShadows(commands, view, projection);
+    }
+
+    ENGINE_LOG_DEBUG("Camera pos: {}", glm::to_string(m_camera->getPosition()));
+    ENGINE_LOG_DEBUG("View matrix:\n{}", glm::to_string(view));
+    ENGINE_LOG_DEBUG("Projection matrix:\n{}", glm::to_string(projection));
+
+    // Luzes pontuais: binning nos froxels (o upload é gravado junto com os uniforms de iluminação)
+    m_clusteredLighting.build(m_pointLights, view, projection);
 
-    GLint currentProgram = 0;
-    glGetIntegerv(GL_CURRENT_PROGRAM, &currentProgram);
-    Engine::Log::Debug(std::format("[DEBUG] Shader ativo OpenGL: {} | Shader ID: {}", currentProgram, shader->getID()));
+    auto recordStart = std::chrono::steady_clock::now();
 
-    Engine::Log::Debug(std::format("Camera pos: {}", glm::to_string(m_camera->getPosition())));
-    Engine::Log::Debug(std::format("View matrix:\n{}", glm::to_string(view)));
-    Engine::Log::Debug(std::format("Projection matrix:\n{}", glm::to_string(projection)));
+    RecordContext context{Engine::Render::Frustum(projection * view), m_camera->getPosition(),
+                          projection[1][1], // projection[1][1] = 1 / tan(fov / 2)
+                          projection * view};
 
-    shader->setMat4("uProjection", projection);
-    shader->setMat4("uView", view);
+    // Culling, LOD e pacotes em jobs sobre faixas do array denso de MeshRef; cada job escreve só no próprio buffer
+    const Engine::Ecs::ComponentPool<Engine::Ecs::MeshRef> *meshRefs = m_registry.findPool<Engine::Ecs::MeshRef>();
+    const size_t objectCount = meshRefs ? meshRefs->size() : 0;
+    const size_t grainSize = static_cast<size_t>(Engine::RENDER_RECORD_OBJECTS_PER_JOB);
+    const size_t jobCount = Engine::WorkerPool::chunkCount(objectCount, grainSize);
+    m_jobPackets.resize(jobCount);
+    m_jobStats.resize(jobCount);
+    m_jobRanges.resize(jobCount);
 
-    shader->setVec3("uLightPos", glm::vec3(50.0f, 50.0f, 50.0f));
-    shader->setVec3("uViewPos", m_camera->getPosition());
+    Engine::WorkerPool::Get().parallelFor(objectCount, grainSize, [&](size_t job, size_t begin, size_t end)
+    {
+      ENGINE_PROFILE_SCOPE("Scene::recordObjects");
+      std::vector<Engine::Render::DrawPacket> &packets = m_jobPackets[job];
+      std::vector<Engine::Asset::IndexRange> &ranges = m_jobRanges[job];
+      Engine::Render::RenderStats &stats = m_jobStats[job];
+      packets.clear();
+      ranges.clear();
+      stats.reset();
+      for (size_t i = begin; i < end; ++i)
+      {
+        recordObject(packets, ranges, stats, m_transforms.getRenderMatrix(meshRefs->entityAt(i), m_renderAlpha), meshRefs->componentAt(i),
+                     static_cast<uint32_t>(i), context);
+      }
+    });
 
-    // Desenhar todos os GameObjects da cena
-    for (const auto &gameObject_ptr : m_gameObjects)
+    // Faixas de meshlets de cada job vão para a lista do frame; os pacotes passam a apontar para lá
+    for (size_t job = 0; job < jobCount; ++job)
     {
-      if (gameObject_ptr)
+      const uint32_t base = commands.appendIndexRanges(m_jobRanges[job]);
+      for (Engine::Render::DrawPacket &packet : m_jobPackets[job])
       {
-        gameObject_ptr->draw(*shader);
+        if (packet.command.rangeCount > 0)
+        {
+          packet.command.rangeOffset += base;
+        }
       }
     }
+
+    // Junção e ordenação determinística (independe do número de threads); a mesma lista
+    // ordenada alimenta o pré-pass e o pass principal
+    Engine::Render::CommandList::mergeDrawPackets(m_jobPackets, m_sortedPackets);
+
+    const bool deferred = settings.path == Engine::Render::RenderPath::Deferred && m_gbufferShader && m_deferredLightingShader;
+    if (deferred)
+    {
+      // Geometria no G-buffer; a iluminação acontece uma vez por pixel no resolve
+      auto gbuffer = m_gbuffer;
+      commands.upload([gbuffer]()
+                      { gbuffer->beginGeometryPass(); });
+    }
+
+    const bool prepass = settings.depthPrepass && m_depthPrepassShader;
+    if (prepass)
+    {
+      recordDepthPrepass(commands, view, projection);
+    }
+
+    commands.beginGpuZone("MainPass");
+    if (deferred)
+    {
+      commands.bindShader(m_gbufferShader.get());
+      commands.setUniform("uProjection", projection);
+      commands.setUniform("uView", view);
+    }
+    else
+    {
+      commands.bindShader(shader.get());
+      recordLightingUniforms(commands, view, projection);
+    }
+    commands.appendDrawPackets(m_sortedPackets);
+
+    if (prepass)
+    {
+      commands.setDepthState(GL_LESS, true); // Estado padrão para o terreno e os passes seguintes
+    }
+    recordTerrain(commands, view, projection, context, deferred);
+    recordVegetation(commands, view, projection, context, deferred);
+    commands.endGpuZone();
+
+    if (deferred)
+    {
+      recordDeferredResolve(commands, view, projection);
+    }
+
+    for (const Engine::Render::RenderStats &stats : m_jobStats)
+    {
+      m_renderStats.accumulate(stats);
+    }
+    if (prepass)
+    {
+      m_renderStats.drawCalls += m_sortedPackets.size();
+      m_renderStats.gpuPrepassMs = Engine::Render::GpuProfiler::Get().getPassMs("DepthPrepass");
+    }
+    m_renderStats.gpuMainPassMs = Engine::Render::GpuProfiler::Get().getPassMs("MainPass");
+    m_renderStats.recordJobs = jobCount;
+    m_renderStats.pointLights = m_pointLights.size();
+    m_renderStats.lightIndices = m_clusteredLighting.getGrid().getLightIndices().size();
+    m_renderStats.lightBinningMs = m_clusteredLighting.getGrid().getLastBuildMs();
+    m_renderStats.recordMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - recordStart).count();
+  }
+
+  void Scene::recordDepthPrepass(Engine::Render::CommandList &commands, const glm::mat4 &view, const glm::mat4 &projection) const
+  {
+    // Só profundidade, com o stream de posições; o pass principal depois testa com GL_EQUAL sem escrever,
+    // então cada pixel é sombreado uma única vez (sem overdraw no fragment shader caro)
+    commands.beginGpuZone("DepthPrepass");
+    commands.setDepthState(GL_LESS, true);
+    commands.bindShader(m_depthPrepassShader.get());
+    commands.setUniform("uProjection", projection);
+    commands.setUniform("uView", view);
+    commands.appendDrawPackets(m_sortedPackets, true);
+    commands.endGpuZone();
+    commands.setDepthState(GL_EQUAL, false);
+  }
+
+  void Scene::recordShadows(Engine::Render::CommandList &commands, const glm::mat4 &view, const glm::mat4 &projection) const
+  {
+    if (!Engine::SHADOWS_ENABLED || !m_shadowShader || !m_shadowMap)
+    {
+      return;
+    }
+
+    // Zonas por cascata nos profilers de CPU e GPU (literais: os dois só guardam o ponteiro)
+    static const char *const cascadeCpuZones[Engine::Render::kMaxShadowCascades] = {
+        "Scene::recordShadows/Cascade 0", "Scene::recordShadows/Cascade 1", "Scene::recordShadows/Cascade 2", "Scene::recordShadows/Cascade 3"};
+    static const char *const cascadeGpuZones[Engine::Render::kMaxShadowCascades] = {
+        "Shadows/Cascade 0", "Shadows/Cascade 1", "Shadows/Cascade 2", "Shadows/Cascade 3"};
+
+    m_shadowCascades.update(view, projection, m_sunDirection, m_staticGeometryVersion);
+    const int cascadeCount = m_shadowCascades.getCount();
+    m_shadowPackets.resize(static_cast<size_t>(cascadeCount));
+
+    // Culling de projetores por cascata, uma cascata por job; cascatas em cache não mudam neste frame
+    Engine::WorkerPool::Get().parallelFor(static_cast<size_t>(cascadeCount), 1, [&](size_t job, size_t, size_t)
+    {
+      const int index = static_cast<int>(job);
+      const Engine::Render::ShadowCascade &cascade = m_shadowCascades.getCascade(index);
+      std::vector<Engine::Render::DrawPacket> &packets = m_shadowPackets[job];
+      packets.clear();
+      if (!cascade.needsRender)
+      {
+        return;
+      }
+
+      ENGINE_PROFILE_SCOPE(cascadeCpuZones[job]);
+      auto cascadeStart = std::chrono::steady_clock::now();
+      const Engine::Ecs::ComponentPool<Engine::Ecs::MeshRef> *meshRefs = m_registry.findPool<Engine::Ecs::MeshRef>();
+      const size_t objectCount = meshRefs ? meshRefs->size() : 0;
+      for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+      {
+        const Engine::Ecs::Entity entity = meshRefs->entityAt(objectIndex);
+        const Engine::Ecs::MeshRef &meshRef = meshRefs->componentAt(objectIndex);
+        if (!meshRef.model || (cascade.cached && !m_registry.has<Engine::Ecs::StaticTag>(entity)))
+        {
+          continue; // Objetos dinâmicos só projetam sombra nas cascatas próximas
+        }
+
+        const glm::mat4 modelMatrix = m_transforms.getRenderMatrix(entity, m_renderAlpha);
+        const float maxScale = Engine::Ecs::TransformHierarchy::getMaxScale(modelMatrix);
+        const auto &meshes = meshRef.model->getMeshes();
+        const auto &lodStates = meshRef.lodStates;
+
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+        {
+          const Engine::Asset::Mesh &mesh = *meshes[meshIndex];
+          const Engine::Asset::MeshBounds &bounds = mesh.getBounds();
+          glm::vec3 worldCenter = glm::vec3(modelMatrix * glm::vec4(bounds.center, 1.0f));
+          if (!cascade.casterFrustum.intersectsSphere(worldCenter, bounds.radius * maxScale))
+          {
+            continue;
+          }
+
+          // Sem LOD escolhida ainda (objeto nunca visto): a mais simples basta para a sombra
+          int lod = meshIndex < lodStates.size() ? lodStates[meshIndex].currentLod : -1;
+          if (lod < 0)
+          {
+            lod = static_cast<int>(mesh.getLodCount()) - 1;
+          }
+
+          Engine::Render::DrawPacket packet{mesh.getSortId(), static_cast<uint32_t>(objectIndex), static_cast<uint32_t>(meshIndex),
+                                            {&mesh, modelMatrix, static_cast<uint32_t>(lod), 1.0f, true}};
+          packets.push_back(packet);
+        }
+      }
+      m_renderStats.shadowCascadeMs[job] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cascadeStart).count();
+    });
+
+    bool anyRendered = false;
+    commands.beginGpuZone("Shadows");
+    for (int index = 0; index < cascadeCount; ++index)
+    {
+      const Engine::Render::ShadowCascade &cascade = m_shadowCascades.getCascade(index);
+      if (!cascade.needsRender)
+      {
+        m_renderStats.shadowCascadeCached[index] = true;
+        continue;
+      }
+
+      commands.beginGpuZone(cascadeGpuZones[index]);
+      auto shadowMap = m_shadowMap;
+      commands.upload([shadowMap, index]()
+                      { shadowMap->beginLayer(index); });
+      commands.bindShader(m_shadowShader.get());
+      commands.setUniform("uLightViewProjection", cascade.viewProjection);
+
+      std::vector<Engine::Render::DrawPacket> &packets = m_shadowPackets[static_cast<size_t>(index)];
+      m_renderStats.shadowCasters[index] = packets.size();
+      m_renderStats.drawCalls += packets.size();
+      Engine::Render::CommandList::sortDrawPackets(packets);
+      commands.appendDrawPackets(packets);
+      commands.endGpuZone();
+
+      m_shadowCascades.markRendered(index);
+      anyRendered = true;
+    }
+
+    if (anyRendered)
+    {
+      auto shadowMap = m_shadowMap;
+      commands.upload([shadowMap]()
+                      { shadowMap->endPass(); });
+    }
+    commands.endGpuZone();
+  }
+
+  void Scene::recordLightingUniforms(Engine::Render::CommandList &commands, const glm::mat4 &view, const glm::mat4 &projection,
+                                     bool uploadLightBuffers) const
+  {
+    commands.setUniform("uProjection", projection);
+    commands.setUniform("uView", view);
+
+    commands.setUniform("uLightPos", m_sunDirection); // Direção do sol
+    commands.setUniform("uViewPos", m_camera->getPosition());
+
+    if (uploadLightBuffers)
+    {
+      m_clusteredLighting.record(commands);
+    }
+    else
+    {
+      m_clusteredLighting.recordUniforms(commands);
+    }
+    bindShadowUniforms(commands);
+  }
+
+  void Scene::recordTerrain(Engine::Render::CommandList &commands, const glm::mat4 &view, const glm::mat4 &projection,
+                            const RecordContext &context, bool deferred) const
+  {
+    const Engine::Render::Shader *terrainShader = deferred ? m_terrainGBufferShader.get() : m_terrainShader.get();
+    if (!m_terrain || !m_terrain->isReady() || !terrainShader)
+    {
+      return;
+    }
+
+    m_terrain->select(context.frustum, context.cameraPosition);
+
+    commands.bindShader(terrainShader);
+    if (deferred)
+    {
+      commands.setUniform("uProjection", projection);
+      commands.setUniform("uView", view);
+    }
+    else
+    {
+      recordLightingUniforms(commands, view, projection, false); // Buffers de luz já enviados pelo pass das meshes
+    }
+    commands.beginGpuZone("Terrain");
+    m_terrain->record(commands, terrainShader, context.cameraPosition);
+    commands.endGpuZone();
+
+    const Engine::Terrain::CdlodSelection &selection = m_terrain->getSelection();
+    m_renderStats.terrainChunks = selection.fullChunks.size();
+    m_renderStats.terrainQuadrants = selection.quadrantChunks.size();
+    m_renderStats.terrainTriangles = m_terrain->getSelectedTriangles();
+    m_renderStats.terrainNodesVisited = selection.nodesVisited;
+    m_renderStats.terrainSelectMs = m_terrain->getLastSelectMs();
+    m_renderStats.drawCalls += (selection.fullChunks.empty() ? 0 : 1) + (selection.quadrantChunks.empty() ? 0 : 1);
+  }
+
+  void Scene::recordVegetation(Engine::Render::CommandList &commands, const glm::mat4 &view, const glm::mat4 &projection,
+                               const RecordContext &context, bool deferred) const
+  {
+    const Engine::Render::Shader *vegetationShader = deferred ? m_vegetationGBufferShader.get() : m_vegetationShader.get();
+    if (!m_vegetation || !m_vegetation->isReady() || !vegetationShader)
+    {
+      return;
+    }
+
+    m_vegetation->select(context.frustum, context.cameraPosition);
+
+    commands.bindShader(vegetationShader);
+    if (deferred)
+    {
+      commands.setUniform("uProjection", projection);
+      commands.setUniform("uView", view);
+    }
+    else
+    {
+      recordLightingUniforms(commands, view, projection, false); // Buffers de luz já enviados pelo pass das meshes
+    }
+    commands.beginGpuZone("Vegetation");
+    m_vegetation->record(commands, vegetationShader, m_renderTime);
+    commands.endGpuZone();
+
+    const Engine::Vegetation::VegetationStats &stats = m_vegetation->getStats();
+    m_renderStats.vegetationInstances = stats.drawnInstances;
+    m_renderStats.vegetationPatches = stats.drawnPatches;
+    m_renderStats.vegetationMultiDraws = stats.multiDraws;
+    m_renderStats.vegetationSelectMs = stats.selectMs;
+    m_renderStats.drawCalls += stats.multiDraws;
+  }
+
+  float Scene::groundHeight(float x, float z) const
+  {
+    float height = 0.0f;
+    return m_terrain && m_terrain->isReady() && m_terrain->tryGetHeight(x, z, height) ? height : 0.0f;
+  }
+
+  void Scene::logReport() const
+  {
+    m_systems.logReport();
+    m_transforms.logReport();
+    if (m_worldStreamer)
+    {
+      m_worldStreamer->logReport();
+    }
+    if (m_vegetation)
+    {
+      m_vegetation->logReport();
+    }
+  }
+
+  void Scene::recordDeferredResolve(Engine::Render::CommandList &commands, const glm::mat4 &view, const glm::mat4 &projection) const
+  {
+    commands.beginGpuZone("DeferredResolve");
+    auto gbuffer = m_gbuffer;
+    commands.upload([gbuffer]()
+                    { gbuffer->endGeometryPass(); });
+
+    commands.bindShader(m_deferredLightingShader.get());
+    recordLightingUniforms(commands, view, projection);
+    commands.setUniform("uInverseViewProjection", glm::inverse(projection * view));
+    commands.setUniform("uGBufferAlbedo", 0);
+    commands.setUniform("uGBufferNormal", 1);
+    commands.setUniform("uGBufferMaterial", 2);
+    commands.setUniform("uGBufferEmissive", 3);
+    commands.setUniform("uGBufferDepth", 4);
+
+    commands.upload([gbuffer]()
+                    {
+                      gbuffer->bindTextures(0);
+                      gbuffer->drawFullscreen(); });
+    commands.endGpuZone();
+    m_renderStats.drawCalls++;
+  }
+
+  void Scene::bindShadowUniforms(Engine::Render::CommandList &commands) const
+  {
+    // Nomes com duração estática (a CommandList só guarda o ponteiro)
+    static const char *const cascadeMatrixNames[Engine::Render::kMaxShadowCascades] = {
+        "uCascadeViewProjection[0]", "uCascadeViewProjection[1]", "uCascadeViewProjection[2]", "uCascadeViewProjection[3]"};
+
+    if (m_shadowMap)
+    {
+      auto shadowMap = m_shadowMap;
+      commands.upload([shadowMap]()
+                      { shadowMap->bind(static_cast<GLuint>(Engine::SHADOW_MAP_TEXTURE_UNIT)); });
+    }
+    // O sampler sempre aponta para a própria unidade (tipos de sampler diferentes não podem dividir unidade)
+    commands.setUniform("uShadowMap", Engine::SHADOW_MAP_TEXTURE_UNIT);
+
+    const bool enabled = Engine::SHADOWS_ENABLED && m_shadowShader && m_shadowMap;
+    const int cascadeCount = enabled ? m_shadowCascades.getCount() : 0;
+    glm::vec4 splits(0.0f);
+    for (int index = 0; index < cascadeCount; ++index)
+    {
+      const Engine::Render::ShadowCascade &cascade = m_shadowCascades.getCascade(index);
+      commands.setUniform(cascadeMatrixNames[index], cascade.viewProjection);
+      splits[index] = cascade.splitFar;
+    }
+    commands.setUniform("uCascadeSplits", splits);
+    commands.setUniform("uCascadeCount", cascadeCount);
+    commands.setUniform("uShadowTexelSize", 1.0f / static_cast<float>(Engine::SHADOW_MAP_SIZE));
+  }
+
+  void Scene::recordObject(std::vector<Engine::Render::DrawPacket> &packets, std::vector<Engine::Asset::IndexRange> &ranges,
+                           Engine::Render::RenderStats &stats, const glm::mat4 &modelMatrix, const Engine::Ecs::MeshRef &meshRef,
+                           uint32_t objectIndex, const RecordContext &context) const
+  {
+    const Engine::Asset::Model *model = meshRef.model.get();
+    if (!model)
+    {
+      return;
+    }
+
+    // Escala de mundo (inclui a dos pais) para o raio das esferas
+    const float maxScale = Engine::Ecs::TransformHierarchy::getMaxScale(modelMatrix);
+
+    const auto &meshes = model->getMeshes();
+    auto &lodStates = meshRef.lodStates;
+    lodStates.resize(meshes.size());
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+      const Engine::Asset::Mesh &mesh = *meshes[i];
+      const Engine::Asset::MeshBounds &bounds = mesh.getBounds();
+
+      glm::vec3 worldCenter = glm::vec3(modelMatrix * glm::vec4(bounds.center, 1.0f));
+      const float worldRadius = bounds.radius * maxScale;
+
+      if (!context.frustum.intersectsSphere(worldCenter, worldRadius))
+      {
+        stats.culledMeshes++;
+        continue;
+      }
+
+      float screenSize = Engine::Render::LodSelector::computeScreenSize(worldCenter, worldRadius, context.cameraPosition, context.projectionScaleY);
+      Engine::Render::LodSelection selection = Engine::Render::LodSelector::select(lodStates[i], screenSize, mesh.getLodCount(), m_renderTime);
+
+      stats.trianglesFullDetail += mesh.getTriangleCount(0);
+
+      const uint32_t sequence = static_cast<uint32_t>(i * 2);
+      if (selection.fadingLod >= 0)
+      {
+        // LOD saindo: uLodFade negativo (fade - 1), dither complementar ao da LOD que entra
+        Engine::Render::DrawMeshCommand command{&mesh, modelMatrix, static_cast<uint32_t>(selection.fadingLod), selection.fade - 1.0f};
+        stats.crossFadingMeshes++;
+        if (cullMeshlets(mesh, modelMatrix, context, ranges, command, stats))
+        {
+          packets.push_back({mesh.getSortId(), objectIndex, sequence, command});
+          stats.drawCalls++;
+        }
+      }
+
+      const float lodFade = selection.fadingLod >= 0 ? selection.fade : 1.0f;
+      Engine::Render::DrawMeshCommand command{&mesh, modelMatrix, static_cast<uint32_t>(selection.lod), lodFade};
+      if (cullMeshlets(mesh, modelMatrix, context, ranges, command, stats))
+      {
+        packets.push_back({mesh.getSortId(), objectIndex, sequence + 1, command});
+        stats.drawCalls++;
+      }
+    }
+  }
+
+  bool Scene::cullMeshlets(const Engine::Asset::Mesh &mesh, const glm::mat4 &modelMatrix, const RecordContext &context,
+                           std::vector<Engine::Asset::IndexRange> &ranges, Engine::Render::DrawMeshCommand &command,
+                           Engine::Render::RenderStats &stats) const
+  {
+    const std::vector<Engine::Asset::Meshlet> &meshlets = mesh.getMeshlets();
+    if (!Engine::MESHLET_CULLING_ENABLED || meshlets.empty() || command.lod != 0)
+    {
+      stats.triangles += mesh.getTriangleCount(command.lod);
+      return true; // LOD inteira (meshlets só existem na LOD 0)
+    }
+
+    // Frustum e câmera no espaço local da mesh: um teste por meshlet, sem transformar esferas
+    const Engine::Render::Frustum localFrustum(context.viewProjection * modelMatrix);
+    const glm::vec3 localCamera = glm::vec3(glm::inverse(modelMatrix) * glm::vec4(context.cameraPosition, 1.0f));
+
+    command.rangeOffset = static_cast<uint32_t>(ranges.size());
+    Engine::Render::MeshletCullResult result = Engine::Render::MeshletCulling::cull(meshlets, localFrustum, localCamera, ranges);
+    command.rangeCount = result.rangeCount;
+
+    stats.meshletsTested += meshlets.size();
+    stats.meshletsCulledFrustum += result.culledByFrustum;
+    stats.meshletsCulledCone += result.culledByCone;
+    stats.triangles += result.visibleTriangles;
+    return result.rangeCount > 0;
+  }
+
+  void Scene::spawnStressTestLights(size_t count)
+  {
+    // Área do primeiro objeto com modelo (o mapa estático); sem ele, 100 x 100 m em volta da origem
+    glm::vec3 areaMin(-50.0f, 0.0f, -50.0f);
+    glm::vec3 areaMax(50.0f, 0.0f, 50.0f);
+    if (m_terrain && m_terrain->isReady())
+    {
+      // Terreno CDLOD: 100 x 100 m em volta da origem, acima do ponto mais alto
+      areaMin.y = areaMax.y = m_terrain->getWorldMax().y;
+    }
+    else
+    {
+      const Engine::Ecs::ComponentPool<Engine::Ecs::MeshRef> *meshRefs = m_registry.findPool<Engine::Ecs::MeshRef>();
+      for (size_t i = 0; meshRefs && i < meshRefs->size(); ++i)
+      {
+        const Engine::Ecs::MeshRef &meshRef = meshRefs->componentAt(i);
+        const Engine::Ecs::Transform *transform = m_registry.tryGet<Engine::Ecs::Transform>(meshRefs->entityAt(i));
+        if (meshRef.model && transform)
+        {
+          const Engine::Asset::MeshBounds &bounds = meshRef.model->getBounds();
+          areaMin = bounds.min + transform->position;
+          areaMax = bounds.max + transform->position;
+          break;
+        }
+      }
+    }
+
+    std::mt19937 rng(42); // Semente fixa: mesma distribuição a cada execução
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (size_t i = 0; i < count; ++i)
+    {
+      Engine::Render::PointLight light;
+      light.position = glm::vec3(glm::mix(areaMin.x, areaMax.x, unit(rng)),
+                                 areaMax.y + 0.5f + 3.0f * unit(rng),
+                                 glm::mix(areaMin.z, areaMax.z, unit(rng)));
+      light.radius = 2.0f + 6.0f * unit(rng);
+      light.color = glm::vec3(1.0f, 0.5f + 0.4f * unit(rng), 0.2f + 0.3f * unit(rng)); // Tons de tocha
+      light.intensity = 2.0f + 3.0f * unit(rng);
+      m_pointLights.push_back(light);
+    }
+    Engine::Log::Info(std::format("Scene: {} luzes de teste adicionadas.", count));
   }
 
   Engine::Camera::ICamera &Scene::getCamera()
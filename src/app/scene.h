@@ -5,6 +5,16 @@
 #include <glm/glm.hpp> 
 #include "./../../engine/render/camera/icamera.h" 
 #include "./../../engine/render/texture.h" 
+#include "./../../engine/render/render_stats.h" 
+#include "./../../engine/render/frustum.h" 
+#include "./../../engine/render/command_list.h" 
+#include "./../../engine/render/clustered_lighting.h" 
+#include "./../../engine/render/shadow_cascades.h" 
+#include "./../../engine/render/render_path.h" 
+#include "./../../engine/ecs/components.h" 
+#include "./../../engine/ecs/registry.h" 
+#include "./../../engine/ecs/transform_hierarchy.h" 
+#include "./../../engine/ecs/system_scheduler.h" 
 
 // Forward declarations para as classes necessárias
 namespace Engine {
@@ -14,9 +24,13 @@ namespace Geometry {
 namespace Render {
     class Shader;
     class Material; 
+    class CommandList;
+    class ShadowMap;
+    class GBuffer;
 }
 namespace Asset {
     class Model; 
+    class Mesh;
 }
 namespace Game {
     class GameObject;
@@ -25,6 +39,17 @@ namespace Game {
 namespace Input { 
     class InputManager; 
 }
+namespace Terrain {
+    class TerrainSystem;
+}
+namespace World {
+    class WorldStreamer;
+    struct StreamingStats;
+}
+namespace Vegetation {
+    class VegetationSystem;
+    struct VegetationStats;
+}
 } // namespace Engine
 
 #include "./../../engine/render/camera/free_camera.h"
@@ -40,21 +65,131 @@ public:
     ~Scene(); 
 
     void initialize();
+    // Um passo da simulação (chamado zero ou mais vezes por frame, sempre com o mesmo deltaTime)
     void update(float deltaTime, const Input::InputManager& inputManager); 
-    void render(const glm::mat4& projection, const glm::mat4& view) const; 
+    // Antes de render: posição do frame entre os dois últimos passos (alpha 0 = anterior, 1 = último)
+    void setInterpolation(float alpha, float stepSeconds);
+    // Uma vez por frame, fora do passo fixo: streaming do mundo e vegetação seguem o foco atual
+    // (os limites de integração e o benchmark da vegetação são por frame)
+    void updateWorld();
+    // Grava os comandos de desenho do frame; a reprodução GL acontece na thread de renderização
+    void render(Engine::Render::CommandList& commands, const glm::mat4& projection, const glm::mat4& view,
+                const Engine::Render::FrameSettings& settings = Engine::Render::FrameSettings{}) const; 
     
     Engine::Camera::ICamera& getCamera();
     void setCamera(std::unique_ptr<Engine::Camera::ICamera> camera);
 
+    // Luzes pontuais dinâmicas (atribuídas aos froxels a cada frame)
+    void addPointLight(const Engine::Render::PointLight& light) { m_pointLights.push_back(light); }
+    void clearPointLights() { m_pointLights.clear(); }
+    const std::vector<Engine::Render::PointLight>& getPointLights() const { return m_pointLights; }
+
+    // Chamar quando objetos estáticos forem adicionados, removidos ou movidos (invalida caches de sombra)
+    void markStaticGeometryChanged() { ++m_staticGeometryVersion; }
+
+    // Contadores do último Scene::render (draw calls, triângulos com e sem LOD)
+    const Engine::Render::RenderStats& getRenderStats() const { return m_renderStats; }
+    // Relatório periódico dos subsistemas da cena: sistemas de jogo, transformações e, se ativos,
+    // streaming do mundo e vegetação (o desenho fica no log do Renderer)
+    void logReport() const;
+
 private:
+    // Dados do frame compartilhados (somente leitura) pelos jobs de gravação
+    struct RecordContext {
+        Engine::Render::Frustum frustum;
+        glm::vec3 cameraPosition;
+        float projectionScaleY;
+        glm::mat4 viewProjection; // Para o frustum local de cada mesh no culling por meshlet
+    };
+
+    // Culling, seleção de LOD e geração dos pacotes de um objeto (com cross-fade, se ativo).
+    // Chamado em paralelo: só escreve em 'packets', 'ranges', 'stats' e no estado de LOD do próprio objeto.
+    // 'ranges' recebe as faixas dos meshlets visíveis (rangeOffset dos pacotes é relativo a este buffer).
+    void recordObject(std::vector<Engine::Render::DrawPacket>& packets, std::vector<Engine::Asset::IndexRange>& ranges,
+                      Engine::Render::RenderStats& stats, const glm::mat4& modelMatrix, const Engine::Ecs::MeshRef& meshRef,
+                      uint32_t objectIndex, const RecordContext& context) const;
+    // Culling por meshlet de uma mesh na LOD 0; retorna false se nada ficou visível
+    bool cullMeshlets(const Engine::Asset::Mesh& mesh, const glm::mat4& modelMatrix, const RecordContext& context,
+                      std::vector<Engine::Asset::IndexRange>& ranges, Engine::Render::DrawMeshCommand& command,
+                      Engine::Render::RenderStats& stats) const;
+
     std::unique_ptr<Engine::Camera::ICamera> m_camera; 
     
     std::unique_ptr<Engine::Render::Shader> shader; 
     
-    // Gerenciar GameObjects
-    std::vector<std::unique_ptr<Engine::Game::GameObject>> m_gameObjects; 
-    // **** MUDANÇA AQUI: Ponteiro para o PlayerCharacter ****
-    Engine::Game::PlayerCharacter* m_playerCharacter = nullptr; // NOVO: Ponteiro para o GameObject do personagem (PlayerCharacter)
+    // Entidades da cena (Transform, MeshRef, ...); os GameObjects são só fachadas sobre elas
+    Engine::Ecs::Registry m_registry;
+    // Sistemas de jogo do passo (registrados no construtor com os componentes que leem e escrevem)
+    Engine::Ecs::SystemScheduler m_systems;
+    const Input::InputManager* m_stepInput = nullptr; // Entrada do passo em andamento (sistema do jogador)
+    // Matrizes de mundo em cache (recalculadas só para entidades marcadas com TransformDirty)
+    Engine::Ecs::TransformHierarchy m_transforms;
+    // Fachada do personagem do jogador (nula se o modelo não carregou)
+    std::unique_ptr<Engine::Game::PlayerCharacter> m_playerCharacter;
+
+    // Passes de profundidade das cascatas que precisam ser atualizadas neste frame
+    void recordShadows(Engine::Render::CommandList& commands, const glm::mat4& view, const glm::mat4& projection) const;
+    // Pré-pass só de profundidade com os pacotes já ordenados; deixa o teste em GL_EQUAL sem escrita
+    void recordDepthPrepass(Engine::Render::CommandList& commands, const glm::mat4& view, const glm::mat4& projection) const;
+    // Uniforms de iluminação (sol, luzes clusterizadas, sombras) para o shader ligado: forward ou resolve.
+    // 'uploadLightBuffers' = false quando um shader anterior do mesmo frame já gravou o upload das luzes.
+    void recordLightingUniforms(Engine::Render::CommandList& commands, const glm::mat4& view, const glm::mat4& projection,
+                                bool uploadLightBuffers = true) const;
+    // Seleção CDLOD e desenho do terreno (depois das meshes, com o teste de profundidade padrão)
+    void recordTerrain(Engine::Render::CommandList& commands, const glm::mat4& view, const glm::mat4& projection,
+                       const RecordContext& context, bool deferred) const;
+    // Seleção e desenho instanciado da vegetação (logo depois do terreno, mesmo estado de profundidade)
+    void recordVegetation(Engine::Render::CommandList& commands, const glm::mat4& view, const glm::mat4& projection,
+                          const RecordContext& context, bool deferred) const;
+    // Fim do pass de G-buffer e resolve em tela cheia
+    void recordDeferredResolve(Engine::Render::CommandList& commands, const glm::mat4& view, const glm::mat4& projection) const;
+    // Shadow map e matrizes das cascatas para o shader principal (já ligado)
+    void bindShadowUniforms(Engine::Render::CommandList& commands) const;
+
+    // Altura do chão em (x, z): terreno CDLOD se houver (e a célula estiver carregada), senão 0
+    float groundHeight(float x, float z) const;
+    static constexpr float kCharacterGroundOffset = 0.9f; // Meia altura do cubo do personagem
+
+    // Espalha 'count' luzes aleatórias sobre o terreno (teste de carga da iluminação clusterizada)
+    void spawnStressTestLights(size_t count);
+
+    std::vector<Engine::Render::PointLight> m_pointLights;
+    mutable Engine::Render::ClusteredLighting m_clusteredLighting;
+
+    glm::vec3 m_sunDirection = glm::normalize(glm::vec3(50.0f, 50.0f, 50.0f)); // Aponta para o sol
+    std::unique_ptr<Engine::Render::Shader> m_shadowShader;
+    std::shared_ptr<Engine::Render::ShadowMap> m_shadowMap; // Compartilhado com os comandos gravados
+    mutable Engine::Render::ShadowCascades m_shadowCascades;
+    mutable std::vector<std::vector<Engine::Render::DrawPacket>> m_shadowPackets; // Um buffer por cascata
+    uint64_t m_staticGeometryVersion = 1;
+
+    std::unique_ptr<Engine::Render::Shader> m_gbufferShader;
+    std::unique_ptr<Engine::Render::Shader> m_deferredLightingShader;
+    std::shared_ptr<Engine::Render::GBuffer> m_gbuffer;
+
+    std::unique_ptr<Engine::Render::Shader> m_depthPrepassShader;
+
+    // Terreno CDLOD (nulo com TERRAIN_ENABLED = false, quando a cena usa o mapa estático)
+    std::unique_ptr<Engine::Terrain::TerrainSystem> m_terrain;
+    std::unique_ptr<Engine::Render::Shader> m_terrainShader;        // terrain.vert + basic.frag
+    std::unique_ptr<Engine::Render::Shader> m_terrainGBufferShader; // terrain.vert + gbuffer.frag
+    // Carrega e descarrega os tiles em volta do jogador (declarado depois do terreno: é destruído antes)
+    std::unique_ptr<Engine::World::WorldStreamer> m_worldStreamer;
+    // Grama, arbustos e pedras sobre os tiles residentes (destruída antes do terreno)
+    std::unique_ptr<Engine::Vegetation::VegetationSystem> m_vegetation;
+    std::unique_ptr<Engine::Render::Shader> m_vegetationShader;        // vegetation.vert + basic.frag
+    std::unique_ptr<Engine::Render::Shader> m_vegetationGBufferShader; // vegetation.vert + gbuffer.frag
+
+    float m_time = 0.0f; // Tempo acumulado da cena (segundos), usado no cross-fade de LOD
+    float m_renderAlpha = 1.0f; // Interpolação do frame (setInterpolation)
+    float m_renderTime = 0.0f;  // m_time do instante desenhado (atrás do último passo pela fração que falta)
+    mutable Engine::Render::RenderStats m_renderStats;
+
+    // Buffers da gravação paralela, um por job (reaproveitados entre frames)
+    mutable std::vector<std::vector<Engine::Render::DrawPacket>> m_jobPackets;
+    mutable std::vector<Engine::Render::RenderStats> m_jobStats;
+    mutable std::vector<std::vector<Engine::Asset::IndexRange>> m_jobRanges;
+    mutable std::vector<Engine::Render::DrawPacket> m_sortedPackets;
 };
 
 } // namespace Engine
\ No newline at end of file
@@ -0,0 +1,128 @@
+// tests/ecs_determinism_test.cpp
+// O SystemScheduler precisa dar o mesmo resultado, bit a bit, com as ondas em paralelo e no modo
+// determinístico (replay). NPCs que vagueiam e regeneram vida passam pelos mesmos passos nos dois modos
+// (mesma semente), com sistemas de faixa e comandos estruturais; o hash das posições finais precisa
+// ser igual entre os modos e entre repetições do modo paralelo.
+#include "./../engine/ecs/components.h"
+#include "./../engine/ecs/registry.h"
+#include "./../engine/ecs/system_scheduler.h"
+#include "./../engine/memory/frame_arena.h"
+#include "test_check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <utility>
+
+using namespace Engine::Ecs;
+
+namespace {
+
+constexpr size_t kEntityCount = 20000;
+constexpr int kSteps = 60;
+constexpr int kRepetitions = 5;
+
+// Componentes só deste teste
+struct Wander {
+    float phase = 0.0f;
+    float turnRate = 1.0f;
+};
+struct Health {
+    float value = 50.0f;
+    float regen = 1.0f;
+};
+
+// Retorna o hash das posições e o tempo por passo
+std::pair<uint64_t, double> runSchedulerSteps(bool deterministic) {
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+    Registry registry;
+    std::mt19937 rng(4321);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    for (size_t i = 0; i < kEntityCount; ++i) {
+        const Entity entity = registry.create();
+        registry.add<Transform>(entity).position = glm::vec3(unit(rng), 0.0f, unit(rng)) * 500.0f;
+        registry.add<Velocity>(entity);
+        registry.add<Wander>(entity, unit(rng) * 3.14159f, 0.5f + unit(rng) * 0.5f);
+        registry.add<Health>(entity, 50.0f + unit(rng) * 50.0f, 1.0f);
+    }
+
+    SystemScheduler scheduler;
+    scheduler.setDeterministic(deterministic);
+    scheduler.addSystem("wander")
+        .writes<Wander, Velocity>()
+        .runParallel<Wander>([](SystemContext& context, size_t begin, size_t end) {
+            ComponentPool<Wander>& wanders = *context.registry.findPool<Wander>();
+            ComponentPool<Velocity>& velocities = *context.registry.findPool<Velocity>();
+            for (size_t dense = begin; dense < end; ++dense) {
+                Wander& wander = wanders.componentAt(dense);
+                wander.phase += wander.turnRate * context.deltaTime;
+                Velocity* velocity = velocities.tryGet(wanders.entityAt(dense).index);
+                if (velocity) {
+                    velocity->linear = glm::vec3(std::cos(wander.phase), 0.0f, std::sin(wander.phase)) * 2.0f;
+                }
+            }
+        });
+    scheduler.addSystem("regen")
+        .writes<Health>()
+        .runParallel<Health>([](SystemContext& context, size_t begin, size_t end) {
+            ComponentPool<Health>& healths = *context.registry.findPool<Health>();
+            for (size_t dense = begin; dense < end; ++dense) {
+                Health& health = healths.componentAt(dense);
+                health.value = std::min(100.0f, health.value + health.regen * context.deltaTime);
+            }
+        });
+    scheduler.addSystem("integrate")
+        .writes<Transform, TransformDirty>()
+        .runParallel<Velocity>([](SystemContext& context, size_t begin, size_t end) {
+            ComponentPool<Velocity>& velocities = *context.registry.findPool<Velocity>();
+            ComponentPool<Transform>& transforms = *context.registry.findPool<Transform>();
+            for (size_t dense = begin; dense < end; ++dense) {
+                const Entity entity = velocities.entityAt(dense);
+                transforms.get(entity.index).position += velocities.componentAt(dense).linear * context.deltaTime;
+                context.commands.add<TransformDirty>(entity);
+            }
+        });
+    // Faz o papel da TransformHierarchy: consome as marcas
+    scheduler.addSystem("consumeDirty").exclusive().run([](SystemContext& context) {
+        if (ComponentPool<TransformDirty>* dirty = context.registry.findPool<TransformDirty>()) {
+            dirty->clear();
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < kSteps; ++step) {
+        // Cada passo faz o papel de um frame
+        Engine::Memory::FrameArena::Get().beginFrame();
+        scheduler.run(registry, kDeltaTime);
+    }
+    const double stepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kSteps;
+
+    // FNV-1a sobre os bits das posições, na ordem das entidades
+    uint64_t hash = 1469598103934665603ull;
+    registry.each<Transform>([&hash](Entity, const Transform& transform) {
+        uint32_t bits[3];
+        std::memcpy(bits, &transform.position, sizeof(bits));
+        for (const uint32_t value : bits) {
+            hash = (hash ^ value) * 1099511628211ull;
+        }
+    });
+    return {hash, stepMs};
+}
+
+} // namespace
+
+int main() {
+    const auto [serialHash, serialMs] = runSchedulerSteps(true);
+    for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+        const auto [parallelHash, parallelMs] = runSchedulerSteps(false);
+        std::printf("%zu NPCs, %d passos: paralelo %.3f ms/passo (hash %016llx), determinístico %.3f ms/passo (hash %016llx).\n",
+                    kEntityCount, kSteps, parallelMs, static_cast<unsigned long long>(parallelHash), serialMs,
+                    static_cast<unsigned long long>(serialHash));
+        TEST_CHECK(parallelHash == serialHash);
+    }
+    TEST_CHECK(runSchedulerSteps(true).first == serialHash);
+    return Engine::Test::result();
+}
@@ -0,0 +1,126 @@
+// tests/ecs_layout_benchmark.cpp
+// Compara a iteração de entidades no Registry com o layout antigo de GameObject (vetor de ponteiros
+// para objetos no heap com vtable, nome e modelo próprios) e imprime os tempos. Dois laços por layout:
+// atualização (posição += velocidade * dt) e matrizes de transformação. Não falha: só mede.
+#include "./../engine/asset/model.h"
+#include "./../engine/ecs/components.h"
+#include "./../engine/ecs/registry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine::Ecs;
+
+namespace {
+
+constexpr size_t kEntityCount = 100000;
+constexpr int kIterations = 10;
+
+// Réplica do GameObject antigo: um objeto por alocação, despacho virtual no update
+class LegacyObject {
+public:
+    virtual ~LegacyObject() = default;
+    virtual void update(float deltaTime) { position += velocity * deltaTime; }
+
+    glm::mat4 getTransformMatrix() const {
+        glm::mat4 matrix = glm::translate(glm::mat4(1.0f), position);
+        matrix = matrix * glm::mat4_cast(rotation);
+        return glm::scale(matrix, scale);
+    }
+
+    std::string name = "GameObject";
+    glm::vec3 position{0.0f};
+    glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::vec3 scale{1.0f};
+    glm::vec3 velocity{0.0f};
+    std::unique_ptr<Engine::Asset::Model> model;
+    std::vector<Engine::Render::LodState> lodStates;
+};
+
+template <typename Fn>
+double averageMs(Fn&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        fn();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kIterations;
+}
+
+} // namespace
+
+int main() {
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    // Mesmos valores iniciais nos dois layouts
+    std::vector<Transform> initial(kEntityCount);
+    std::vector<glm::vec3> velocities(kEntityCount);
+    for (size_t i = 0; i < kEntityCount; ++i) {
+        initial[i].position = glm::vec3(unit(rng), unit(rng), unit(rng)) * 500.0f;
+        initial[i].rotation = glm::angleAxis(unit(rng) * 3.14159f, glm::vec3(0.0f, 1.0f, 0.0f));
+        velocities[i] = glm::vec3(unit(rng), 0.0f, unit(rng)) * 5.0f;
+    }
+
+    // Layout antigo
+    std::vector<std::unique_ptr<LegacyObject>> objects;
+    objects.reserve(kEntityCount);
+    for (size_t i = 0; i < kEntityCount; ++i) {
+        auto object = std::make_unique<LegacyObject>();
+        object->position = initial[i].position;
+        object->rotation = initial[i].rotation;
+        object->velocity = velocities[i];
+        objects.push_back(std::move(object));
+    }
+    // Objetos criados e destruídos ao longo do jogo não ficam em ordem no heap: a iteração salta
+    std::shuffle(objects.begin(), objects.end(), rng);
+
+    // Registry
+    Registry registry;
+    registry.getPool<Transform>().reserve(kEntityCount);
+    registry.getPool<Velocity>().reserve(kEntityCount);
+    for (size_t i = 0; i < kEntityCount; ++i) {
+        const Entity entity = registry.create();
+        registry.add<Transform>(entity, initial[i]);
+        registry.add<Velocity>(entity, velocities[i]);
+    }
+
+    // O checksum impede que o compilador descarte os laços
+    float checksum = 0.0f;
+    const double legacyUpdateMs = averageMs([&]() {
+        for (const std::unique_ptr<LegacyObject>& object : objects) {
+            object->update(kDeltaTime);
+        }
+    });
+    const double legacyMatrixMs = averageMs([&]() {
+        glm::vec4 sum(0.0f);
+        for (const std::unique_ptr<LegacyObject>& object : objects) {
+            sum += object->getTransformMatrix()[3];
+        }
+        checksum += sum.x;
+    });
+    const double ecsUpdateMs = averageMs([&]() {
+        registry.each<Velocity, Transform>([](Entity, const Velocity& velocity, Transform& transform) {
+            transform.position += velocity.linear * kDeltaTime;
+        });
+    });
+    const double ecsMatrixMs = averageMs([&]() {
+        glm::vec4 sum(0.0f);
+        for (const Transform& transform : registry.getPool<Transform>().components()) {
+            sum += transform.getMatrix()[3];
+        }
+        checksum += sum.x;
+    });
+
+    std::printf("%zu entidades, média de %d iterações (checksum %.1f).\n", kEntityCount, kIterations, checksum);
+    std::printf("Atualização: GameObject %.3f ms, ECS %.3f ms (%.1fx).\n", legacyUpdateMs, ecsUpdateMs,
+                legacyUpdateMs / std::max(ecsUpdateMs, 1e-6));
+    std::printf("Matrizes: GameObject %.3f ms, ECS %.3f ms (%.1fx).\n", legacyMatrixMs, ecsMatrixMs,
+                legacyMatrixMs / std::max(ecsMatrixMs, 1e-6));
+    return 0;
+}
@@ -0,0 +1,216 @@
+// tests/job_system_stress_test.cpp
+// Teste de carga do JobSystem: jobs independentes, árvore de jobs aninhados com espera, dependências
+// entre contadores, parallelFor aninhado e várias threads de fora do pool agendando ao mesmo tempo
+// (cada caso confere o próprio resultado). Depois imprime o custo por job vazio agendado de fora e de
+// dentro do pool, por dependência e por elemento de parallelFor, com a aceleração sobre o laço em série.
+#include "./../engine/core/jobs.h"
+#include "test_check.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using Engine::Jobs::Counter;
+using Engine::Jobs::JobSystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Cada nó agenda dois filhos e espera por eles antes de terminar (espera dentro de job)
+void forkTree(JobSystem& jobs, int depth, std::atomic<uint64_t>& leaves) {
+    if (depth == 0) {
+        leaves.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Counter children;
+    jobs.run([&jobs, depth, &leaves]() { forkTree(jobs, depth - 1, leaves); }, &children);
+    jobs.run([&jobs, depth, &leaves]() { forkTree(jobs, depth - 1, leaves); }, &children);
+    jobs.wait(children);
+}
+
+void checkIndependentJobs(JobSystem& jobs) {
+    constexpr uint64_t kCount = 100000;
+    std::atomic<uint64_t> executed{0};
+    Counter counter;
+    for (uint64_t i = 0; i < kCount; ++i) {
+        jobs.run([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+    jobs.wait(counter);
+    TEST_CHECK(executed.load() == kCount);
+}
+
+void checkNestedTree(JobSystem& jobs) {
+    constexpr int kDepth = 14;
+    std::atomic<uint64_t> leaves{0};
+    Counter root;
+    jobs.run([&jobs, &leaves]() { forkTree(jobs, kDepth, leaves); }, &root);
+    jobs.wait(root);
+    TEST_CHECK(leaves.load() == (1ull << kDepth));
+}
+
+// A -> B -> C: cada estágio confere que o anterior terminou inteiro antes de começar
+void checkDependencies(JobSystem& jobs) {
+    constexpr uint64_t kStage = 1000;
+    std::atomic<uint64_t> stageA{0}, stageB{0}, stageC{0}, orderErrors{0};
+    Counter a, b, c;
+    for (uint64_t i = 0; i < kStage; ++i) {
+        jobs.run([&]() { stageA.fetch_add(1); }, &a);
+    }
+    for (uint64_t i = 0; i < kStage; ++i) {
+        jobs.runAfter(a, [&]() { orderErrors += stageA.load() != kStage; stageB.fetch_add(1); }, &b);
+    }
+    for (uint64_t i = 0; i < kStage; ++i) {
+        jobs.runAfter(b, [&]() { orderErrors += stageB.load() != kStage; stageC.fetch_add(1); }, &c);
+    }
+    jobs.wait(c);
+    TEST_CHECK(orderErrors.load() == 0);
+    TEST_CHECK(stageC.load() == kStage);
+}
+
+void checkNestedParallelFor(JobSystem& jobs) {
+    constexpr size_t kOuter = 64;
+    constexpr size_t kInner = 10000;
+    std::vector<uint64_t> sums(kOuter, 0);
+    jobs.parallelFor(kOuter, [&](size_t begin, size_t end) {
+        for (size_t outer = begin; outer < end; ++outer) {
+            std::atomic<uint64_t> sum{0};
+            jobs.parallelFor(kInner, [&](size_t innerBegin, size_t innerEnd) {
+                uint64_t local = 0;
+                for (size_t i = innerBegin; i < innerEnd; ++i) {
+                    local += i;
+                }
+                sum.fetch_add(local, std::memory_order_relaxed);
+            }, 64);
+            sums[outer] = sum.load();
+        }
+    }, 1);
+    constexpr uint64_t kExpected = static_cast<uint64_t>(kInner) * (kInner - 1) / 2;
+    for (uint64_t sum : sums) {
+        TEST_CHECK(sum == kExpected);
+    }
+}
+
+// Threads de fora do pool (como as de streaming) agendando e esperando ao mesmo tempo
+void checkExternalSubmitters(JobSystem& jobs) {
+    constexpr uint64_t kPerThread = 20000;
+    std::atomic<uint64_t> executed{0};
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < 3; ++t) {
+        submitters.emplace_back([&jobs, &executed]() {
+            Counter counter;
+            for (uint64_t i = 0; i < kPerThread; ++i) {
+                jobs.run([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+            jobs.wait(counter);
+        });
+    }
+    for (std::thread& submitter : submitters) {
+        submitter.join();
+    }
+    TEST_CHECK(executed.load() == 3 * kPerThread);
+}
+
+void measureCosts(JobSystem& jobs) {
+    constexpr uint64_t kEmptyJobs = 200000;
+    double externalNs = 0.0;
+    {
+        Counter counter;
+        const auto start = Clock::now();
+        for (uint64_t i = 0; i < kEmptyJobs; ++i) {
+            jobs.run([]() {}, &counter);
+        }
+        jobs.wait(counter);
+        externalNs = elapsedMs(start) * 1e6 / kEmptyJobs;
+    }
+    double internalNs = 0.0;
+    {
+        Counter outer;
+        const auto start = Clock::now();
+        jobs.run([&jobs]() {
+            Counter counter;
+            for (uint64_t i = 0; i < kEmptyJobs; ++i) {
+                jobs.run([]() {}, &counter);
+            }
+            jobs.wait(counter);
+        }, &outer);
+        jobs.wait(outer);
+        internalNs = elapsedMs(start) * 1e6 / kEmptyJobs;
+    }
+    double dependencyNs = 0.0;
+    {
+        // Cadeia de N estágios de um job: o custo por elo inclui liberar a continuação
+        constexpr int kChain = 20000;
+        std::vector<std::unique_ptr<Counter>> chain;
+        chain.reserve(kChain);
+        const auto start = Clock::now();
+        chain.push_back(std::make_unique<Counter>());
+        jobs.run([]() {}, chain.back().get());
+        for (int i = 1; i < kChain; ++i) {
+            chain.push_back(std::make_unique<Counter>());
+            jobs.runAfter(*chain[static_cast<size_t>(i - 1)], []() {}, chain.back().get());
+        }
+        jobs.wait(*chain.back());
+        dependencyNs = elapsedMs(start) * 1e6 / kChain;
+        for (const std::unique_ptr<Counter>& counter : chain) {
+            jobs.wait(*counter);
+        }
+    }
+
+    // parallelFor com corpo leve: grão adaptativo contra o laço em série
+    constexpr size_t kElements = 8u << 20;
+    std::vector<float> data(kElements);
+    for (size_t i = 0; i < kElements; ++i) {
+        data[i] = static_cast<float>(i % 1000) * 0.001f;
+    }
+    const auto serialStart = Clock::now();
+    for (size_t i = 0; i < kElements; ++i) {
+        data[i] = std::sqrt(data[i] * data[i] + 1.0f);
+    }
+    const double serialMs = elapsedMs(serialStart);
+    const auto parallelStart = Clock::now();
+    jobs.parallelFor(kElements, [&data](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            data[i] = std::sqrt(data[i] * data[i] + 1.0f);
+        }
+    });
+    const double parallelMs = elapsedMs(parallelStart);
+    const auto fineStart = Clock::now();
+    jobs.parallelFor(1u << 20, [&data](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            data[i] += 1.0f;
+        }
+    }, 1);
+    const double fineNs = elapsedMs(fineStart) * 1e6 / (1u << 20);
+
+    const Engine::Jobs::JobStats stats = jobs.getStats();
+    std::printf("%zu threads. Job vazio: %.0f ns agendado de fora, %.0f ns de dentro do pool; dependência: %.0f ns por elo.\n",
+                jobs.getThreadCount(), externalNs, internalNs, dependencyNs);
+    std::printf("parallelFor de %zu elementos: %.3f ms (série %.3f ms, %.1fx); grão mínimo 1: %.1f ns por elemento.\n", kElements,
+                parallelMs, serialMs, serialMs / std::max(parallelMs, 1e-6), fineNs);
+    std::printf("%llu jobs executados, %llu por outra thread.\n", static_cast<unsigned long long>(stats.executed),
+                static_cast<unsigned long long>(stats.stolen));
+}
+
+} // namespace
+
+int main() {
+    JobSystem& jobs = JobSystem::Get();
+    checkIndependentJobs(jobs);
+    checkNestedTree(jobs);
+    checkDependencies(jobs);
+    checkNestedParallelFor(jobs);
+    checkExternalSubmitters(jobs);
+    std::printf("Teste de carga: %s.\n", Engine::Test::failureCount() == 0 ? "passou" : "FALHOU");
+    measureCosts(jobs);
+    return Engine::Test::result();
+}
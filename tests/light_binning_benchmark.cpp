@@ -0,0 +1,53 @@
+// tests/light_binning_benchmark.cpp
+// Custo médio de LightClusterGrid::build (atribuição das luzes pontuais aos froxels) com quantidades
+// crescentes de luzes aleatórias, espalhadas em 200 x 200 m à frente da câmera com raios de 2 a 12 m.
+// Não falha: só mede.
+#include "./../engine/render/light_clusters.h"
+#include "./../engine/core/config.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using Engine::Render::LightClusterGrid;
+using Engine::Render::PointLight;
+
+namespace {
+
+constexpr int kIterations = 32;
+
+void measure(size_t lightCount) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> height(0.5f, 8.0f);
+    std::uniform_real_distribution<float> radius(2.0f, 12.0f);
+
+    std::vector<PointLight> lights(lightCount);
+    for (PointLight& light : lights) {
+        light.position = glm::vec3(position(rng), height(rng), position(rng));
+        light.radius = radius(rng);
+    }
+
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 10.0f, 60.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+
+    LightClusterGrid grid;
+    double totalMs = 0.0;
+    for (int i = 0; i < kIterations; ++i) {
+        grid.build(lights, view, projection);
+        totalMs += grid.getLastBuildMs();
+    }
+    std::printf("%zu luzes em %dx%dx%d froxels: %.3f ms em média (%d iterações, %zu índices).\n", lightCount, Engine::CLUSTER_GRID_X,
+                Engine::CLUSTER_GRID_Y, Engine::CLUSTER_GRID_Z, totalMs / kIterations, kIterations, grid.getLightIndices().size());
+}
+
+} // namespace
+
+int main() {
+    for (size_t lightCount : {64u, 256u, 1024u, 4096u}) {
+        measure(lightCount);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+// tests/log_benchmark.cpp
+// Chamadas por segundo do Log: mensagem filtrada pelo nível (macro preguiçosa x std::format antes da
+// chamada), mensagens ativas na fila assíncrona (só o enfileiramento e até a escrita terminar, de uma
+// e de várias threads) e no modo síncrono. A saída no console fica desligada durante as medições; as
+// mensagens vão para o arquivo de log. Não falha: só mede.
+#include "./../engine/core/config.h"
+#include "./../engine/core/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <format>
+#include <thread>
+#include <vector>
+
+using Engine::Log;
+using Engine::LogLevel;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint64_t kFiltered = 10000000;
+constexpr uint64_t kEager = 1000000;
+constexpr uint64_t kMessages = 200000;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Chamadas por segundo a partir do tempo total de 'calls' chamadas
+double perSecond(uint64_t calls, double ms) {
+    return ms > 0.0 ? static_cast<double>(calls) * 1000.0 / ms : 0.0;
+}
+
+} // namespace
+
+int main() {
+    Log::SetLogLevel(LogLevel::Info);
+    Log::SetConsoleOutput(false);
+
+    // ---- Mensagem abaixo do nível: macro preguiçosa x formatação antes da chamada ----
+    const auto lazyStart = Clock::now();
+    for (uint64_t i = 0; i < kFiltered; ++i) {
+        ENGINE_LOG_AT(LogLevel::Debug, "LogBenchmark: mensagem filtrada {} de {} ({:.3f}).", i, kFiltered, 0.5);
+    }
+    const double lazyMs = elapsedMs(lazyStart);
+
+    const auto eagerStart = Clock::now();
+    for (uint64_t i = 0; i < kEager; ++i) {
+        Log::Debug(std::format("LogBenchmark: mensagem filtrada {} de {} ({:.3f}).", i, kEager, 0.5));
+    }
+    const double eagerMs = elapsedMs(eagerStart);
+
+    // ---- Mensagens ativas: fila assíncrona ----
+    Log::SetAsync(true);
+    const auto asyncStart = Clock::now();
+    for (uint64_t i = 0; i < kMessages; ++i) {
+        ENGINE_LOG_INFO("LogBenchmark: mensagem {} de {} ({:.3f}).", i, kMessages, 0.5);
+    }
+    const double asyncEnqueueMs = elapsedMs(asyncStart);
+    Log::Flush();
+    const double asyncTotalMs = elapsedMs(asyncStart);
+
+    // Várias threads logando ao mesmo tempo (disputa pela posição de escrita da fila)
+    const unsigned producers = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+    const uint64_t perProducer = kMessages / producers;
+    const auto contendedStart = Clock::now();
+    {
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < producers; ++t) {
+            threads.emplace_back([t, perProducer]() {
+                for (uint64_t i = 0; i < perProducer; ++i) {
+                    ENGINE_LOG_INFO("LogBenchmark: thread {}, mensagem {} ({:.3f}).", t, i, 0.5);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+    const double contendedEnqueueMs = elapsedMs(contendedStart);
+    Log::Flush();
+    const double contendedTotalMs = elapsedMs(contendedStart);
+
+    // ---- Mensagens ativas: escrita síncrona (formatação do cabeçalho na thread que loga) ----
+    Log::SetAsync(false);
+    const auto syncStart = Clock::now();
+    for (uint64_t i = 0; i < kMessages; ++i) {
+        ENGINE_LOG_INFO("LogBenchmark: mensagem {} de {} ({:.3f}).", i, kMessages, 0.5);
+    }
+    const double syncMs = elapsedMs(syncStart);
+    Log::Shutdown();
+
+    std::printf("Mensagem filtrada: macro %.1f ns (%.0f chamadas/s), std::format antes da chamada %.1f ns (%.0f chamadas/s); "
+                "nível mínimo compilado %d.\n",
+                lazyMs * 1e6 / kFiltered, perSecond(kFiltered, lazyMs), eagerMs * 1e6 / kEager, perSecond(kEager, eagerMs),
+                ENGINE_LOG_MIN_LEVEL);
+    std::printf("Assíncrono, 1 thread: %.0f chamadas/s ao enfileirar, %.0f mensagens/s até a escrita terminar.\n",
+                perSecond(kMessages, asyncEnqueueMs), perSecond(kMessages, asyncTotalMs));
+    std::printf("Assíncrono, %u threads: %.0f chamadas/s ao enfileirar, %.0f mensagens/s até a escrita terminar.\n", producers,
+                perSecond(perProducer * producers, contendedEnqueueMs), perSecond(perProducer * producers, contendedTotalMs));
+    std::printf("Síncrono, 1 thread: %.0f chamadas/s (fila de %d mensagens).\n", perSecond(kMessages, syncMs),
+                static_cast<int>(Engine::LOG_QUEUE_CAPACITY));
+    return 0;
+}
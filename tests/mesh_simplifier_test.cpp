@@ -0,0 +1,118 @@
+// tests/mesh_simplifier_test.cpp
+// Confere o limite de erro do MeshSimplifier contra o desvio geométrico medido: em terrenos 65x65,
+// nenhum vértice original pode ficar mais longe da malha simplificada que 'targetError' (relativo à
+// maior dimensão) e o erro retornado não pode passar do pedido.
+#include "./../engine/asset/mesh_simplifier.h"
+#include "test_check.h"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using Engine::Asset::MeshSimplifier;
+using Engine::Asset::Vertex;
+
+namespace {
+
+constexpr int kGridSize = 65; // 64 x 64 quadrados: maior dimensão = 64 unidades
+
+// Colinas suaves e uma variante com ruído de alta frequência
+float heightAt(int x, int z, bool noisy) {
+    if (!noisy) {
+        return std::sin(x * 0.15f) * std::cos(z * 0.11f) * 6.0f;
+    }
+    uint32_t hash = (static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(z) * 19349663u);
+    hash *= 2654435761u;
+    return std::sin(x * 0.2f) * 4.0f + std::cos(z * 0.17f + x * 0.05f) * 3.0f + static_cast<float>((hash >> 16) & 255u) / 255.0f * 0.5f;
+}
+
+// Ponto do triângulo mais próximo de 'p' (Ericson, Real-Time Collision Detection, 5.1.5)
+glm::dvec3 closestPointOnTriangle(const glm::dvec3& p, const glm::dvec3& a, const glm::dvec3& b, const glm::dvec3& c) {
+    const glm::dvec3 ab = b - a, ac = c - a, ap = p - a;
+    const double d1 = glm::dot(ab, ap), d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) { return a; }
+    const glm::dvec3 bp = p - b;
+    const double d3 = glm::dot(ab, bp), d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) { return b; }
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) { return a + ab * (d1 / (d1 - d3)); }
+    const glm::dvec3 cp = p - c;
+    const double d5 = glm::dot(ab, cp), d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) { return c; }
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) { return a + ac * (d2 / (d2 - d6)); }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) { return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))); }
+    const double denom = 1.0 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// Maior distância de um vértice original à superfície simplificada
+double maxDeviation(const std::vector<Vertex>& vertices, const std::vector<GLuint>& simplified) {
+    double worst = 0.0;
+    for (const Vertex& vertex : vertices) {
+        const glm::dvec3 p(vertex.Position);
+        double best = 1e30;
+        for (size_t t = 0; t < simplified.size(); t += 3) {
+            const glm::dvec3 a(vertices[simplified[t]].Position);
+            const glm::dvec3 b(vertices[simplified[t + 1]].Position);
+            const glm::dvec3 c(vertices[simplified[t + 2]].Position);
+            // Descarta pelo retângulo XZ antes do teste exato
+            const double dx = std::max({std::min({a.x, b.x, c.x}) - p.x, 0.0, p.x - std::max({a.x, b.x, c.x})});
+            const double dz = std::max({std::min({a.z, b.z, c.z}) - p.z, 0.0, p.z - std::max({a.z, b.z, c.z})});
+            if (dx * dx + dz * dz >= best * best) {
+                continue;
+            }
+            best = std::min(best, glm::length(p - closestPointOnTriangle(p, a, b, c)));
+        }
+        worst = std::max(worst, best);
+    }
+    return worst;
+}
+
+void checkHeightfield(bool noisy) {
+    std::vector<Vertex> vertices;
+    std::vector<GLuint> indices;
+    for (int z = 0; z < kGridSize; ++z) {
+        for (int x = 0; x < kGridSize; ++x) {
+            Vertex vertex{};
+            vertex.Position = glm::vec3(static_cast<float>(x), heightAt(x, z, noisy), static_cast<float>(z));
+            vertices.push_back(vertex);
+        }
+    }
+    for (int z = 0; z < kGridSize - 1; ++z) {
+        for (int x = 0; x < kGridSize - 1; ++x) {
+            const GLuint a = static_cast<GLuint>(z * kGridSize + x), b = a + 1, c = a + kGridSize, d = c + 1;
+            indices.insert(indices.end(), {a, c, b, b, c, d});
+        }
+    }
+    const double extent = static_cast<double>(kGridSize - 1);
+
+    size_t previousTriangles = indices.size() / 3;
+    for (float targetError : {0.0005f, 0.001f, 0.003f, 0.01f, 0.03f}) {
+        float error = 0.0f;
+        const std::vector<GLuint> simplified = MeshSimplifier::simplify(vertices, indices, 0, targetError, &error);
+        const double deviation = maxDeviation(vertices, simplified);
+        const double bound = static_cast<double>(targetError) * extent;
+        std::printf("%s, targetError %.4f (%.3f unidades): %zu/%zu triângulos, erro %.4f, desvio máximo %.3f unidades (%.2fx o limite)\n",
+                    noisy ? "com ruído" : "suave", targetError, bound, simplified.size() / 3, indices.size() / 3, error, deviation,
+                    deviation / bound);
+
+        TEST_CHECK(simplified.size() % 3 == 0);
+        TEST_CHECK(error <= targetError);
+        TEST_CHECK(deviation <= bound);
+        TEST_CHECK(simplified.size() / 3 <= previousTriangles); // Limite maior nunca mantém mais triângulos
+        previousTriangles = simplified.size() / 3;
+    }
+    TEST_CHECK(previousTriangles < indices.size() / 3); // O maior limite precisa simplificar algo
+}
+
+} // namespace
+
+int main() {
+    checkHeightfield(false);
+    checkHeightfield(true);
+    return Engine::Test::result();
+}
@@ -0,0 +1,138 @@
+// tests/parallel_record_test.cpp
+// A gravação paralela da cena (Scene::render) precisa gerar o mesmo fluxo de pacotes com qualquer
+// número de jobs e threads. A Scene depende de meshes na GPU, então o teste reproduz o mesmo caminho
+// (WorkerPool::parallelFor com um buffer por job, rebase das faixas de meshlets em
+// CommandList::appendIndexRanges e CommandList::mergeDrawPackets) com objetos sintéticos no formato de
+// Scene::recordObject: várias meshes por objeto, cross-fade com dois pacotes e faixas de meshlets.
+// A referência é um único job na thread chamadora; cada divisão é repetida para variar o agendamento.
+#include "./../engine/render/command_list.h"
+#include "./../engine/core/worker_pool.h"
+#include "./../engine/core/config.h"
+#include "test_check.h"
+
+#include <glm/glm.hpp>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using Engine::Asset::IndexRange;
+using Engine::Render::CommandList;
+using Engine::Render::DrawPacket;
+
+namespace {
+
+constexpr size_t kObjectCount = 5000;
+constexpr int kRepetitions = 20;
+
+// Pacote com as faixas já resolvidas (o rebase muda rangeOffset conforme a divisão em jobs)
+struct ResolvedPacket {
+    uint64_t sortKey;
+    uint32_t objectIndex;
+    uint32_t sequence;
+    uint32_t lod;
+    float lodFade;
+    glm::mat4 modelMatrix;
+    std::vector<IndexRange> ranges;
+
+    bool operator==(const ResolvedPacket& other) const {
+        if (sortKey != other.sortKey || objectIndex != other.objectIndex || sequence != other.sequence || lod != other.lod ||
+            std::memcmp(&lodFade, &other.lodFade, sizeof(float)) != 0 ||
+            std::memcmp(&modelMatrix, &other.modelMatrix, sizeof(glm::mat4)) != 0 || ranges.size() != other.ranges.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            if (ranges[i].first != other.ranges[i].first || ranges[i].count != other.ranges[i].count) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Como Scene::recordObject: poucas chaves de material (muitos empates), sequence = mesh * 2 (+1 no
+// segundo pacote do cross-fade) e, em parte das meshes, faixas de meshlets visíveis
+void recordObject(std::vector<DrawPacket>& packets, std::vector<IndexRange>& ranges, uint32_t objectIndex) {
+    glm::mat4 modelMatrix(1.0f);
+    modelMatrix[3] = glm::vec4(static_cast<float>(objectIndex), static_cast<float>(objectIndex % 17), 0.0f, 1.0f);
+    const uint32_t meshCount = 1 + objectIndex % 3;
+    for (uint32_t mesh = 0; mesh < meshCount; ++mesh) {
+        const uint32_t sequence = mesh * 2;
+        const uint64_t sortKey = (objectIndex * 7u + mesh) % 11u;
+        const bool crossFade = objectIndex % 5 == 0;
+        for (uint32_t step = 0; step < (crossFade ? 2u : 1u); ++step) {
+            Engine::Render::DrawMeshCommand command{nullptr, modelMatrix, mesh + step, crossFade ? 0.25f + 0.5f * step : 1.0f};
+            if ((objectIndex + mesh) % 4 == 0) {
+                command.rangeOffset = static_cast<uint32_t>(ranges.size());
+                command.rangeCount = 1 + objectIndex % 3;
+                for (uint32_t r = 0; r < command.rangeCount; ++r) {
+                    ranges.push_back({objectIndex * 100 + r * 10, 3 + r});
+                }
+            }
+            packets.push_back({sortKey, objectIndex, sequence + step, command});
+        }
+    }
+}
+
+std::vector<ResolvedPacket> recordScene(size_t grainSize) {
+    const size_t jobCount = Engine::WorkerPool::chunkCount(kObjectCount, grainSize);
+    std::vector<std::vector<DrawPacket>> jobPackets(jobCount);
+    std::vector<std::vector<IndexRange>> jobRanges(jobCount);
+
+    Engine::WorkerPool::Get().parallelFor(kObjectCount, grainSize, [&](size_t job, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            recordObject(jobPackets[job], jobRanges[job], static_cast<uint32_t>(i));
+        }
+    });
+
+    CommandList commands;
+    for (size_t job = 0; job < jobCount; ++job) {
+        const uint32_t base = commands.appendIndexRanges(jobRanges[job]);
+        for (DrawPacket& packet : jobPackets[job]) {
+            if (packet.command.rangeCount > 0) {
+                packet.command.rangeOffset += base;
+            }
+        }
+    }
+    std::vector<DrawPacket> merged;
+    CommandList::mergeDrawPackets(jobPackets, merged);
+
+    std::vector<ResolvedPacket> resolved;
+    resolved.reserve(merged.size());
+    for (const DrawPacket& packet : merged) {
+        const auto& allRanges = commands.getIndexRanges();
+        const auto first = allRanges.begin() + packet.command.rangeOffset;
+        resolved.push_back({packet.sortKey, packet.objectIndex, packet.sequence, packet.command.lod, packet.command.lodFade,
+                            packet.command.modelMatrix,
+                            std::vector<IndexRange>(first, packet.command.rangeCount > 0 ? first + packet.command.rangeCount : first)});
+    }
+    return resolved;
+}
+
+} // namespace
+
+int main() {
+    // Um job só: equivale à gravação com um worker
+    const std::vector<ResolvedPacket> reference = recordScene(kObjectCount);
+    TEST_CHECK(!reference.empty());
+    for (size_t i = 1; i < reference.size(); ++i) {
+        const ResolvedPacket& a = reference[i - 1];
+        const ResolvedPacket& b = reference[i];
+        TEST_CHECK(a.sortKey < b.sortKey || (a.sortKey == b.sortKey && (a.objectIndex < b.objectIndex ||
+                   (a.objectIndex == b.objectIndex && a.sequence < b.sequence))));
+    }
+
+    const size_t grainSizes[] = {1, 7, 64, static_cast<size_t>(Engine::RENDER_RECORD_OBJECTS_PER_JOB)};
+    for (size_t grainSize : grainSizes) {
+        size_t mismatches = 0;
+        for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+            if (recordScene(grainSize) != reference) {
+                ++mismatches;
+            }
+        }
+        std::printf("Grão %zu (%zu jobs, %zu threads): %zu de %d gravações diferentes da referência (%zu pacotes).\n", grainSize,
+                    Engine::WorkerPool::chunkCount(kObjectCount, grainSize), Engine::WorkerPool::Get().getThreadCount(), mismatches,
+                    kRepetitions, reference.size());
+        TEST_CHECK(mismatches == 0);
+    }
+    return Engine::Test::result();
+}
@@ -0,0 +1,33 @@
+// tests/test_check.h
+#pragma once
+
+#include <cstdio>
+
+// Verificação mínima dos testes da CTest: uma falha é impressa e contada, e o teste segue até o fim.
+// main() retorna Engine::Test::result() (0 = tudo passou).
+namespace Engine {
+namespace Test {
+
+inline int& failureCount() {
+    static int count = 0;
+    return count;
+}
+
+inline int result() {
+    if (failureCount() > 0) {
+        std::fprintf(stderr, "%d verificação(ões) falharam.\n", failureCount());
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace Test
+} // namespace Engine
+
+#define TEST_CHECK(condition)                                                                                  \
+    do {                                                                                                       \
+        if (!(condition)) {                                                                                    \
+            ++::Engine::Test::failureCount();                                                                  \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition);                      \
+        }                                                                                                      \
+    } while (0)
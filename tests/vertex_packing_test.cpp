@@ -0,0 +1,80 @@
+// tests/vertex_packing_test.cpp
+// Erro da quantização de vértices (PackedVertex) contra o formato float: malhas aleatórias com AABBs
+// de tamanhos e posições diferentes (incluindo uma achatada num eixo) precisam ficar dentro dos
+// limites de VertexPacking::withinBounds e preservar o sinal da bitangente.
+#include "./../engine/asset/vertex_packing.h"
+#include "test_check.h"
+
+#include <glm/glm.hpp>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using Engine::Asset::MeshBounds;
+using Engine::Asset::PackedVertex;
+using Engine::Asset::Vertex;
+using Engine::Asset::VertexPacking;
+using Engine::Asset::VertexQuantizationError;
+
+namespace {
+
+constexpr size_t kVertexCount = 20000;
+
+glm::vec3 randomDirection(std::mt19937& rng) {
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+    glm::vec3 direction(0.0f);
+    while (glm::length(direction) < 1e-3f) {
+        direction = glm::vec3(gaussian(rng), gaussian(rng), gaussian(rng));
+    }
+    return glm::normalize(direction);
+}
+
+void checkMesh(const char* name, const glm::vec3& boundsMin, const glm::vec3& boundsMax, std::mt19937& rng) {
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> texCoord(-4.0f, 4.0f);
+
+    std::vector<Vertex> vertices(kVertexCount);
+    for (size_t i = 0; i < kVertexCount; ++i) {
+        Vertex& vertex = vertices[i];
+        vertex.Position = boundsMin + (boundsMax - boundsMin) * glm::vec3(unit(rng), unit(rng), unit(rng));
+        vertex.Normal = randomDirection(rng);
+        vertex.Tangent = glm::vec4(randomDirection(rng), unit(rng) < 0.5f ? -1.0f : 1.0f);
+        vertex.TexCoords = glm::vec2(texCoord(rng), texCoord(rng));
+    }
+    // Cantos da AABB e direções nos eixos (casos de borda do octaédrico)
+    vertices[0].Position = boundsMin;
+    vertices[1].Position = boundsMax;
+    vertices[2].Normal = glm::vec3(0.0f, 0.0f, -1.0f);
+    vertices[3].Normal = glm::vec3(1.0f, 0.0f, 0.0f);
+    vertices[4].Tangent = glm::vec4(0.0f, -1.0f, 0.0f, -1.0f);
+
+    MeshBounds bounds;
+    bounds.min = boundsMin;
+    bounds.max = boundsMax;
+
+    const std::vector<PackedVertex> packed = VertexPacking::packAll(vertices, bounds);
+    const VertexQuantizationError error = VertexPacking::measureError(vertices, packed, bounds);
+    std::printf("%s: posição %.6f, normal %.4f graus, tangente %.4f graus, UV %.6f\n", name, error.position, error.normalDegrees,
+                error.tangentDegrees, error.texCoord);
+    TEST_CHECK(packed.size() == vertices.size());
+    TEST_CHECK(VertexPacking::withinBounds(error, vertices, bounds));
+
+    size_t signMismatches = 0;
+    for (size_t i = 0; i < kVertexCount; ++i) {
+        if (VertexPacking::unpack(packed[i], bounds).Tangent.w != vertices[i].Tangent.w) {
+            ++signMismatches;
+        }
+    }
+    TEST_CHECK(signMismatches == 0);
+}
+
+} // namespace
+
+int main() {
+    std::mt19937 rng(1234u);
+    checkMesh("cubo unitário", glm::vec3(-0.5f), glm::vec3(0.5f), rng);
+    checkMesh("terreno grande deslocado", glm::vec3(1000.0f, -20.0f, 4000.0f), glm::vec3(1512.0f, 80.0f, 4512.0f), rng);
+    checkMesh("objeto pequeno", glm::vec3(0.0f), glm::vec3(0.01f, 0.02f, 0.005f), rng);
+    checkMesh("plano (eixo Y achatado)", glm::vec3(-10.0f, 2.0f, -10.0f), glm::vec3(10.0f, 2.0f, 10.0f), rng);
+    return Engine::Test::result();
+}